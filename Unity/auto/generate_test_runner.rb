@@ -45,6 +45,7 @@ class UnityTestRunnerGenerator
       cmdline_args: false,
       omit_begin_end: false,
       use_param_tests: false,
+      table_driven: false,
       include_extensions: '(?:hpp|hh|H|h)',
       source_extensions: '(?:cpp|cc|ino|C|c)'
     }
@@ -98,6 +99,7 @@ class UnityTestRunnerGenerator
       create_reset(output)
       create_run_test(output) unless tests.empty?
       create_args_wrappers(output, tests)
+      create_test_table(output, tests) if @options[:table_driven]
       create_main(output, input_file, tests, used_mocks)
     end
 
@@ -388,7 +390,40 @@ class UnityTestRunnerGenerator
     end
   end
 
+  # Every test (each parameter set of a parameterized test counts as one) as [function, name, line]
+  def test_table_entries(tests)
+    tests.flat_map do |test|
+      if (!@options[:use_param_tests]) || test[:args].nil? || test[:args].empty?
+        [[test[:test], test[:test].dump, test[:line_number]]]
+      else
+        test[:args].each.with_index(1).map do |args, idx|
+          ["runner_args#{idx}_#{test[:test]}", "#{test[:test]}(#{args})".dump, test[:line_number]]
+        end
+      end
+    end
+  end
+
+  def create_test_table(output, tests)
+    return if tests.empty?
+
+    output.puts("\n/*=======Test Table=====*/")
+    output.puts('typedef struct')
+    output.puts('{')
+    output.puts('  UnityTestFunction func;')
+    output.puts('  const char* name;')
+    output.puts('  UNITY_LINE_TYPE line_num;')
+    output.puts('} runner_test_entry;')
+    output.puts('static const runner_test_entry runner_tests[] =')
+    output.puts('{')
+    test_table_entries(tests).each do |func, name, line_num|
+      output.puts("  { #{func}, #{name}, #{line_num} },")
+    end
+    output.puts('};')
+    output.puts('#define RUNNER_TEST_COUNT (sizeof(runner_tests) / sizeof(runner_tests[0]))')
+  end
+
   def create_main(output, filename, tests, used_mocks)
+    table_driven = @options[:table_driven] && !tests.empty?
     output.puts("\n/*=======MAIN=====*/")
     main_name = @options[:main_name].to_sym == :auto ? "main_#{filename.gsub('.c', '')}" : (@options[:main_name]).to_s
     if @options[:cmdline_args]
@@ -397,6 +432,7 @@ class UnityTestRunnerGenerator
       end
       output.puts("#{@options[:main_export_decl]} int #{main_name}(int argc, char** argv)")
       output.puts('{')
+      output.puts('  unsigned int i;') if table_driven
       output.puts('  int parse_status = UnityParseOptions(argc, argv);')
       output.puts('  if (parse_status != 0)')
       output.puts('  {')
@@ -404,7 +440,17 @@ class UnityTestRunnerGenerator
       output.puts('    {')
       output.puts("      UnityPrint(\"#{filename.gsub('.c', '').gsub(/\\/, '\\\\\\')}.\");")
       output.puts('      UNITY_PRINT_EOL();')
+      if table_driven
+        output.puts('      for (i = 0; i < RUNNER_TEST_COUNT; i++)')
+        output.puts('      {')
+        output.puts('        UnityPrint("  ");')
+        output.puts('        UnityPrint(runner_tests[i].name);')
+        output.puts('        UNITY_PRINT_EOL();')
+        output.puts('      }')
+      end
       tests.each do |test|
+        break if table_driven
+
         if (!@options[:use_param_tests]) || test[:args].nil? || test[:args].empty?
           output.puts("      UnityPrint(\"  #{test[:test]}\");")
           output.puts('      UNITY_PRINT_EOL();')
@@ -426,6 +472,7 @@ class UnityTestRunnerGenerator
       end
       output.puts("#{main_return} #{main_name}(void)")
       output.puts('{')
+      output.puts('  unsigned int i;') if table_driven
     end
     output.puts('  suiteSetUp();') if @options[:has_suite_setup]
     if @options[:omit_begin_end]
@@ -433,7 +480,15 @@ class UnityTestRunnerGenerator
     else
       output.puts("  UnityBegin(\"#{filename.gsub(/\\/, '\\\\\\')}\");")
     end
+    if table_driven
+      output.puts('  for (i = 0; i < RUNNER_TEST_COUNT; i++)')
+      output.puts('  {')
+      output.puts('    run_test(runner_tests[i].func, runner_tests[i].name, runner_tests[i].line_num);')
+      output.puts('  }')
+    end
     tests.each do |test|
+      break if table_driven
+
       if (!@options[:use_param_tests]) || test[:args].nil? || test[:args].empty?
         output.puts("  run_test(#{test[:test]}, \"#{test[:test]}\", #{test[:line_number]});")
       else
@@ -530,6 +585,7 @@ if $0 == __FILE__
           '    --suite_teardown=""   - code to execute for teardown of entire suite',
           '    --use_param_tests=1   - enable parameterized tests (disabled by default)',
           '    --omit_begin_end=1    - omit calls to UnityBegin and UnityEnd (disabled by default)',
+          '    --table_driven=1      - run the tests from a table in one loop (disabled by default)',
           '    --header_file=""      - path/name of test header file to generate too'].join("\n")
     exit 1
   end
@@ -0,0 +1,225 @@
+#! python3
+# ==========================================
+#   Unity Project - A Test Framework for C
+#   Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+#   [Released under MIT License. Please refer to license.txt for details]
+# ==========================================
+"""Runs Unity test executables in parallel and merges their results.
+
+Every executable (or, for Unity Fixture executables, every test group or test
+case selected with the fixture's -g/-n filters) runs in its own process. The
+output of each job is captured and printed as one block when the job finishes,
+so failure output of concurrent jobs never interleaves. Each job's output is
+saved as a .testpass/.testfail result file, which is then summarized with
+unity_test_summary.py and optionally converted to JUnit XML with
+stylize_as_junit.py.
+"""
+import argparse
+import os
+import re
+import subprocess
+import sys
+import time
+from concurrent.futures import ThreadPoolExecutor, as_completed
+from glob import glob
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from unity_test_summary import UnityTestSummary  # noqa: E402
+
+SUMMARY_PATTERN = re.compile(r"([0-9]+) Tests ([0-9]+) Failures ([0-9]+) Ignored")
+FIXTURE_TEST_PATTERN = re.compile(r"^(?:IGNORE_)?TEST\((\w+), (\w+)\)\s*$")
+# Help text of the fixture's -l option (extras/fixture/src/unity_fixture.c). Only executables linked with the
+# fixture contain it, so others are never started just to be asked for their tests.
+FIXTURE_MARKER = b'List the selected tests, one per line, without running them'
+
+
+class UnityJob:
+    def __init__(self, executable, args, name):
+        self.executable = executable
+        self.args = args
+        self.name = name
+        self.output = ''
+        self.seconds = 0.0
+        self.passed = False
+        self.result_file = None
+
+    def command(self):
+        return [self.executable] + self.args
+
+
+class UnityParallelRunner:
+    def __init__(self, options):
+        self.options = options
+        self.jobs = []
+
+    # ---------------------------------------------------------------- planning
+    @staticmethod
+    def is_fixture_executable(executable):
+        """True if the executable was linked with Unity Fixture, found without running it."""
+        try:
+            with open(executable, 'rb') as binary:
+                return FIXTURE_MARKER in binary.read()
+        except OSError:
+            return False
+
+    def list_fixture_tests(self, executable):
+        """Returns [(group, name), ...] using the fixture's -l option, or None if unsupported."""
+        if not self.is_fixture_executable(executable):
+            return None
+        try:
+            listing = subprocess.run([executable, '-l'], stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                                     timeout=self.options.timeout, universal_newlines=True).stdout
+        except (OSError, subprocess.TimeoutExpired):
+            return None
+        tests = []
+        for line in listing.splitlines():
+            m = FIXTURE_TEST_PATTERN.match(line)
+            if m and (m.group(1), m.group(2)) not in tests:
+                tests.append((m.group(1), m.group(2)))
+        return tests if tests else None
+
+    @staticmethod
+    def is_isolated(value, others):
+        """The fixture filters match substrings, so a filter only isolates value if no other value contains it."""
+        return not any((value != other) and (value in other) for other in others)
+
+    def plan(self, executable):
+        base = os.path.basename(executable)
+        whole = [UnityJob(executable, list(self.options.args), base)]
+        if self.options.split == 'none':
+            return whole
+
+        tests = self.list_fixture_tests(executable)
+        if tests is None:
+            return whole
+
+        groups = []
+        for group, _ in tests:
+            if group not in groups:
+                groups.append(group)
+        if not all(self.is_isolated(g, groups) for g in groups):
+            print("%s: group names overlap, running it as a single job" % base)
+            return whole
+
+        if self.options.split == 'test':
+            names_isolated = True
+            for group in groups:
+                names = [n for g, n in tests if g == group]
+                names_isolated = names_isolated and all(self.is_isolated(n, names) for n in names)
+            if names_isolated:
+                return [UnityJob(executable, list(self.options.args) + ['-g', g, '-n', n], "%s.%s.%s" % (base, g, n))
+                        for g, n in tests]
+            print("%s: test names overlap, splitting it by group instead" % base)
+
+        return [UnityJob(executable, list(self.options.args) + ['-g', g], "%s.%s" % (base, g)) for g in groups]
+
+    # --------------------------------------------------------------- execution
+    def run_job(self, job):
+        start = time.time()
+        note = None
+        try:
+            proc = subprocess.run(job.command(), stdout=subprocess.PIPE, stderr=subprocess.STDOUT,
+                                  timeout=self.options.timeout)
+            job.output = proc.stdout.decode('utf-8', errors='replace')
+            if proc.returncode < 0:
+                note = "Test executable crashed (signal %d)" % -proc.returncode
+            elif not SUMMARY_PATTERN.search(job.output):
+                note = "Test executable exited without a Unity summary (exit code %d)" % proc.returncode
+            job.passed = (proc.returncode == 0) and (note is None)
+        except subprocess.TimeoutExpired as e:
+            job.output = (e.stdout or b'').decode('utf-8', errors='replace')
+            note = "Test executable timed out after %d seconds" % self.options.timeout
+        except OSError as e:
+            note = "Unable to start test executable (%s)" % e.strerror
+        job.seconds = time.time() - start
+
+        # Keep the result file parseable by the summary tools when the executable never finished.
+        if note is not None:
+            job.passed = False
+            job.output += "\n%s:0:%s:FAIL: %s\n\n-----------------------\n1 Tests 1 Failures 0 Ignored\nFAIL\n" % (
+                job.executable, job.name, note)
+
+        extension = '.testpass' if job.passed else '.testfail'
+        job.result_file = os.path.join(self.options.results_dir, job.name + extension)
+        with open(job.result_file, 'w') as f:
+            f.write(job.output)
+        return job
+
+    def report_job(self, job, done, total):
+        print("[%*d/%d] %s %s (%.2fs)" % (len(str(total)), done, total, 'PASS' if job.passed else 'FAIL',
+                                          job.name, job.seconds))
+        if (not job.passed) or self.options.verbose:
+            print("---- %s ----" % ' '.join(job.command()))
+            print(job.output.rstrip('\n'))
+            print("---- end of %s ----" % job.name)
+        sys.stdout.flush()
+
+    def run(self):
+        os.makedirs(self.options.results_dir, exist_ok=True)
+        for stale in glob(os.path.join(self.options.results_dir, '*.testpass')) + \
+                glob(os.path.join(self.options.results_dir, '*.testfail')):
+            os.remove(stale)
+
+        for executable in self.options.executables:
+            self.jobs += self.plan(executable)
+        if len(self.jobs) == 0:
+            raise Exception("No test executables given")
+
+        print("Running %d jobs on %d workers" % (len(self.jobs), self.options.jobs))
+        done = 0
+        with ThreadPoolExecutor(max_workers=self.options.jobs) as pool:
+            futures = [pool.submit(self.run_job, job) for job in self.jobs]
+            for future in as_completed(futures):
+                done += 1
+                self.report_job(future.result(), done, len(self.jobs))
+
+        results = [job.result_file for job in self.jobs]
+        summary = UnityTestSummary()
+        summary.set_targets(results)
+        summary.set_root_path('')
+        print(summary.run())
+
+        if self.options.junit:
+            self.write_junit(results)
+
+        return 0 if all(job.passed for job in self.jobs) else 1
+
+    def write_junit(self, results):
+        try:
+            from stylize_as_junit import UnityTestSummary as UnityJunitSummary
+        except ImportError as e:
+            raise Exception("JUnit output needs the pyparsing and junit-xml packages (%s)" % e)
+        junit = UnityJunitSummary()
+        junit.set_targets(results)
+        junit.set_root_path('')
+        junit.set_output(self.options.junit)
+        junit.run()
+        print("JUnit report written to %s" % self.options.junit)
+
+
+def parse_arguments(argv):
+    parser = argparse.ArgumentParser(description="Runs Unity test executables in parallel and merges their results.")
+    parser.add_argument('executables', nargs='+', help="Test executables to run.")
+    parser.add_argument('-j', '--jobs', type=int, default=os.cpu_count() or 1,
+                        help="Number of tests run at the same time. Defaults to the number of CPUs.")
+    parser.add_argument('--split', choices=['none', 'group', 'test'], default='none',
+                        help="Split Unity Fixture executables into one job per group or per test. "
+                             "Executables that do not support the fixture's -l option always run as one job.")
+    parser.add_argument('--results-dir', default='parallel_results',
+                        help="Where .testpass/.testfail files are written. Stale result files are removed first.")
+    parser.add_argument('--junit', metavar='FILE', help="Also write a JUnit XML report to FILE.")
+    parser.add_argument('--timeout', type=int, default=600, help="Seconds before a job is killed and failed.")
+    parser.add_argument('--arg', dest='args', action='append', default=[],
+                        help="Extra argument passed to every executable (i.e. --arg=-v). May be repeated.")
+    parser.add_argument('-v', '--verbose', action='store_true', help="Print the output of passing jobs too.")
+    options = parser.parse_args(argv)
+    options.jobs = max(1, options.jobs)
+    return options
+
+
+if __name__ == '__main__':
+    try:
+        sys.exit(UnityParallelRunner(parse_arguments(sys.argv[1:])).run())
+    except Exception as e:
+        print("\nERROR: %s" % e)
+        sys.exit(2)
@@ -0,0 +1,200 @@
+/* ==========================================
+ *  Unity Project - A Test Framework for C
+ *  Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+ *  [Released under MIT License. Please refer to license.txt for details]
+ * ========================================== */
+
+/* clock_gettime is hidden by strict ISO modes unless POSIX is requested */
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "unity.h"
+#include "unity_bench.h"
+
+#ifdef UNITY_BENCH_DEFAULT_CLOCK
+#include <time.h>
+#endif
+
+enum
+{
+    BENCH_IDLE = 0,
+    BENCH_CALIBRATING,
+    BENCH_MEASURING
+};
+
+static struct
+{
+    int State;
+    UNITY_UINT32 Iterations;
+    UNITY_UINT StartNs;
+    UNITY_UINT SampleNs[UNITY_BENCH_SAMPLES];
+    UNITY_UINT32 Samples;
+    int HasResult;
+    UnityBenchResult Result;
+} UnityBench;
+
+/*-----------------------------------------------*/
+#ifdef UNITY_BENCH_DEFAULT_CLOCK
+UNITY_UINT UnityBench_ClockNs(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((UNITY_UINT)ts.tv_sec * (UNITY_UINT)1000000000u) + (UNITY_UINT)ts.tv_nsec;
+}
+#endif
+
+/*-----------------------------------------------*/
+/* Newton's method so the extra does not depend on libm */
+static double UnityBenchSqrt(double value)
+{
+    double root = value;
+    int i;
+
+    if (value <= 0.0)
+    {
+        return 0.0;
+    }
+    for (i = 0; i < 64; i++)
+    {
+        double next = 0.5 * (root + (value / root));
+        if (next == root)
+        {
+            break;
+        }
+        root = next;
+    }
+    return root;
+}
+
+/*-----------------------------------------------*/
+static void UnityBenchComputeResult(void)
+{
+    double perIteration[UNITY_BENCH_SAMPLES];
+    double sum = 0.0;
+    double sumSq = 0.0;
+    UNITY_UINT32 n = UnityBench.Samples;
+    UNITY_UINT32 i;
+    UNITY_UINT32 j;
+
+    /* Insertion sort. There are only a handful of samples. */
+    for (i = 0; i < n; i++)
+    {
+        double v = (double)UnityBench.SampleNs[i] / (double)UnityBench.Iterations;
+        for (j = i; (j > 0) && (perIteration[j - 1] > v); j--)
+        {
+            perIteration[j] = perIteration[j - 1];
+        }
+        perIteration[j] = v;
+        sum += v;
+    }
+
+    UnityBench.Result.Iterations = UnityBench.Iterations;
+    UnityBench.Result.Samples = n;
+    UnityBench.Result.MeanNs = sum / (double)n;
+    UnityBench.Result.MinNs = perIteration[0];
+    UnityBench.Result.MaxNs = perIteration[n - 1];
+    UnityBench.Result.MedianNs = (n % 2u) ? perIteration[n / 2u] :
+                                 ((perIteration[(n / 2u) - 1u] + perIteration[n / 2u]) / 2.0);
+
+    for (i = 0; i < n; i++)
+    {
+        double d = perIteration[i] - UnityBench.Result.MeanNs;
+        sumSq += d * d;
+    }
+    UnityBench.Result.StdDevNs = (n > 1u) ? UnityBenchSqrt(sumSq / (double)(n - 1u)) : 0.0;
+    UnityBench.HasResult = 1;
+}
+
+/*-----------------------------------------------*/
+/* Prints a non-negative value with one decimal place without needing float printing support */
+static void UnityBenchPrintTenths(double value)
+{
+    UNITY_UINT tenths = (UNITY_UINT)((value * 10.0) + 0.5);
+    UnityPrintNumberUnsigned(tenths / 10u);
+    UNITY_OUTPUT_CHAR('.');
+    UNITY_OUTPUT_CHAR((char)('0' + (tenths % 10u)));
+    UnityPrint(" ns");
+}
+
+/*-----------------------------------------------*/
+void UnityBench_Begin(UNITY_UINT32 min_iterations)
+{
+    UnityBench.State = BENCH_IDLE;
+    UnityBench.Iterations = (min_iterations > 0u) ? min_iterations : 1u;
+    UnityBench.Samples = 0;
+    UnityBench.HasResult = 0;
+}
+
+/*-----------------------------------------------*/
+/* Called once per sample. The first samples calibrate the iteration count and double as
+ * warm-up. The remaining UNITY_BENCH_SAMPLES samples are recorded. */
+int UnityBench_KeepRunning(void)
+{
+    UNITY_UINT now = UNITY_BENCH_CLOCK_NS();
+    UNITY_UINT elapsed = now - UnityBench.StartNs;
+
+    switch (UnityBench.State)
+    {
+    case BENCH_IDLE:
+        UnityBench.State = BENCH_CALIBRATING;
+        break;
+
+    case BENCH_CALIBRATING:
+        if ((elapsed < (UNITY_UINT)UNITY_BENCH_MIN_SAMPLE_NS) && (UnityBench.Iterations < UNITY_BENCH_MAX_ITERATIONS))
+        {
+            UnityBench.Iterations *= 2u;
+        }
+        else
+        {
+            UnityBench.State = BENCH_MEASURING;
+        }
+        break;
+
+    default:
+        UnityBench.SampleNs[UnityBench.Samples++] = elapsed;
+        if (UnityBench.Samples >= UNITY_BENCH_SAMPLES)
+        {
+            UnityBench.State = BENCH_IDLE;
+            UnityBenchComputeResult();
+            return 0;
+        }
+        break;
+    }
+
+    /* Read the clock last so the bookkeeping above is not measured */
+    UnityBench.StartNs = UNITY_BENCH_CLOCK_NS();
+    return 1;
+}
+
+/*-----------------------------------------------*/
+UNITY_UINT32 UnityBench_Iterations(void)
+{
+    return UnityBench.Iterations;
+}
+
+/*-----------------------------------------------*/
+const UnityBenchResult* UnityBench_LastResult(void)
+{
+    return UnityBench.HasResult ? &UnityBench.Result : NULL;
+}
+
+/*-----------------------------------------------*/
+void UnityBench_PrintResult(void)
+{
+    if (UnityBench.HasResult)
+    {
+        UnityPrint(" (bench: mean ");
+        UnityBenchPrintTenths(UnityBench.Result.MeanNs);
+        UnityPrint(", median ");
+        UnityBenchPrintTenths(UnityBench.Result.MedianNs);
+        UnityPrint(", stddev ");
+        UnityBenchPrintTenths(UnityBench.Result.StdDevNs);
+        UnityPrint(", ");
+        UnityPrintNumberUnsigned(UnityBench.Result.Iterations);
+        UnityPrint(" iterations x ");
+        UnityPrintNumberUnsigned(UnityBench.Result.Samples);
+        UnityPrint(" samples)");
+        UnityBench.HasResult = 0;
+    }
+}
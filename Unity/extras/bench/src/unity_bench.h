@@ -0,0 +1,95 @@
+/* ==========================================
+ *  Unity Project - A Test Framework for C
+ *  Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+ *  [Released under MIT License. Please refer to license.txt for details]
+ * ========================================== */
+
+#ifndef UNITY_BENCH_H_
+#define UNITY_BENCH_H_
+
+#include "unity.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Build unity.c with UNITY_INCLUDE_BENCH defined so the results of a benchmark are printed
+ * after the PASS/FAIL of the test that produced them. */
+
+/* Number of timed samples taken after calibration. Median and standard deviation are computed
+ * over these samples. */
+#ifndef UNITY_BENCH_SAMPLES
+#define UNITY_BENCH_SAMPLES 11
+#endif
+
+/* Calibration doubles the iterations per sample until a sample takes at least this long. */
+#ifndef UNITY_BENCH_MIN_SAMPLE_NS
+#define UNITY_BENCH_MIN_SAMPLE_NS 1000000u
+#endif
+
+/* Upper bound on iterations per sample so calibration always terminates. */
+#ifndef UNITY_BENCH_MAX_ITERATIONS
+#define UNITY_BENCH_MAX_ITERATIONS 0x1000000u
+#endif
+
+/* Nanosecond clock. Defaults to clock_gettime(CLOCK_MONOTONIC). Targets without POSIX clocks
+ * define this to their own function returning UNITY_UINT nanoseconds (i.e. a cycle counter
+ * scaled by the core clock). */
+#ifndef UNITY_BENCH_CLOCK_NS
+#define UNITY_BENCH_DEFAULT_CLOCK
+#define UNITY_BENCH_CLOCK_NS() UnityBench_ClockNs()
+UNITY_UINT UnityBench_ClockNs(void);
+#endif
+
+typedef struct
+{
+    UNITY_UINT32 Iterations;    /* Iterations per sample chosen by calibration */
+    UNITY_UINT32 Samples;       /* Number of samples recorded */
+    double MeanNs;              /* All statistics are nanoseconds per iteration */
+    double MedianNs;
+    double StdDevNs;
+    double MinNs;
+    double MaxNs;
+} UnityBenchResult;
+
+/* Measures the braced statement that follows once per iteration. Code before and after the
+ * loop runs once, so setup and correctness assertions can share a test with the measurement:
+ *
+ *     void test_WriteReadPair(void)
+ *     {
+ *         TEST_ASSERT_TRUE(Ring_Buffer_Static_Ctor(&me, 1, 10));
+ *         TEST_BENCH_LOOP(1)
+ *         {
+ *             TEST_ASSERT_TRUE(Ring_Buffer_Static_Write(&me, &data, 1));
+ *             TEST_ASSERT_TRUE(Ring_Buffer_Static_Read(&me, &data, 1));
+ *         }
+ *     }
+ *
+ * min_iterations is where calibration starts. Only one loop per test is supported. */
+#define TEST_BENCH_LOOP(min_iterations) \
+    for (UnityBench_Begin(min_iterations); UnityBench_KeepRunning(); ) \
+        for (UNITY_UINT32 unity_bench_i_ = UnityBench_Iterations(); unity_bench_i_ > 0u; unity_bench_i_--)
+
+/* Defines a test function whose body is the operation measured once per iteration. Run it
+ * with RUN_TEST like any other test. */
+#define TEST_BENCH(name, min_iterations) \
+    static void name##_bench_body_(void); \
+    void name(void) { TEST_BENCH_LOOP(min_iterations) { name##_bench_body_(); } } \
+    static void name##_bench_body_(void)
+
+void UnityBench_Begin(UNITY_UINT32 min_iterations);
+int UnityBench_KeepRunning(void);
+UNITY_UINT32 UnityBench_Iterations(void);
+
+/* Returns the results of the most recent benchmark loop or NULL if it did not complete. */
+const UnityBenchResult* UnityBench_LastResult(void);
+
+/* Called by UnityConcludeTest when unity.c is built with UNITY_INCLUDE_BENCH. */
+void UnityBench_PrintResult(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
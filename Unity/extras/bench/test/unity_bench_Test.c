@@ -0,0 +1,93 @@
+/* ==========================================
+ *  Unity Project - A Test Framework for C
+ *  Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+ *  [Released under MIT License. Please refer to license.txt for details]
+ * ========================================== */
+
+#include "unity.h"
+#include "unity_bench.h"
+
+static volatile UNITY_UINT32 body_count;
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_LoopRunsCalibratedIterationsForEverySample(void)
+{
+    const UnityBenchResult* result;
+    UNITY_UINT32 count = 0;
+
+    TEST_BENCH_LOOP(1)
+    {
+        count++;
+    }
+
+    result = UnityBench_LastResult();
+    TEST_ASSERT_NOT_NULL(result);
+    TEST_ASSERT_EQUAL_UINT32(UNITY_BENCH_SAMPLES, result->Samples);
+    TEST_ASSERT_TRUE(result->Iterations >= 1u);
+    /* Calibration samples run too, so at least every recorded sample ran */
+    TEST_ASSERT_TRUE(count >= (result->Iterations * result->Samples));
+}
+
+void test_MinIterationsIsWhereCalibrationStarts(void)
+{
+    const UnityBenchResult* result;
+
+    TEST_BENCH_LOOP(1000)
+    {
+        body_count++;
+    }
+
+    result = UnityBench_LastResult();
+    TEST_ASSERT_NOT_NULL(result);
+    TEST_ASSERT_TRUE(result->Iterations >= 1000u);
+    TEST_ASSERT_EQUAL_UINT32(0, result->Iterations % 1000u);
+}
+
+void test_StatisticsAreConsistent(void)
+{
+    const UnityBenchResult* result;
+
+    TEST_BENCH_LOOP(16)
+    {
+        body_count++;
+    }
+
+    result = UnityBench_LastResult();
+    TEST_ASSERT_NOT_NULL(result);
+    TEST_ASSERT_TRUE(result->MinNs <= result->MedianNs);
+    TEST_ASSERT_TRUE(result->MedianNs <= result->MaxNs);
+    TEST_ASSERT_TRUE(result->MinNs <= result->MeanNs);
+    TEST_ASSERT_TRUE(result->MeanNs <= result->MaxNs);
+    TEST_ASSERT_TRUE(result->StdDevNs >= 0.0);
+    TEST_ASSERT_TRUE(result->StdDevNs <= (result->MaxNs - result->MinNs));
+}
+
+void test_BeginClearsPreviousResult(void)
+{
+    TEST_BENCH_LOOP(1)
+    {
+        body_count++;
+    }
+    UnityBench_Begin(1);
+    TEST_ASSERT_NULL(UnityBench_LastResult());
+}
+
+TEST_BENCH(test_BenchMacroRunsBody, 1)
+{
+    body_count++;
+}
+
+void test_BenchMacroRanBody(void)
+{
+    body_count = 0;
+    test_BenchMacroRunsBody();
+    TEST_ASSERT_TRUE(body_count >= UNITY_BENCH_SAMPLES);
+    TEST_ASSERT_NOT_NULL(UnityBench_LastResult());
+}
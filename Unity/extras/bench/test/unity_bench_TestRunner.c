@@ -0,0 +1,27 @@
+/* ==========================================
+ *  Unity Project - A Test Framework for C
+ *  Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+ *  [Released under MIT License. Please refer to license.txt for details]
+ * ========================================== */
+
+#include "unity.h"
+#include "unity_bench.h"
+
+extern void test_LoopRunsCalibratedIterationsForEverySample(void);
+extern void test_MinIterationsIsWhereCalibrationStarts(void);
+extern void test_StatisticsAreConsistent(void);
+extern void test_BeginClearsPreviousResult(void);
+extern void test_BenchMacroRunsBody(void);
+extern void test_BenchMacroRanBody(void);
+
+int main(void)
+{
+    UnityBegin("unity_bench_Test.c");
+    RUN_TEST(test_LoopRunsCalibratedIterationsForEverySample);
+    RUN_TEST(test_MinIterationsIsWhereCalibrationStarts);
+    RUN_TEST(test_StatisticsAreConsistent);
+    RUN_TEST(test_BeginClearsPreviousResult);
+    RUN_TEST(test_BenchMacroRunsBody);
+    RUN_TEST(test_BenchMacroRanBody);
+    return UnityEnd();
+}
@@ -72,7 +72,12 @@ void UnityTestRunner(unityfunction* setup,
                      const char* file,
                      unsigned int line)
 {
-    if (testSelected(name) && groupSelected(group))
+    if (testSelected(name) && groupSelected(group) && UnityFixture.ListOnly)
+    {
+        UnityPrint(printableName);
+        UNITY_PRINT_EOL();
+    }
+    else if (testSelected(name) && groupSelected(group))
     {
         Unity.TestFile = file;
         Unity.CurrentTestName = printableName;
@@ -117,7 +122,12 @@ void UnityTestRunner(unityfunction* setup,
 
 void UnityIgnoreTest(const char* printableName, const char* group, const char* name)
 {
-    if (testSelected(name) && groupSelected(group))
+    if (testSelected(name) && groupSelected(group) && UnityFixture.ListOnly)
+    {
+        UnityPrint(printableName);
+        UNITY_PRINT_EOL();
+    }
+    else if (testSelected(name) && groupSelected(group))
     {
         Unity.NumberOfTests++;
         Unity.TestIgnores++;
@@ -183,6 +193,7 @@ int UnityGetCommandLineOptions(int argc, const char* argv[])
     int i;
     UnityFixture.Verbose = 0;
     UnityFixture.Silent = 0;
+    UnityFixture.ListOnly = 0;
     UnityFixture.GroupFilter = 0;
     UnityFixture.NameFilter = 0;
     UnityFixture.RepeatCount = 1;
@@ -213,6 +224,8 @@ int UnityGetCommandLineOptions(int argc, const char* argv[])
             UNITY_PRINT_EOL();
             UnityPrint("  -r NUMBER   Repeatedly run all tests NUMBER times");
             UNITY_PRINT_EOL();
+            UnityPrint("  -l          List the selected tests, one per line, without running them");
+            UNITY_PRINT_EOL();
             UnityPrint("  -h, --help  Display this help message");
             UNITY_PRINT_EOL();
             UNITY_PRINT_EOL();
@@ -237,6 +250,11 @@ int UnityGetCommandLineOptions(int argc, const char* argv[])
             UnityFixture.Silent = 1;
             i++;
         }
+        else if (strcmp(argv[i], "-l") == 0)
+        {
+            UnityFixture.ListOnly = 1;
+            i++;
+        }
         else if (strcmp(argv[i], "-g") == 0)
         {
             i++;
@@ -17,6 +17,7 @@ struct UNITY_FIXTURE_T
 {
     int Verbose;
     int Silent;
+    int ListOnly;
     unsigned int RepeatCount;
     const char* NameFilter;
     const char* GroupFilter;
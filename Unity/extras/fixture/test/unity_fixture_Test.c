@@ -92,6 +92,7 @@ static int savedVerbose;
 static unsigned int savedRepeat;
 static const char* savedName;
 static const char* savedGroup;
+static int savedListOnly;
 
 TEST_SETUP(UnityCommandOptions)
 {
@@ -99,6 +100,7 @@ TEST_SETUP(UnityCommandOptions)
     savedRepeat = UnityFixture.RepeatCount;
     savedName = UnityFixture.NameFilter;
     savedGroup = UnityFixture.GroupFilter;
+    savedListOnly = UnityFixture.ListOnly;
 }
 
 TEST_TEAR_DOWN(UnityCommandOptions)
@@ -107,6 +109,7 @@ TEST_TEAR_DOWN(UnityCommandOptions)
     UnityFixture.RepeatCount= savedRepeat;
     UnityFixture.NameFilter = savedName;
     UnityFixture.GroupFilter = savedGroup;
+    UnityFixture.ListOnly = savedListOnly;
 }
 
 
@@ -118,6 +121,7 @@ TEST(UnityCommandOptions, DefaultOptions)
 {
     UnityGetCommandLineOptions(1, noOptions);
     TEST_ASSERT_EQUAL(0, UnityFixture.Verbose);
+    TEST_ASSERT_EQUAL(0, UnityFixture.ListOnly);
     TEST_ASSERT_POINTERS_EQUAL(0, UnityFixture.GroupFilter);
     TEST_ASSERT_POINTERS_EQUAL(0, UnityFixture.NameFilter);
     TEST_ASSERT_EQUAL(1, UnityFixture.RepeatCount);
@@ -134,6 +138,18 @@ TEST(UnityCommandOptions, OptionVerbose)
     TEST_ASSERT_EQUAL(1, UnityFixture.Verbose);
 }
 
+static const char* list[] = {
+        "testrunner.exe",
+        "-l", "-g", "groupname"
+};
+
+TEST(UnityCommandOptions, OptionListTests)
+{
+    TEST_ASSERT_EQUAL(0, UnityGetCommandLineOptions(4, list));
+    TEST_ASSERT_EQUAL(1, UnityFixture.ListOnly);
+    STRCMP_EQUAL("groupname", UnityFixture.GroupFilter);
+}
+
 static const char* group[] = {
         "testrunner.exe",
         "-g", "groupname"
@@ -0,0 +1,495 @@
+/* ==========================================
+ *  Unity Project - A Test Framework for C
+ *  Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+ *  [Released under MIT License. Please refer to license.txt for details]
+ * ========================================== */
+
+/* fork, pipe, poll, kill, clock_gettime and strsignal are POSIX */
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "unity.h"
+#include "unity_fork.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifdef UNITY_SKIP_DEFAULT_RUNNER
+#error "The fork add-on runs each test through UnityDefaultTestRun. Do not define RUN_TEST yourself."
+#endif
+
+/* How often a child that closed its output but has not exited yet is checked for */
+#define UNITY_FORK_REAP_POLL_MS 10
+
+/* Written by the child to the result pipe once the test has concluded. A child that dies before
+ * writing it crashed, timed out or called exit(). */
+typedef struct
+{
+    UNITY_COUNTER_TYPE Failures;
+    UNITY_COUNTER_TYPE Ignores;
+} UnityForkResult;
+
+typedef struct
+{
+    pid_t Pid;                  /* 0 if the slot is free */
+    int OutputFd;               /* Child's stdout and stderr. -1 once the child closed them */
+    int ResultFd;
+    const char* Name;
+    UNITY_LINE_TYPE Line;
+    UNITY_UINT StartMs;
+    char* Output;               /* Everything the child printed, replayed when it concludes */
+    size_t OutputLength;
+    size_t OutputSize;
+} UnityForkChild;
+
+static struct
+{
+    int Configured;
+    int Enabled;
+    int FailFast;
+    int RunNextInProcess;       /* Set in the child so UnityDefaultTestRun runs the test itself */
+    UNITY_UINT32 Jobs;
+    UNITY_UINT32 TimeoutMs;
+    UNITY_UINT32 Running;
+    UnityForkChild Children[UNITY_FORK_MAX_JOBS];
+} UnityFork;
+
+/*-----------------------------------------------*/
+static UNITY_UINT32 UnityForkEnvNumber(const char* name, UNITY_UINT32 fallback)
+{
+    const char* value = getenv(name);
+    char* end;
+    unsigned long number;
+
+    if ((value == NULL) || (*value == '\0'))
+    {
+        return fallback;
+    }
+    number = strtoul(value, &end, 10);
+    return (*end == '\0') ? (UNITY_UINT32)number : fallback;
+}
+
+/*-----------------------------------------------*/
+static void UnityForkConfigure(void)
+{
+    if (UnityFork.Configured)
+    {
+        return;
+    }
+    UnityFork.Configured = 1;
+    UnityFork.Enabled = (UnityForkEnvNumber("UNITY_FORK", 1u) != 0u);
+    UnityFork.FailFast = (UnityForkEnvNumber("UNITY_FORK_FAIL_FAST", 0u) != 0u);
+    UnityFork.TimeoutMs = UnityForkEnvNumber("UNITY_FORK_TIMEOUT_MS", UNITY_FORK_TIMEOUT_MS);
+    UnityFork_SetJobs(UnityForkEnvNumber("UNITY_FORK_JOBS", 1u));
+}
+
+/*-----------------------------------------------*/
+static UNITY_UINT UnityForkNowMs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((UNITY_UINT)now.tv_sec * 1000u) + ((UNITY_UINT)now.tv_nsec / 1000000u);
+}
+
+/*-----------------------------------------------*/
+static void UnityForkAppendOutput(UnityForkChild* child, const char* data, size_t length)
+{
+    if ((child->OutputLength + length) > child->OutputSize)
+    {
+        size_t size = (child->OutputSize == 0u) ? 256u : child->OutputSize;
+        char* grown;
+
+        while (size < (child->OutputLength + length))
+        {
+            size *= 2u;
+        }
+        grown = (char*)realloc(child->Output, size);
+        if (grown == NULL)
+        {
+            return; /* The output is lost, the result is still reported */
+        }
+        child->Output = grown;
+        child->OutputSize = size;
+    }
+    memcpy(&child->Output[child->OutputLength], data, length);
+    child->OutputLength += length;
+}
+
+/*-----------------------------------------------*/
+/* Reads everything the child has printed so far. Closes the pipe once the child closed its end. */
+static void UnityForkReadOutput(UnityForkChild* child)
+{
+    char chunk[512];
+    ssize_t length;
+
+    while (child->OutputFd >= 0)
+    {
+        length = read(child->OutputFd, chunk, sizeof(chunk));
+        if (length > 0)
+        {
+            UnityForkAppendOutput(child, chunk, (size_t)length);
+        }
+        else if ((length < 0) && (errno == EINTR))
+        {
+            continue;
+        }
+        else if ((length < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK)))
+        {
+            return;
+        }
+        else
+        {
+            (void)close(child->OutputFd);
+            child->OutputFd = -1;
+        }
+    }
+}
+
+/*-----------------------------------------------*/
+/* Fails the test in the parent with Unity's usual FAIL line, naming why the child died */
+static void UnityForkFailTest(const UnityForkChild* child, int status, int timed_out)
+{
+    static char msg[96];
+    const char* name = Unity.CurrentTestName;
+    const UNITY_LINE_TYPE line = Unity.CurrentTestLineNumber;
+#ifndef UNITY_EXCLUDE_SETJMP_H
+    jmp_buf abort_frame;
+
+    /* A test that runs another test in a child (i.e. this add-on's self-test) keeps its own frame */
+    memcpy(abort_frame, Unity.AbortFrame, sizeof(abort_frame));
+#endif
+
+    if (timed_out)
+    {
+        (void)snprintf(msg, sizeof(msg), "Test timed out after %lu ms", (unsigned long)UnityFork.TimeoutMs);
+    }
+    else if (WIFSIGNALED(status))
+    {
+        (void)snprintf(msg, sizeof(msg), "Test crashed with signal %d (%s)", WTERMSIG(status), strsignal(WTERMSIG(status)));
+    }
+    else
+    {
+        (void)snprintf(msg, sizeof(msg), "Test exited with status %d before it concluded", WEXITSTATUS(status));
+    }
+
+    /* A crash usually cuts the child's last line short */
+    if ((child->OutputLength > 0u) && (child->Output[child->OutputLength - 1u] != '\n'))
+    {
+        UNITY_PRINT_EOL();
+    }
+
+    Unity.CurrentTestName = child->Name;
+    Unity.CurrentTestLineNumber = child->Line;
+    if (TEST_PROTECT())
+    {
+        UnityFail(msg, child->Line);
+    }
+    UnityConcludeTest();
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line;
+#ifndef UNITY_EXCLUDE_SETJMP_H
+    memcpy(Unity.AbortFrame, abort_frame, sizeof(abort_frame));
+#endif
+}
+
+/*-----------------------------------------------*/
+/* Replays the output of a child that exited or was killed and adds its result to the totals */
+static void UnityForkConclude(UnityForkChild* child, int status, int timed_out)
+{
+    UnityForkResult result;
+    ssize_t result_length = -1;
+    size_t i;
+
+    UnityForkReadOutput(child);
+    if (child->OutputFd >= 0)
+    {
+        /* Only a process the test started itself can still hold the pipe open */
+        (void)close(child->OutputFd);
+        child->OutputFd = -1;
+    }
+    if (!timed_out)
+    {
+        result_length = read(child->ResultFd, &result, sizeof(result));
+    }
+    (void)close(child->ResultFd);
+
+    for (i = 0; i < child->OutputLength; i++)
+    {
+        UNITY_OUTPUT_CHAR(child->Output[i]);
+    }
+
+    Unity.NumberOfTests++;
+    if ((result_length == (ssize_t)sizeof(result)) && WIFEXITED(status) && (WEXITSTATUS(status) == 0))
+    {
+        Unity.TestFailures += result.Failures;
+        Unity.TestIgnores += result.Ignores;
+        UNITY_FLUSH_CALL();
+    }
+    else
+    {
+        UnityForkFailTest(child, status, timed_out);
+    }
+
+    free(child->Output);
+    memset(child, 0, sizeof(*child));
+    UnityFork.Running--;
+}
+
+/*-----------------------------------------------*/
+/* Collects output and reports children as they finish until fewer than limit are running */
+static void UnityForkWaitUntilBelow(UNITY_UINT32 limit)
+{
+    struct pollfd fds[UNITY_FORK_MAX_JOBS];
+    UnityForkChild* polled[UNITY_FORK_MAX_JOBS];
+    UnityForkChild* child;
+    nfds_t count;
+    UNITY_UINT elapsed;
+    UNITY_UINT now;
+    int timeout;
+    int status;
+    int i;
+
+    while (UnityFork.Running >= limit)
+    {
+        count = 0;
+        timeout = -1;
+        now = UnityForkNowMs();
+        for (i = 0; i < UNITY_FORK_MAX_JOBS; i++)
+        {
+            child = &UnityFork.Children[i];
+            if (child->Pid == 0)
+            {
+                continue;
+            }
+            if (child->OutputFd >= 0)
+            {
+                fds[count].fd = child->OutputFd;
+                fds[count].events = POLLIN;
+                fds[count].revents = 0;
+                polled[count++] = child;
+            }
+            else
+            {
+                timeout = UNITY_FORK_REAP_POLL_MS;
+            }
+            if (UnityFork.TimeoutMs != 0u)
+            {
+                elapsed = now - child->StartMs;
+                if (elapsed >= UnityFork.TimeoutMs)
+                {
+                    timeout = 0;
+                }
+                else if ((timeout < 0) || ((UnityFork.TimeoutMs - elapsed) < (UNITY_UINT)timeout))
+                {
+                    timeout = (int)(UnityFork.TimeoutMs - elapsed);
+                }
+            }
+        }
+
+        if (poll(fds, count, timeout) > 0)
+        {
+            for (i = 0; i < (int)count; i++)
+            {
+                if (fds[i].revents != 0)
+                {
+                    UnityForkReadOutput(polled[i]);
+                }
+            }
+        }
+
+        now = UnityForkNowMs();
+        for (i = 0; i < UNITY_FORK_MAX_JOBS; i++)
+        {
+            child = &UnityFork.Children[i];
+            if (child->Pid == 0)
+            {
+                continue;
+            }
+            if ((child->OutputFd < 0) && (waitpid(child->Pid, &status, WNOHANG) == child->Pid))
+            {
+                UnityForkConclude(child, status, 0);
+            }
+            else if ((UnityFork.TimeoutMs != 0u) && ((now - child->StartMs) >= UnityFork.TimeoutMs))
+            {
+                (void)kill(child->Pid, SIGKILL);
+                (void)waitpid(child->Pid, &status, 0);
+                UnityForkConclude(child, status, 1);
+            }
+        }
+    }
+}
+
+/*-----------------------------------------------*/
+/* Runs in the forked child. Never returns. */
+static void UnityForkRunChild(UnityTestFunction Func, const char* FuncName, const int FuncLineNum,
+                              int output_fd, int result_fd)
+{
+    const UNITY_COUNTER_TYPE failures = Unity.TestFailures;
+    const UNITY_COUNTER_TYPE ignores = Unity.TestIgnores;
+    UnityForkResult result;
+    int i;
+
+    /* Pipes of tests still running in the parent must only be held open by their own child */
+    for (i = 0; i < UNITY_FORK_MAX_JOBS; i++)
+    {
+        if (UnityFork.Children[i].Pid != 0)
+        {
+            (void)close(UnityFork.Children[i].OutputFd);
+            (void)close(UnityFork.Children[i].ResultFd);
+            UnityFork.Children[i].Pid = 0;
+        }
+    }
+    UnityFork.Running = 0;
+
+    (void)dup2(output_fd, STDOUT_FILENO);
+    (void)dup2(output_fd, STDERR_FILENO);
+    (void)close(output_fd);
+    /* What a test printed right before it crashed is kept, even without a newline */
+    (void)setvbuf(stdout, NULL, _IONBF, 0);
+
+    UnityFork.RunNextInProcess = 1;
+    UnityDefaultTestRun(Func, FuncName, FuncLineNum);
+    UNITY_FLUSH_CALL();
+    (void)fflush(stdout);
+    (void)fflush(stderr);
+
+    result.Failures = Unity.TestFailures - failures;
+    result.Ignores = Unity.TestIgnores - ignores;
+    _exit((write(result_fd, &result, sizeof(result)) == (ssize_t)sizeof(result)) ? 0 : 1);
+}
+
+/*-----------------------------------------------*/
+int UnityFork_TestRun(UnityTestFunction Func, const char* FuncName, const int FuncLineNum)
+{
+    int output_pipe[2];
+    int result_pipe[2];
+    UnityForkChild* child = NULL;
+    pid_t pid;
+    int i;
+
+    if (UnityFork.RunNextInProcess)
+    {
+        UnityFork.RunNextInProcess = 0;
+        return 0;
+    }
+
+    UnityForkConfigure();
+    if (UnityFork.FailFast && (Unity.TestFailures != 0u))
+    {
+        return 1;
+    }
+    if (!UnityFork.Enabled)
+    {
+        return 0;
+    }
+
+    UnityForkWaitUntilBelow(UnityFork.Jobs);
+    for (i = 0; (i < UNITY_FORK_MAX_JOBS) && (child == NULL); i++)
+    {
+        if (UnityFork.Children[i].Pid == 0)
+        {
+            child = &UnityFork.Children[i];
+        }
+    }
+
+    /* Anything still buffered would otherwise be printed by the child as well */
+    UNITY_FLUSH_CALL();
+    (void)fflush(stdout);
+    (void)fflush(stderr);
+
+    /* Without pipes or a child the test can still run, just not isolated */
+    if ((child == NULL) || (pipe(output_pipe) != 0))
+    {
+        return 0;
+    }
+    if (pipe(result_pipe) != 0)
+    {
+        (void)close(output_pipe[0]);
+        (void)close(output_pipe[1]);
+        return 0;
+    }
+    pid = fork();
+    if (pid < 0)
+    {
+        (void)close(output_pipe[0]);
+        (void)close(output_pipe[1]);
+        (void)close(result_pipe[0]);
+        (void)close(result_pipe[1]);
+        return 0;
+    }
+    if (pid == 0)
+    {
+        (void)close(output_pipe[0]);
+        (void)close(result_pipe[0]);
+        UnityForkRunChild(Func, FuncName, FuncLineNum, output_pipe[1], result_pipe[1]);
+    }
+
+    (void)close(output_pipe[1]);
+    (void)close(result_pipe[1]);
+    (void)fcntl(output_pipe[0], F_SETFL, fcntl(output_pipe[0], F_GETFL) | O_NONBLOCK);
+    (void)fcntl(result_pipe[0], F_SETFL, fcntl(result_pipe[0], F_GETFL) | O_NONBLOCK);
+
+    child->Pid = pid;
+    child->OutputFd = output_pipe[0];
+    child->ResultFd = result_pipe[0];
+    child->Name = FuncName;
+    child->Line = (UNITY_LINE_TYPE)FuncLineNum;
+    child->StartMs = UnityForkNowMs();
+    UnityFork.Running++;
+
+    /* One job at a time keeps the output in RUN_TEST order */
+    if (UnityFork.Jobs == 1u)
+    {
+        UnityForkWaitUntilBelow(1u);
+    }
+    return 1;
+}
+
+/*-----------------------------------------------*/
+void UnityFork_Finish(void)
+{
+    UnityForkWaitUntilBelow(1u);
+}
+
+/*-----------------------------------------------*/
+void UnityFork_SetEnabled(int enabled)
+{
+    UnityForkConfigure();
+    UnityFork.Enabled = enabled;
+}
+
+/*-----------------------------------------------*/
+void UnityFork_SetJobs(UNITY_UINT32 jobs)
+{
+    UnityForkConfigure();
+    if (jobs == 0u)
+    {
+        const long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        jobs = (cpus > 0) ? (UNITY_UINT32)cpus : 1u;
+    }
+    UnityFork.Jobs = (jobs > (UNITY_UINT32)UNITY_FORK_MAX_JOBS) ? (UNITY_UINT32)UNITY_FORK_MAX_JOBS : jobs;
+}
+
+/*-----------------------------------------------*/
+void UnityFork_SetTimeoutMs(UNITY_UINT32 timeout_ms)
+{
+    UnityForkConfigure();
+    UnityFork.TimeoutMs = timeout_ms;
+}
+
+/*-----------------------------------------------*/
+void UnityFork_SetFailFast(int enabled)
+{
+    UnityForkConfigure();
+    UnityFork.FailFast = enabled;
+}
@@ -0,0 +1,65 @@
+/* ==========================================
+ *  Unity Project - A Test Framework for C
+ *  Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+ *  [Released under MIT License. Please refer to license.txt for details]
+ * ========================================== */
+
+#ifndef UNITY_FORK_H_
+#define UNITY_FORK_H_
+
+#include "unity.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Build unity.c with UNITY_INCLUDE_FORK defined (POSIX hosts only) so every RUN_TEST runs in a
+ * child process. A test that crashes, calls exit() or runs past its timeout is reported as a
+ * FAIL of that test and the remaining tests still run. The child's output and result are sent
+ * back to the parent over pipes, so the summary printed by UnityEnd covers every test.
+ *
+ * Each setting can also be changed without rebuilding through an environment variable, read
+ * when the first test runs:
+ *
+ *     UNITY_FORK=0                  runs the tests in-process again
+ *     UNITY_FORK_JOBS=4             runs up to 4 tests at the same time
+ *     UNITY_FORK_TIMEOUT_MS=2000    kills a test after 2 seconds, 0 disables the timeout
+ *     UNITY_FORK_FAIL_FAST=1        skips the remaining tests after the first failure */
+
+/* Wall-clock milliseconds a test may run before its child is killed. 0 disables the timeout. */
+#ifndef UNITY_FORK_TIMEOUT_MS
+#define UNITY_FORK_TIMEOUT_MS 10000u
+#endif
+
+/* Upper bound on the number of tests running at the same time. */
+#ifndef UNITY_FORK_MAX_JOBS
+#define UNITY_FORK_MAX_JOBS 64
+#endif
+
+/* Runs Func in a child process, or skips it after a failure with fail-fast. Returns 0 if the
+ * test should run in-process instead. Called by UnityDefaultTestRun. With more than one job the
+ * test may still be running on return. */
+int UnityFork_TestRun(UnityTestFunction Func, const char* FuncName, const int FuncLineNum);
+
+/* Waits for every test still running and reports them. Called by UnityEnd. */
+void UnityFork_Finish(void);
+
+/* Disabled runs tests in-process, as if the add-on was not built in */
+void UnityFork_SetEnabled(int enabled);
+
+/* Number of tests running at the same time, 1 to UNITY_FORK_MAX_JOBS. Output of concurrent tests
+ * is printed one test at a time, in the order they finish. */
+void UnityFork_SetJobs(UNITY_UINT32 jobs);
+
+/* Timeout of each test in milliseconds. 0 disables the timeout. */
+void UnityFork_SetTimeoutMs(UNITY_UINT32 timeout_ms);
+
+/* Enabled skips (and does not count) every test after the first failure */
+void UnityFork_SetFailFast(int enabled);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UNITY_FORK_H_ */
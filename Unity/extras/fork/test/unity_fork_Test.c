@@ -0,0 +1,250 @@
+/* ==========================================
+ *  Unity Project - A Test Framework for C
+ *  Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+ *  [Released under MIT License. Please refer to license.txt for details]
+ * ========================================== */
+
+/* dup, dup2, fileno and usleep */
+#define _POSIX_C_SOURCE 200809L
+#define _DEFAULT_SOURCE
+
+#include "unity.h"
+#include "unity_fork.h"
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Every test below runs in its own child, so settings changed by a test do not outlive it. The
+ * tests run other tests in grandchildren and check what this child printed and counted. */
+
+static char captured[4096];
+static FILE* capture_file;
+static int saved_stdout;
+static UNITY_COUNTER_TYPE saved_tests;
+static UNITY_COUNTER_TYPE saved_failures;
+static UNITY_COUNTER_TYPE saved_ignores;
+static UNITY_COUNTER_TYPE ran;
+static UNITY_COUNTER_TYPE failed;
+static UNITY_COUNTER_TYPE ignored;
+static int touched_by_child;
+
+static void startCapture(void)
+{
+    saved_tests = Unity.NumberOfTests;
+    saved_failures = Unity.TestFailures;
+    saved_ignores = Unity.TestIgnores;
+    Unity.TestFailures = 0;
+
+    (void)fflush(stdout);
+    capture_file = tmpfile();
+    saved_stdout = dup(STDOUT_FILENO);
+    (void)dup2(fileno(capture_file), STDOUT_FILENO);
+}
+
+/* Waits for every grandchild, then restores this test's output and counters */
+static void stopCapture(void)
+{
+    size_t length;
+
+    UnityFork_Finish();
+    (void)fflush(stdout);
+    (void)dup2(saved_stdout, STDOUT_FILENO);
+    (void)close(saved_stdout);
+
+    rewind(capture_file);
+    length = fread(captured, 1, sizeof(captured) - 1, capture_file);
+    captured[length] = '\0';
+    (void)fclose(capture_file);
+
+    ran = Unity.NumberOfTests - saved_tests;
+    failed = Unity.TestFailures;
+    ignored = Unity.TestIgnores - saved_ignores;
+    Unity.NumberOfTests = saved_tests;
+    Unity.TestFailures = saved_failures;
+    Unity.TestIgnores = saved_ignores;
+}
+
+static void runIsolated(UnityTestFunction func, const char* name)
+{
+    startCapture();
+    (void)UnityFork_TestRun(func, name, 42);
+    stopCapture();
+}
+
+static int countOf(const char* text)
+{
+    int count = 0;
+    const char* found = strstr(captured, text);
+
+    while (found != NULL)
+    {
+        count++;
+        found = strstr(found + 1, text);
+    }
+    return count;
+}
+
+static void innerPass(void)
+{
+    TEST_ASSERT_TRUE(1);
+}
+
+static void innerFail(void)
+{
+    TEST_FAIL_MESSAGE("inner failure");
+}
+
+static void innerIgnore(void)
+{
+    TEST_IGNORE();
+}
+
+static void innerCrash(void)
+{
+    UnityPrint("partial line");
+    (void)raise(SIGSEGV);
+}
+
+static void innerHang(void)
+{
+    for (;;)
+    {
+    }
+}
+
+static void innerExit(void)
+{
+    exit(3);
+}
+
+static void innerTouch(void)
+{
+    touched_by_child = 1;
+}
+
+static void innerSleep(void)
+{
+    (void)usleep(50000);
+}
+
+/* The outer tests honour the UNITY_FORK_* environment, the tests they run do not */
+void setUp(void)
+{
+    UnityFork_SetEnabled(1);
+    UnityFork_SetJobs(1);
+    UnityFork_SetTimeoutMs(UNITY_FORK_TIMEOUT_MS);
+    UnityFork_SetFailFast(0);
+}
+
+void tearDown(void)
+{
+}
+
+void test_PassingTestIsCountedAndItsOutputReplayed(void)
+{
+    runIsolated(innerPass, "innerPass");
+
+    TEST_ASSERT_EQUAL_UINT(1, ran);
+    TEST_ASSERT_EQUAL_UINT(0, failed);
+    TEST_ASSERT_EQUAL_INT(1, countOf(":innerPass:PASS"));
+}
+
+void test_FailingAssertionIsCountedByTheParent(void)
+{
+    runIsolated(innerFail, "innerFail");
+
+    TEST_ASSERT_EQUAL_UINT(1, ran);
+    TEST_ASSERT_EQUAL_UINT(1, failed);
+    TEST_ASSERT_EQUAL_INT(1, countOf(":innerFail:FAIL: inner failure"));
+}
+
+void test_IgnoredTestIsCountedByTheParent(void)
+{
+    runIsolated(innerIgnore, "innerIgnore");
+
+    TEST_ASSERT_EQUAL_UINT(1, ran);
+    TEST_ASSERT_EQUAL_UINT(0, failed);
+    TEST_ASSERT_EQUAL_UINT(1, ignored);
+}
+
+void test_CrashIsReportedAsFailureOfThatTest(void)
+{
+    runIsolated(innerCrash, "innerCrash");
+
+    TEST_ASSERT_EQUAL_UINT(1, ran);
+    TEST_ASSERT_EQUAL_UINT(1, failed);
+    TEST_ASSERT_EQUAL_INT(1, countOf("partial line\n"));
+    TEST_ASSERT_EQUAL_INT(1, countOf(":42:innerCrash:FAIL: Test crashed with signal 11"));
+}
+
+void test_HangIsKilledAfterTheTimeout(void)
+{
+    UnityFork_SetTimeoutMs(100);
+
+    runIsolated(innerHang, "innerHang");
+
+    TEST_ASSERT_EQUAL_UINT(1, ran);
+    TEST_ASSERT_EQUAL_UINT(1, failed);
+    TEST_ASSERT_EQUAL_INT(1, countOf(":innerHang:FAIL: Test timed out after 100 ms"));
+}
+
+void test_ExitBeforeConcludingIsReportedAsFailure(void)
+{
+    runIsolated(innerExit, "innerExit");
+
+    TEST_ASSERT_EQUAL_UINT(1, ran);
+    TEST_ASSERT_EQUAL_UINT(1, failed);
+    TEST_ASSERT_EQUAL_INT(1, countOf(":innerExit:FAIL: Test exited with status 3 before it concluded"));
+}
+
+void test_ChildStateDoesNotLeakIntoTheParent(void)
+{
+    touched_by_child = 0;
+
+    runIsolated(innerTouch, "innerTouch");
+
+    TEST_ASSERT_EQUAL_UINT(1, ran);
+    TEST_ASSERT_EQUAL_INT(0, touched_by_child);
+}
+
+void test_FailFastSkipsTestsAfterTheFirstFailure(void)
+{
+    UnityFork_SetFailFast(1);
+
+    startCapture();
+    (void)UnityFork_TestRun(innerFail, "innerFail", 42);
+    (void)UnityFork_TestRun(innerPass, "innerPass", 42);
+    stopCapture();
+
+    TEST_ASSERT_EQUAL_UINT(1, ran);
+    TEST_ASSERT_EQUAL_UINT(1, failed);
+    TEST_ASSERT_EQUAL_INT(0, countOf(":innerPass:PASS"));
+}
+
+void test_ConcurrentJobsAreAllReported(void)
+{
+    int i;
+
+    UnityFork_SetJobs(4);
+
+    startCapture();
+    for (i = 0; i < 4; i++)
+    {
+        (void)UnityFork_TestRun(innerSleep, "innerSleep", 42);
+    }
+    (void)UnityFork_TestRun(innerFail, "innerFail", 42);
+    stopCapture();
+
+    TEST_ASSERT_EQUAL_UINT(5, ran);
+    TEST_ASSERT_EQUAL_UINT(1, failed);
+    TEST_ASSERT_EQUAL_INT(4, countOf(":innerSleep:PASS\n"));
+}
+
+void test_DisabledLeavesTheTestToRunInProcess(void)
+{
+    UnityFork_SetEnabled(0);
+
+    TEST_ASSERT_EQUAL_INT(0, UnityFork_TestRun(innerPass, "innerPass", 42));
+}
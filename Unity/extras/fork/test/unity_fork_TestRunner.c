@@ -0,0 +1,35 @@
+/* ==========================================
+ *  Unity Project - A Test Framework for C
+ *  Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+ *  [Released under MIT License. Please refer to license.txt for details]
+ * ========================================== */
+
+#include "unity.h"
+#include "unity_fork.h"
+
+extern void test_PassingTestIsCountedAndItsOutputReplayed(void);
+extern void test_FailingAssertionIsCountedByTheParent(void);
+extern void test_IgnoredTestIsCountedByTheParent(void);
+extern void test_CrashIsReportedAsFailureOfThatTest(void);
+extern void test_HangIsKilledAfterTheTimeout(void);
+extern void test_ExitBeforeConcludingIsReportedAsFailure(void);
+extern void test_ChildStateDoesNotLeakIntoTheParent(void);
+extern void test_FailFastSkipsTestsAfterTheFirstFailure(void);
+extern void test_ConcurrentJobsAreAllReported(void);
+extern void test_DisabledLeavesTheTestToRunInProcess(void);
+
+int main(void)
+{
+    UnityBegin("unity_fork_Test.c");
+    RUN_TEST(test_PassingTestIsCountedAndItsOutputReplayed);
+    RUN_TEST(test_FailingAssertionIsCountedByTheParent);
+    RUN_TEST(test_IgnoredTestIsCountedByTheParent);
+    RUN_TEST(test_CrashIsReportedAsFailureOfThatTest);
+    RUN_TEST(test_HangIsKilledAfterTheTimeout);
+    RUN_TEST(test_ExitBeforeConcludingIsReportedAsFailure);
+    RUN_TEST(test_ChildStateDoesNotLeakIntoTheParent);
+    RUN_TEST(test_FailFastSkipsTestsAfterTheFirstFailure);
+    RUN_TEST(test_ConcurrentJobsAreAllReported);
+    RUN_TEST(test_DisabledLeavesTheTestToRunInProcess);
+    return UnityEnd();
+}
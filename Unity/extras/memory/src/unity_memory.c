@@ -11,11 +11,56 @@
 #define MALLOC_DONT_FAIL -1
 static int malloc_count;
 static int malloc_fail_countdown = MALLOC_DONT_FAIL;
+static size_t current_bytes;
+static size_t peak_bytes;
+
+/* These definitions are always included from unity_fixture_malloc_overrides.h */
+/* We undef to use them or avoid conflict with <stdlib.h> per the C standard */
+#undef malloc
+#undef free
+#undef calloc
+#undef realloc
+
+#ifdef UNITY_EXCLUDE_STDLIB_MALLOC
+static unsigned char unity_heap[UNITY_INTERNAL_HEAP_SIZE_BYTES];
+static size_t heap_index;
+static size_t heap_high_water;
+#else
+#include <stdlib.h>
+#endif
+
+typedef struct GuardBytes
+{
+    size_t size;
+    size_t guard_space; /* Must stay last: it is the word right in front of the user's memory */
+} Guard;
+
+#define UNITY_MALLOC_ALIGNMENT (UNITY_POINTER_WIDTH / 8)
+#define UNITY_MEMORY_GUARD_WORD (((size_t)~(size_t)0 / 0xFFu) * 0xA5u)
+static const char end[] = "END";
+
+#ifdef UNITY_EXCLUDE_STDLIB_MALLOC
+/* Freed blocks that are not at the end of unity_heap are kept on a free list per size class
+ * (block size / UNITY_MALLOC_ALIGNMENT) and handed out again to the next request of the same
+ * class, so alloc/free churn of the same sizes is O(1) and never runs out of heap. Blocks
+ * larger than the biggest class share the last list. The link lives in the freed block. */
+typedef struct FreeBlock
+{
+    struct FreeBlock* next;
+} FreeBlock;
+
+static FreeBlock* free_lists[UNITY_MEMORY_SIZE_CLASSES + 1];
+#endif
 
 void UnityMalloc_StartTest(void)
 {
     malloc_count = 0;
     malloc_fail_countdown = MALLOC_DONT_FAIL;
+    current_bytes = 0;
+    peak_bytes = 0;
+#ifdef UNITY_EXCLUDE_STDLIB_MALLOC
+    heap_high_water = heap_index;
+#endif
 }
 
 void UnityMalloc_EndTest(void)
@@ -32,28 +77,24 @@ void UnityMalloc_MakeMallocFailAfterCount(int countdown)
     malloc_fail_countdown = countdown;
 }
 
-/* These definitions are always included from unity_fixture_malloc_overrides.h */
-/* We undef to use them or avoid conflict with <stdlib.h> per the C standard */
-#undef malloc
-#undef free
-#undef calloc
-#undef realloc
+size_t UnityMalloc_CurrentUsage(void)
+{
+    return current_bytes;
+}
 
+size_t UnityMalloc_PeakUsage(void)
+{
+    return peak_bytes;
+}
+
+size_t UnityMalloc_HeapHighWater(void)
+{
 #ifdef UNITY_EXCLUDE_STDLIB_MALLOC
-static unsigned char unity_heap[UNITY_INTERNAL_HEAP_SIZE_BYTES];
-static size_t heap_index;
+    return heap_high_water;
 #else
-#include <stdlib.h>
+    return 0;
 #endif
-
-typedef struct GuardBytes
-{
-    size_t size;
-    size_t guard_space;
-} Guard;
-
-#define UNITY_MALLOC_ALIGNMENT (UNITY_POINTER_WIDTH / 8)
-static const char end[] = "END";
+}
 
 static size_t unity_size_round_up(size_t size)
 {
@@ -64,53 +105,103 @@ static size_t unity_size_round_up(size_t size)
     return rounded_size;
 }
 
-void* unity_malloc(size_t size)
+#ifdef UNITY_EXCLUDE_STDLIB_MALLOC
+static size_t size_class(size_t block_size)
 {
-    char* mem;
-    Guard* guard;
-    size_t total_size;
+    size_t index = block_size / UNITY_MALLOC_ALIGNMENT;
 
-    total_size = sizeof(Guard) + unity_size_round_up(size + sizeof(end));
+    return (index < UNITY_MEMORY_SIZE_CLASSES) ? index : UNITY_MEMORY_SIZE_CLASSES;
+}
 
-    if (malloc_fail_countdown != MALLOC_DONT_FAIL)
-    {
-        if (malloc_fail_countdown == 0)
-            return NULL;
-        malloc_fail_countdown--;
-    }
+/* Pops a freed block whose size matches block_size exactly, or returns NULL */
+static Guard* take_free_block(size_t block_size)
+{
+    FreeBlock** link = &free_lists[size_class(block_size)];
 
-    if (size == 0) return NULL;
-#ifdef UNITY_EXCLUDE_STDLIB_MALLOC
-    if (heap_index + total_size > UNITY_INTERNAL_HEAP_SIZE_BYTES)
+    while (*link != NULL)
     {
-        guard = NULL;
+        Guard* guard = (Guard*)(void*)(*link) - 1;
+
+        if (unity_size_round_up(guard->size + sizeof(end)) == block_size)
+        {
+            *link = (*link)->next;
+            return guard;
+        }
+        link = &(*link)->next; /* Only the shared list of large blocks can hold other sizes */
     }
-    else
+    return NULL;
+}
+
+static Guard* heap_alloc(size_t block_size)
+{
+    Guard* guard = take_free_block(block_size);
+
+    if ((guard == NULL) && (heap_index + sizeof(Guard) + block_size <= UNITY_INTERNAL_HEAP_SIZE_BYTES))
     {
         /* We know we can get away with this cast because we aligned memory already */
         guard = (Guard*)(void*)(&unity_heap[heap_index]);
-        heap_index += total_size;
+        heap_index += sizeof(Guard) + block_size;
+        if (heap_index > heap_high_water)
+        {
+            heap_high_water = heap_index;
+        }
     }
-#else
-    guard = (Guard*)UNITY_MALLOC(total_size);
+    return guard;
+}
+
+static int is_last_block(void* mem, size_t block_size)
+{
+    return (unsigned char*)mem == unity_heap + heap_index - block_size;
+}
 #endif
-    if (guard == NULL) return NULL;
+
+static void* track_block(Guard* guard, size_t size)
+{
+    char* mem;
+
     malloc_count++;
+    current_bytes += size;
+    if (current_bytes > peak_bytes)
+    {
+        peak_bytes = current_bytes;
+    }
     guard->size = size;
-    guard->guard_space = 0;
+    guard->guard_space = UNITY_MEMORY_GUARD_WORD;
     mem = (char*)&(guard[1]);
     memcpy(&mem[size], end, sizeof(end));
 
     return (void*)mem;
 }
 
+void* unity_malloc(size_t size)
+{
+    Guard* guard;
+
+    if (malloc_fail_countdown != MALLOC_DONT_FAIL)
+    {
+        if (malloc_fail_countdown == 0)
+            return NULL;
+        malloc_fail_countdown--;
+    }
+
+    if (size == 0) return NULL;
+#ifdef UNITY_EXCLUDE_STDLIB_MALLOC
+    guard = heap_alloc(unity_size_round_up(size + sizeof(end)));
+#else
+    guard = (Guard*)UNITY_MALLOC(sizeof(Guard) + unity_size_round_up(size + sizeof(end)));
+#endif
+    if (guard == NULL) return NULL;
+
+    return track_block(guard, size);
+}
+
 static int isOverrun(void* mem)
 {
     Guard* guard = (Guard*)mem;
     char* memAsChar = (char*)mem;
     guard--;
 
-    return guard->guard_space != 0 || strcmp(&memAsChar[guard->size], end) != 0;
+    return guard->guard_space != UNITY_MEMORY_GUARD_WORD || strcmp(&memAsChar[guard->size], end) != 0;
 }
 
 static void release_memory(void* mem)
@@ -119,16 +210,25 @@ static void release_memory(void* mem)
     guard--;
 
     malloc_count--;
+    current_bytes -= guard->size;
 #ifdef UNITY_EXCLUDE_STDLIB_MALLOC
     {
         size_t block_size;
 
         block_size = unity_size_round_up(guard->size + sizeof(end));
 
-        if (mem == unity_heap + heap_index - block_size)
+        if (is_last_block(mem, block_size))
         {
             heap_index -= (sizeof(Guard) + block_size);
         }
+        else
+        {
+            FreeBlock* block = (FreeBlock*)mem;
+            size_t index = size_class(block_size);
+
+            block->next = free_lists[index];
+            free_lists[index] = block;
+        }
     }
 #else
     UNITY_FREE(guard);
@@ -185,12 +285,26 @@ void* unity_realloc(void* oldMem, size_t size)
 #ifdef UNITY_EXCLUDE_STDLIB_MALLOC /* Optimization if memory is expandable */
     {
         size_t old_total_size = unity_size_round_up(guard->size + sizeof(end));
+        size_t new_total_size = unity_size_round_up(size + sizeof(end));
 
-        if ((oldMem == unity_heap + heap_index - old_total_size) &&
-            ((heap_index - old_total_size + unity_size_round_up(size + sizeof(end))) <= UNITY_INTERNAL_HEAP_SIZE_BYTES))
+        if (is_last_block(oldMem, old_total_size) &&
+            ((heap_index - old_total_size + new_total_size) <= UNITY_INTERNAL_HEAP_SIZE_BYTES))
         {
-            release_memory(oldMem);    /* Not thread-safe, like unity_heap generally */
-            return unity_malloc(size); /* No memcpy since data is in place */
+            if (malloc_fail_countdown != MALLOC_DONT_FAIL)
+            {
+                if (malloc_fail_countdown == 0)
+                    return NULL;
+                malloc_fail_countdown--;
+            }
+            /* Not thread-safe, like unity_heap generally. No memcpy since data is in place */
+            malloc_count--;
+            current_bytes -= guard->size;
+            heap_index += new_total_size - old_total_size;
+            if (heap_index > heap_high_water)
+            {
+                heap_high_water = heap_index;
+            }
+            return track_block(guard, size);
         }
     }
 #endif
@@ -18,11 +18,17 @@ extern "C"
 /* Define this macro to remove the use of stdlib.h, malloc, and free.
  * Many embedded systems do not have a heap or malloc/free by default.
  * This internal unity_malloc() provides allocated memory deterministically from
- * the end of an array only, unity_free() only releases from end-of-array,
- * blocks are not coalesced, and memory not freed in LIFO order is stranded. */
+ * the end of an array. unity_free() gives the end-of-array block back to the array
+ * and keeps any other block on a free list for its size class, where the next
+ * request of that size finds it in O(1). Blocks are not split or coalesced. */
     #ifndef UNITY_INTERNAL_HEAP_SIZE_BYTES
     #define UNITY_INTERNAL_HEAP_SIZE_BYTES 256
     #endif
+/* Number of size classes, one per UNITY_POINTER_WIDTH / 8 bytes of block size.
+ * Larger freed blocks share one list that is searched for an exact fit. */
+    #ifndef UNITY_MEMORY_SIZE_CLASSES
+    #define UNITY_MEMORY_SIZE_CLASSES 32
+    #endif
 #endif
 
 /* These functions are used by Unity to allocate and release memory
@@ -53,6 +59,13 @@ void UnityMalloc_StartTest(void);
 void UnityMalloc_EndTest(void);
 void UnityMalloc_MakeMallocFailAfterCount(int countdown);
 
+/* Memory usage since UnityMalloc_StartTest(), i.e. to size UNITY_INTERNAL_HEAP_SIZE_BYTES.
+ * Current and peak usage count the bytes requested by the test. The high water mark is how
+ * far into the internal heap blocks and their headers reached (0 with stdlib malloc). */
+size_t UnityMalloc_CurrentUsage(void);
+size_t UnityMalloc_PeakUsage(void);
+size_t UnityMalloc_HeapHighWater(void);
+
 #ifdef __cplusplus
 }
 #endif
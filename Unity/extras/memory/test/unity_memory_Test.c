@@ -29,6 +29,10 @@ void test_MallocPastBufferFails(void);
 void test_CallocPastBufferFails(void);
 void test_MallocThenReallocGrowsMemoryInPlace(void);
 void test_ReallocFailDoesNotFreeMem(void);
+void test_FreedBlockIsReusedForSameSize(void);
+void test_AllocFreeChurnDoesNotExhaustHeap(void);
+void test_PeakUsageIsLargestLiveBytes(void);
+void test_HeapHighWaterIncludesHeaders(void);
 
 /* It makes use of the following features */
 void setUp(void);
@@ -323,3 +327,75 @@ void test_ReallocFailDoesNotFreeMem(void)
     TEST_IGNORE_MESSAGE("Enable UNITY_EXCLUDE_STDLIB_MALLOC to Run This Test");
 #endif
 }
+
+/*------------------------------------------------------------ */
+
+void test_FreedBlockIsReusedForSameSize(void)
+{
+#ifdef UNITY_EXCLUDE_STDLIB_MALLOC
+    void* m = malloc(10);
+    void* n = malloc(30);
+    void* o;
+    free(m); /* Not the last block, so it is kept on a free list */
+    o = malloc(12); /* Same size class as 10 */
+    TEST_ASSERT_NOT_NULL(m);
+    TEST_ASSERT_NOT_NULL(n);
+    TEST_ASSERT_EQUAL_PTR(m, o);
+    free(n);
+    free(o);
+    TEST_ASSERT_MEMORY_ALL_FREE_LIFO_ORDER(m, n);
+#else
+    TEST_IGNORE_MESSAGE("Enable UNITY_EXCLUDE_STDLIB_MALLOC to Run This Test");
+#endif
+}
+
+void test_AllocFreeChurnDoesNotExhaustHeap(void)
+{
+    void* pinned = malloc(8);
+    void* a = NULL;
+    void* b = NULL;
+    int i;
+
+    TEST_ASSERT_NOT_NULL(pinned);
+    for (i = 0; i < 1000; i++)
+    {
+        a = malloc(10);
+        b = malloc(40);
+        TEST_ASSERT_NOT_NULL(a);
+        TEST_ASSERT_NOT_NULL(b);
+        free(a); /* Not in LIFO order */
+        free(b);
+    }
+    free(pinned);
+}
+
+void test_PeakUsageIsLargestLiveBytes(void)
+{
+    void* m = malloc(10);
+    void* n = malloc(20);
+    void* o;
+    TEST_ASSERT_EQUAL_UINT(30, UnityMalloc_CurrentUsage());
+    free(n);
+    o = malloc(5);
+    TEST_ASSERT_EQUAL_UINT(15, UnityMalloc_CurrentUsage());
+    TEST_ASSERT_EQUAL_UINT(30, UnityMalloc_PeakUsage());
+    free(o);
+    free(m);
+    TEST_ASSERT_EQUAL_UINT(0, UnityMalloc_CurrentUsage());
+    TEST_ASSERT_EQUAL_UINT(30, UnityMalloc_PeakUsage());
+}
+
+void test_HeapHighWaterIncludesHeaders(void)
+{
+#ifdef UNITY_EXCLUDE_STDLIB_MALLOC
+    size_t start = UnityMalloc_HeapHighWater();
+    void* m = malloc(10);
+    free(m);
+    TEST_ASSERT_GREATER_THAN_UINT(start + 10, UnityMalloc_HeapHighWater());
+    m = malloc(1);
+    free(m);
+    TEST_ASSERT_GREATER_THAN_UINT(start + 10, UnityMalloc_HeapHighWater());
+#else
+    TEST_ASSERT_EQUAL_UINT(0, UnityMalloc_HeapHighWater());
+#endif
+}
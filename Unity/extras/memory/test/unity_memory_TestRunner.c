@@ -24,6 +24,10 @@ extern void test_MallocPastBufferFails(void);
 extern void test_CallocPastBufferFails(void);
 extern void test_MallocThenReallocGrowsMemoryInPlace(void);
 extern void test_ReallocFailDoesNotFreeMem(void);
+extern void test_FreedBlockIsReusedForSameSize(void);
+extern void test_AllocFreeChurnDoesNotExhaustHeap(void);
+extern void test_PeakUsageIsLargestLiveBytes(void);
+extern void test_HeapHighWaterIncludesHeaders(void);
 
 int main(void)
 {
@@ -45,5 +49,9 @@ int main(void)
     RUN_TEST(test_CallocPastBufferFails);
     RUN_TEST(test_MallocThenReallocGrowsMemoryInPlace);
     RUN_TEST(test_ReallocFailDoesNotFreeMem);
+    RUN_TEST(test_FreedBlockIsReusedForSameSize);
+    RUN_TEST(test_AllocFreeChurnDoesNotExhaustHeap);
+    RUN_TEST(test_PeakUsageIsLargestLiveBytes);
+    RUN_TEST(test_HeapHighWaterIncludesHeaders);
     return UnityEnd();
 }
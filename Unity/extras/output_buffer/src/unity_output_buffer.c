@@ -0,0 +1,98 @@
+/* ==========================================
+ *  Unity Project - A Test Framework for C
+ *  Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+ *  [Released under MIT License. Please refer to license.txt for details]
+ * ========================================== */
+
+#include "unity.h"
+#include "unity_output_buffer.h"
+#include <string.h>
+
+#ifdef UNITY_OUTPUT_BUFFER_DEFAULT_WRITE
+#include <stdio.h>
+#endif
+
+static struct
+{
+    UnityOutputBufferWriter Writer;     /* NULL uses UNITY_OUTPUT_BUFFER_WRITE */
+    UNITY_UINT32 Length;
+    char Data[UNITY_OUTPUT_BUFFER_SIZE];
+} UnityOutputBuffer;
+
+/*-----------------------------------------------*/
+#ifdef UNITY_OUTPUT_BUFFER_DEFAULT_WRITE
+void UnityOutputBuffer_DefaultWrite(const char* data, UNITY_UINT32 length)
+{
+    (void)fwrite(data, 1, (size_t)length, stdout);
+#ifdef UNITY_USE_FLUSH_STDOUT
+    (void)fflush(stdout);
+#endif
+}
+#endif
+
+/*-----------------------------------------------*/
+void UnityOutputBuffer_Char(int c)
+{
+    UnityOutputBuffer.Data[UnityOutputBuffer.Length++] = (char)c;
+
+    if ((c == '\n') || (UnityOutputBuffer.Length >= (UNITY_UINT32)UNITY_OUTPUT_BUFFER_SIZE))
+    {
+        UnityOutputBuffer_Flush();
+    }
+}
+
+/*-----------------------------------------------*/
+void UnityOutputBuffer_Write(const char* data, UNITY_UINT32 length)
+{
+    UNITY_UINT32 chunk;
+
+    while (length > 0u)
+    {
+        chunk = (UNITY_UINT32)UNITY_OUTPUT_BUFFER_SIZE - UnityOutputBuffer.Length;
+        if (chunk > length)
+        {
+            chunk = length;
+        }
+        memcpy(&UnityOutputBuffer.Data[UnityOutputBuffer.Length], data, (size_t)chunk);
+        UnityOutputBuffer.Length += chunk;
+        data += chunk;
+        length -= chunk;
+
+        if (UnityOutputBuffer.Length >= (UNITY_UINT32)UNITY_OUTPUT_BUFFER_SIZE)
+        {
+            UnityOutputBuffer_Flush();
+        }
+    }
+}
+
+/*-----------------------------------------------*/
+void UnityOutputBuffer_Flush(void)
+{
+    if (UnityOutputBuffer.Length == 0u)
+    {
+        return;
+    }
+
+    if (UnityOutputBuffer.Writer != NULL)
+    {
+        UnityOutputBuffer.Writer(UnityOutputBuffer.Data, UnityOutputBuffer.Length);
+    }
+    else
+    {
+        UNITY_OUTPUT_BUFFER_WRITE(UnityOutputBuffer.Data, UnityOutputBuffer.Length);
+    }
+    UnityOutputBuffer.Length = 0u;
+}
+
+/*-----------------------------------------------*/
+void UnityOutputBuffer_SetWriter(UnityOutputBufferWriter writer)
+{
+    UnityOutputBuffer_Flush();
+    UnityOutputBuffer.Writer = writer;
+}
+
+/*-----------------------------------------------*/
+UNITY_UINT32 UnityOutputBuffer_Pending(void)
+{
+    return UnityOutputBuffer.Length;
+}
@@ -0,0 +1,63 @@
+/* ==========================================
+ *  Unity Project - A Test Framework for C
+ *  Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+ *  [Released under MIT License. Please refer to license.txt for details]
+ * ========================================== */
+
+#ifndef UNITY_OUTPUT_BUFFER_H_
+#define UNITY_OUTPUT_BUFFER_H_
+
+#include "unity.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Build unity.c and every test with UNITY_INCLUDE_OUTPUT_BUFFER defined. UNITY_OUTPUT_CHAR and
+ * UNITY_OUTPUT_FLUSH are then routed through a static buffer that is written out in bulk:
+ * on every newline, whenever the buffer fills up and when Unity flushes (after each test and in
+ * UnityEnd). */
+
+/* Size of the static buffer in bytes. Lines longer than this are written in several pieces. */
+#ifndef UNITY_OUTPUT_BUFFER_SIZE
+#define UNITY_OUTPUT_BUFFER_SIZE 256
+#endif
+
+/* Compile-time bulk writer. Defaults to fwrite() on stdout. Targets with a slow transport
+ * (UART, semihosting, SWO) define this to a function taking (const char* data, UNITY_UINT32 length)
+ * and declare it with UNITY_OUTPUT_BUFFER_WRITE_HEADER_DECLARATION. */
+#ifndef UNITY_OUTPUT_BUFFER_WRITE
+#define UNITY_OUTPUT_BUFFER_DEFAULT_WRITE
+#define UNITY_OUTPUT_BUFFER_WRITE(data, length) UnityOutputBuffer_DefaultWrite(data, length)
+void UnityOutputBuffer_DefaultWrite(const char* data, UNITY_UINT32 length);
+#else
+  #ifdef UNITY_OUTPUT_BUFFER_WRITE_HEADER_DECLARATION
+    extern void UNITY_OUTPUT_BUFFER_WRITE_HEADER_DECLARATION;
+  #endif
+#endif
+
+typedef void (*UnityOutputBufferWriter)(const char* data, UNITY_UINT32 length);
+
+/* Buffers a single character. Called through UNITY_OUTPUT_CHAR. */
+void UnityOutputBuffer_Char(int c);
+
+/* Buffers several characters at once, flushing whenever the buffer fills up. Newlines are not
+ * looked for, they are written with the next newline or flush. Called through UNITY_OUTPUT_CHARS. */
+void UnityOutputBuffer_Write(const char* data, UNITY_UINT32 length);
+
+/* Writes everything buffered so far. Called through UNITY_OUTPUT_FLUSH. */
+void UnityOutputBuffer_Flush(void);
+
+/* Replaces the bulk writer at run time, i.e. once a transport has been opened. Pending output is
+ * flushed to the previous writer first. NULL restores UNITY_OUTPUT_BUFFER_WRITE. */
+void UnityOutputBuffer_SetWriter(UnityOutputBufferWriter writer);
+
+/* Number of characters waiting to be written */
+UNITY_UINT32 UnityOutputBuffer_Pending(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UNITY_OUTPUT_BUFFER_H_ */
@@ -0,0 +1,151 @@
+/* ==========================================
+ *  Unity Project - A Test Framework for C
+ *  Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+ *  [Released under MIT License. Please refer to license.txt for details]
+ * ========================================== */
+
+#include "unity.h"
+#include "unity_output_buffer.h"
+#include <string.h>
+
+#define SPY_MAX_WRITES 8
+
+static char spy_data[SPY_MAX_WRITES * UNITY_OUTPUT_BUFFER_SIZE];
+static UNITY_UINT32 spy_length;
+static UNITY_UINT32 spy_writes;
+static UNITY_UINT32 spy_write_lengths[SPY_MAX_WRITES];
+static UNITY_UINT32 other_spy_writes;
+
+static void writeSpy(const char* data, UNITY_UINT32 length)
+{
+    if (spy_writes < SPY_MAX_WRITES)
+    {
+        memcpy(&spy_data[spy_length], data, length);
+        spy_length += length;
+        spy_write_lengths[spy_writes] = length;
+    }
+    spy_writes++;
+}
+
+static void otherWriteSpy(const char* data, UNITY_UINT32 length)
+{
+    (void)data;
+    (void)length;
+    other_spy_writes++;
+}
+
+/* Failures are printed through the buffer too, so every test stops spying before it asserts */
+static void stopSpying(void)
+{
+    UnityOutputBuffer_SetWriter(NULL);
+}
+
+void setUp(void)
+{
+    memset(spy_data, 0, sizeof(spy_data));
+    spy_length = 0;
+    spy_writes = 0;
+    other_spy_writes = 0;
+    UnityOutputBuffer_SetWriter(writeSpy);
+}
+
+void tearDown(void)
+{
+    stopSpying();
+}
+
+void test_CharactersAreHeldUntilNewline(void)
+{
+    UNITY_UINT32 writes_before_newline;
+    UNITY_UINT32 pending_before_newline;
+
+    UnityPrint("abc");
+    writes_before_newline = spy_writes;
+    pending_before_newline = UnityOutputBuffer_Pending();
+    UNITY_OUTPUT_CHAR('\n');
+    stopSpying();
+
+    TEST_ASSERT_EQUAL_UINT32(0, writes_before_newline);
+    TEST_ASSERT_EQUAL_UINT32(3, pending_before_newline);
+    TEST_ASSERT_EQUAL_UINT32(1, spy_writes);
+    TEST_ASSERT_EQUAL_STRING("abc\n", spy_data);
+}
+
+void test_FullBufferIsWrittenWithoutNewline(void)
+{
+    UNITY_UINT32 i;
+    UNITY_UINT32 pending;
+
+    for (i = 0; i < (UNITY_OUTPUT_BUFFER_SIZE + 1); i++)
+    {
+        UNITY_OUTPUT_CHAR('x');
+    }
+    pending = UnityOutputBuffer_Pending();
+    stopSpying();
+
+    TEST_ASSERT_EQUAL_UINT32(1, pending);
+    TEST_ASSERT_EQUAL_UINT32(2, spy_writes);
+    TEST_ASSERT_EQUAL_UINT32(UNITY_OUTPUT_BUFFER_SIZE, spy_write_lengths[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, spy_write_lengths[1]);
+}
+
+void test_FlushWritesPartialLine(void)
+{
+    UnityPrint("partial");
+    UNITY_OUTPUT_FLUSH();
+    stopSpying();
+
+    TEST_ASSERT_EQUAL_UINT32(1, spy_writes);
+    TEST_ASSERT_EQUAL_STRING("partial", spy_data);
+}
+
+void test_FlushWithNothingPendingDoesNotWrite(void)
+{
+    UNITY_OUTPUT_FLUSH();
+    UNITY_OUTPUT_FLUSH();
+    stopSpying();
+
+    TEST_ASSERT_EQUAL_UINT32(0, spy_writes);
+}
+
+void test_SetWriterFlushesToPreviousWriter(void)
+{
+    UnityPrint("old");
+    UnityOutputBuffer_SetWriter(otherWriteSpy);
+    UnityPrint("new");
+    UNITY_OUTPUT_FLUSH();
+    stopSpying();
+
+    TEST_ASSERT_EQUAL_UINT32(1, spy_writes);
+    TEST_ASSERT_EQUAL_STRING("old", spy_data);
+    TEST_ASSERT_EQUAL_UINT32(1, other_spy_writes);
+}
+
+void test_NumbersArePrintedThroughTheBuffer(void)
+{
+    UnityPrintNumber(-12345);
+    UNITY_PRINT_EOL();
+    stopSpying();
+
+    TEST_ASSERT_EQUAL_UINT32(1, spy_writes);
+    TEST_ASSERT_EQUAL_STRING("-12345\n", spy_data);
+}
+
+void test_WriteSplitsAcrossFullBuffers(void)
+{
+    char data[(2 * UNITY_OUTPUT_BUFFER_SIZE) + 3];
+    UNITY_UINT32 pending;
+
+    memset(data, 'y', sizeof(data));
+    UnityOutputBuffer_Write(data, 5);
+    UnityOutputBuffer_Write(data, (UNITY_UINT32)sizeof(data) - 5);
+    pending = UnityOutputBuffer_Pending();
+    stopSpying();
+
+    /* Stopping the spy flushes the remainder as a third write */
+    TEST_ASSERT_EQUAL_UINT32(3, pending);
+    TEST_ASSERT_EQUAL_UINT32(3, spy_writes);
+    TEST_ASSERT_EQUAL_UINT32(UNITY_OUTPUT_BUFFER_SIZE, spy_write_lengths[0]);
+    TEST_ASSERT_EQUAL_UINT32(UNITY_OUTPUT_BUFFER_SIZE, spy_write_lengths[1]);
+    TEST_ASSERT_EQUAL_UINT32(3, spy_write_lengths[2]);
+}
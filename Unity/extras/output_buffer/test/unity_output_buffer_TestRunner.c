@@ -0,0 +1,29 @@
+/* ==========================================
+ *  Unity Project - A Test Framework for C
+ *  Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+ *  [Released under MIT License. Please refer to license.txt for details]
+ * ========================================== */
+
+#include "unity.h"
+#include "unity_output_buffer.h"
+
+extern void test_CharactersAreHeldUntilNewline(void);
+extern void test_FullBufferIsWrittenWithoutNewline(void);
+extern void test_FlushWritesPartialLine(void);
+extern void test_FlushWithNothingPendingDoesNotWrite(void);
+extern void test_SetWriterFlushesToPreviousWriter(void);
+extern void test_NumbersArePrintedThroughTheBuffer(void);
+extern void test_WriteSplitsAcrossFullBuffers(void);
+
+int main(void)
+{
+    UnityBegin("unity_output_buffer_Test.c");
+    RUN_TEST(test_CharactersAreHeldUntilNewline);
+    RUN_TEST(test_FullBufferIsWrittenWithoutNewline);
+    RUN_TEST(test_FlushWritesPartialLine);
+    RUN_TEST(test_FlushWithNothingPendingDoesNotWrite);
+    RUN_TEST(test_SetWriterFlushesToPreviousWriter);
+    RUN_TEST(test_NumbersArePrintedThroughTheBuffer);
+    RUN_TEST(test_WriteSplitsAcrossFullBuffers);
+    return UnityEnd();
+}
@@ -6,6 +6,13 @@
 
 #include "unity.h"
 
+/* Arrays and memory are compared a block at a time with memcmp(), which takes plain pointers.
+ * Without <string.h>, or when UNITY_PTR_ATTRIBUTE qualifies Unity's pointers, a byte loop is used instead. */
+#if !defined(UNITY_EXCLUDE_STRING_H) && !defined(UNITY_PTR_ATTRIBUTE_IS_SET)
+#include <string.h>
+#define UNITY_USE_MEMCMP
+#endif
+
 #ifndef UNITY_PROGMEM
 #define UNITY_PROGMEM
 #endif
@@ -72,6 +79,58 @@ static const char UNITY_PROGMEM UnityStrDetail2Name[]            = " " UNITY_DET
  * Pretty Printers & Test Result Output Handlers
  *-----------------------------------------------*/
 
+/* "00" to "99", so decimal numbers are converted two digits per division */
+static const char UnityDecimalPairs[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+static const char UnityHexDigits[] = "0123456789ABCDEF";
+
+/* Enough for every decimal digit of a UNITY_UINT and a sign */
+#define UNITY_DECIMAL_BUFFER_SIZE (sizeof(UNITY_UINT) * 3 + 1)
+
+/*-----------------------------------------------*/
+/* Local helper function to print characters that need no escaping, all at once. */
+static void UnityPrintChars(const char* chars, const UNITY_UINT32 length)
+{
+#ifdef UNITY_OUTPUT_CHARS
+    UNITY_OUTPUT_CHARS(chars, length);
+#else
+    UNITY_UINT32 i;
+
+    for (i = 0; i < length; i++)
+    {
+        UNITY_OUTPUT_CHAR(chars[i]);
+    }
+#endif
+}
+
+/*-----------------------------------------------*/
+/* Local helper function to convert a number to decimal, ending just before end. Returns the first digit. */
+static char* UnityFormatDecimal(char* end, UNITY_UINT number)
+{
+    char* pch = end;
+    UNITY_UINT pair;
+
+    while (number >= 100)
+    {
+        pair = (number % 100) * 2;
+        number /= 100;
+        *--pch = UnityDecimalPairs[pair + 1];
+        *--pch = UnityDecimalPairs[pair];
+    }
+    if (number >= 10)
+    {
+        *--pch = UnityDecimalPairs[(number * 2) + 1];
+        *--pch = UnityDecimalPairs[number * 2];
+    }
+    else
+    {
+        *--pch = (char)('0' + number);
+    }
+    return pch;
+}
+
 /*-----------------------------------------------*/
 /* Local helper function to print characters. */
 static void UnityPrintChar(const char* pch)
@@ -237,88 +296,74 @@ void UnityPrintNumberByStyle(const UNITY_INT number, const UNITY_DISPLAY_STYLE_T
 /*-----------------------------------------------*/
 void UnityPrintNumber(const UNITY_INT number_to_print)
 {
+    char buf[UNITY_DECIMAL_BUFFER_SIZE];
+    char* end = &buf[sizeof(buf)];
+    char* pch;
     UNITY_UINT number = (UNITY_UINT)number_to_print;
 
     if (number_to_print < 0)
     {
         /* A negative number, including MIN negative */
-        UNITY_OUTPUT_CHAR('-');
         number = (~number) + 1;
     }
-    UnityPrintNumberUnsigned(number);
+    pch = UnityFormatDecimal(end, number);
+    if (number_to_print < 0)
+    {
+        *--pch = '-';
+    }
+    UnityPrintChars(pch, (UNITY_UINT32)(end - pch));
 }
 
 /*-----------------------------------------------
- * basically do an itoa using as little ram as possible */
+ * basically do an itoa into a small stack buffer */
 void UnityPrintNumberUnsigned(const UNITY_UINT number)
 {
-    UNITY_UINT divisor = 1;
+    char buf[UNITY_DECIMAL_BUFFER_SIZE];
+    char* end = &buf[sizeof(buf)];
+    char* pch = UnityFormatDecimal(end, number);
 
-    /* figure out initial divisor */
-    while (number / divisor > 9)
-    {
-        divisor *= 10;
-    }
-
-    /* now mod and print, then divide divisor */
-    do
-    {
-        UNITY_OUTPUT_CHAR((char)('0' + (number / divisor % 10)));
-        divisor /= 10;
-    } while (divisor > 0);
+    UnityPrintChars(pch, (UNITY_UINT32)(end - pch));
 }
 
 /*-----------------------------------------------*/
 void UnityPrintNumberHex(const UNITY_UINT number, const char nibbles_to_print)
 {
-    int nibble;
+    char buf[UNITY_MAX_NIBBLES];
     char nibbles = nibbles_to_print;
+    int i;
 
     if ((unsigned)nibbles > UNITY_MAX_NIBBLES)
     {
         nibbles = UNITY_MAX_NIBBLES;
     }
 
-    while (nibbles > 0)
+    for (i = 0; i < nibbles; i++)
     {
-        nibbles--;
-        nibble = (int)(number >> (nibbles * 4)) & 0x0F;
-        if (nibble <= 9)
-        {
-            UNITY_OUTPUT_CHAR((char)('0' + nibble));
-        }
-        else
-        {
-            UNITY_OUTPUT_CHAR((char)('A' - 10 + nibble));
-        }
+        buf[i] = UnityHexDigits[(int)(number >> ((nibbles - 1 - i) * 4)) & 0x0F];
     }
+    UnityPrintChars(buf, (UNITY_UINT32)i);
 }
 
 /*-----------------------------------------------*/
 void UnityPrintMask(const UNITY_UINT mask, const UNITY_UINT number)
 {
     UNITY_UINT current_bit = (UNITY_UINT)1 << (UNITY_INT_WIDTH - 1);
+    char buf[UNITY_INT_WIDTH];
     UNITY_INT32 i;
 
     for (i = 0; i < UNITY_INT_WIDTH; i++)
     {
         if (current_bit & mask)
         {
-            if (current_bit & number)
-            {
-                UNITY_OUTPUT_CHAR('1');
-            }
-            else
-            {
-                UNITY_OUTPUT_CHAR('0');
-            }
+            buf[i] = (current_bit & number) ? '1' : '0';
         }
         else
         {
-            UNITY_OUTPUT_CHAR('X');
+            buf[i] = 'X';
         }
         current_bit = current_bit >> 1;
     }
+    UnityPrintChars(buf, (UNITY_UINT32)UNITY_INT_WIDTH);
 }
 
 /*-----------------------------------------------*/
@@ -342,27 +387,36 @@ void UnityPrintFloat(const UNITY_DOUBLE input_number)
     static const UNITY_INT32 max_scaled = 10000000;
 #endif
 
+    /* Exact powers of 10 (up to 10^10), so looking a factor up gives the same value as multiplying it up */
+    static const UNITY_DOUBLE powers_of_ten[] = {1.0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+
     UNITY_DOUBLE number = input_number;
+    char buf[32];
+    char* pch = buf;
 
     /* print minus sign (does not handle negative zero) */
     if (number < 0.0f)
     {
-        UNITY_OUTPUT_CHAR('-');
+        *pch++ = '-';
         number = -number;
     }
 
     /* handle zero, NaN, and +/- infinity */
     if (number == 0.0f)
     {
-        UnityPrint("0");
+        *pch++ = '0';
     }
     else if (isnan(number))
     {
-        UnityPrint("nan");
+        *pch++ = 'n';
+        *pch++ = 'a';
+        *pch++ = 'n';
     }
     else if (isinf(number))
     {
-        UnityPrint("inf");
+        *pch++ = 'i';
+        *pch++ = 'n';
+        *pch++ = 'f';
     }
     else
     {
@@ -371,32 +425,33 @@ void UnityPrintFloat(const UNITY_DOUBLE input_number)
         int         exponent = 0;
         int         decimals;
         int         digits;
-        char        buf[16] = {0};
+        int         scale = 0;
+        char        digit_buf[16];  /* "0." and up to sig_digits + 3 decimals */
+        char*       digits_end = &digit_buf[sizeof(digit_buf)];
+        char*       digit;
 
         /*
          * Scale up or down by powers of 10.  To minimize rounding error,
          * start with a factor/divisor of 10^10, which is the largest
-         * power of 10 that can be represented exactly.  Finally, compute
+         * power of 10 that can be represented exactly.  Finally, look up
          * (exactly) the remaining power of 10 and perform one more
          * multiplication or division.
          */
         if (number < 1.0f)
         {
-            UNITY_DOUBLE factor = 1.0f;
-
             while (number < (UNITY_DOUBLE)max_scaled / 1e10f)  { number *= 1e10f; exponent -= 10; }
-            while (number * factor < (UNITY_DOUBLE)min_scaled) { factor *= 10.0f; exponent--; }
+            while (number * powers_of_ten[scale] < (UNITY_DOUBLE)min_scaled) { scale++; }
 
-            number *= factor;
+            number *= powers_of_ten[scale];
+            exponent -= scale;
         }
         else if (number > (UNITY_DOUBLE)max_scaled)
         {
-            UNITY_DOUBLE divisor = 1.0f;
-
             while (number > (UNITY_DOUBLE)min_scaled * 1e10f)   { number  /= 1e10f; exponent += 10; }
-            while (number / divisor > (UNITY_DOUBLE)max_scaled) { divisor *= 10.0f; exponent++; }
+            while (number / powers_of_ten[scale] > (UNITY_DOUBLE)max_scaled) { scale++; }
 
-            number /= divisor;
+            number /= powers_of_ten[scale];
+            exponent += scale;
         }
         else
         {
@@ -405,13 +460,13 @@ void UnityPrintFloat(const UNITY_DOUBLE input_number)
              * doing any multiplications.  This reduces rounding error by
              * freeing up significant bits in the fractional part.
              */
-            UNITY_DOUBLE factor = 1.0f;
             n_int = (UNITY_INT32)number;
             number -= (UNITY_DOUBLE)n_int;
 
-            while (n_int < min_scaled) { n_int *= 10; factor *= 10.0f; exponent--; }
+            while (n_int < min_scaled) { n_int *= 10; scale++; }
 
-            number *= factor;
+            number *= powers_of_ten[scale];
+            exponent -= scale;
         }
 
         /* round to nearest integer */
@@ -442,51 +497,53 @@ void UnityPrintFloat(const UNITY_DOUBLE input_number)
             decimals--;
         }
 
-        /* build up buffer in reverse order */
-        digits = 0;
-        while ((n != 0) || (digits <= decimals))
+        /* convert to digits, padded with leading zeroes up to the decimal point */
+        digit = UnityFormatDecimal(digits_end, (UNITY_UINT)n);
+        while ((digits_end - digit) <= decimals)
         {
-            buf[digits++] = (char)('0' + n % 10);
-            n /= 10;
+            *--digit = '0';
         }
 
-        /* print out buffer (backwards) */
+        /* copy the digits, inserting the decimal point */
+        digits = (int)(digits_end - digit);
         while (digits > 0)
         {
             if (digits == decimals)
             {
-                UNITY_OUTPUT_CHAR('.');
+                *pch++ = '.';
             }
-            UNITY_OUTPUT_CHAR(buf[--digits]);
+            *pch++ = *digit++;
+            digits--;
         }
 
-        /* print exponent if needed */
+        /* append exponent if needed */
         if (exponent != 0)
         {
-            UNITY_OUTPUT_CHAR('e');
+            *pch++ = 'e';
 
             if (exponent < 0)
             {
-                UNITY_OUTPUT_CHAR('-');
+                *pch++ = '-';
                 exponent = -exponent;
             }
             else
             {
-                UNITY_OUTPUT_CHAR('+');
+                *pch++ = '+';
             }
 
-            digits = 0;
-            while ((exponent != 0) || (digits < 2))
+            if (exponent < 10)
             {
-                buf[digits++] = (char)('0' + exponent % 10);
-                exponent /= 10;
+                *pch++ = '0';
             }
-            while (digits > 0)
+            digit = UnityFormatDecimal(digits_end, (UNITY_UINT)exponent);
+            while (digit < digits_end)
             {
-                UNITY_OUTPUT_CHAR(buf[--digits]);
+                *pch++ = *digit++;
             }
         }
     }
+
+    UnityPrintChars(buf, (UNITY_UINT32)(pch - buf));
 }
 #endif /* ! UNITY_EXCLUDE_FLOAT_PRINT */
 
@@ -561,6 +618,7 @@ void UnityConcludeTest(void)
     Unity.CurrentTestFailed = 0;
     Unity.CurrentTestIgnored = 0;
     UNITY_PRINT_EXEC_TIME();
+    UNITY_PRINT_BENCH_RESULT();
     UNITY_PRINT_EOL();
     UNITY_FLUSH_CALL();
 }
@@ -776,6 +834,54 @@ do {                                       \
     UNITY_FAIL_AND_BAIL;                   \
 } while (0)
 
+/*-----------------------------------------------*/
+static int UnityBytesAreEqual(UNITY_INTERNAL_PTR expected,
+                              UNITY_INTERNAL_PTR actual,
+                              const UNITY_UINT32 length)
+{
+#ifdef UNITY_USE_MEMCMP
+    return (memcmp(expected, actual, length) == 0);
+#else
+    UNITY_PTR_ATTRIBUTE const unsigned char* ptr_exp = (UNITY_PTR_ATTRIBUTE const unsigned char*)expected;
+    UNITY_PTR_ATTRIBUTE const unsigned char* ptr_act = (UNITY_PTR_ATTRIBUTE const unsigned char*)actual;
+    UNITY_UINT32 bytes = length;
+
+    while (bytes--)
+    {
+        if (*ptr_exp++ != *ptr_act++)
+        {
+            return 0;
+        }
+    }
+    return 1;
+#endif
+}
+
+/*-----------------------------------------------*/
+/* Fast path for the array and memory asserts: returns 1 if all num_elements elements of size bytes
+ * match, comparing whole blocks instead of one element at a time. A 0 only means the caller has to
+ * walk the elements itself to find and report the first mismatch. */
+static int UnityElementsAreEqual(UNITY_INTERNAL_PTR expected,
+                                 UNITY_INTERNAL_PTR actual,
+                                 const UNITY_UINT32 size,
+                                 const UNITY_UINT32 num_elements,
+                                 const UNITY_FLAGS_T flags)
+{
+    if ((size == 0) || (num_elements > (0xFFFFFFFFu / size)))
+    {
+        return 0; /* Byte count does not fit, let the caller compare element-wise */
+    }
+
+    if (flags == UNITY_ARRAY_TO_ARRAY)
+    {
+        return UnityBytesAreEqual(expected, actual, num_elements * size);
+    }
+
+    /* Every element equals expected if the first one does and each one equals its successor */
+    return UnityBytesAreEqual(expected, actual, size) &&
+           UnityBytesAreEqual(actual, (UNITY_INTERNAL_PTR)((const char*)actual + size), (num_elements - 1) * size);
+}
+
 /*-----------------------------------------------*/
 void UnityAssertEqualIntArray(UNITY_INTERNAL_PTR expected,
                               UNITY_INTERNAL_PTR actual,
@@ -810,6 +916,25 @@ void UnityAssertEqualIntArray(UNITY_INTERNAL_PTR expected,
         UNITY_FAIL_AND_BAIL;
     }
 
+    /* Two values of the same width are equal exactly when their bytes are, whatever the style */
+    switch (length)
+    {
+        case 1:
+        case 2:
+#ifdef UNITY_SUPPORT_64
+        case 8:
+#endif
+            increment = length;
+            break;
+        default:
+            increment = 4;
+            break;
+    }
+    if (UnityElementsAreEqual(expected, actual, increment, num_elements, flags))
+    {
+        return;
+    }
+
     while ((elements > 0) && (elements--))
     {
         UNITY_INT expect_val;
@@ -1787,6 +1912,11 @@ void UnityAssertEqualMemory(UNITY_INTERNAL_PTR expected,
         UNITY_FAIL_AND_BAIL;
     }
 
+    if (UnityElementsAreEqual(expected, actual, length, num_elements, flags))
+    {
+        return;
+    }
+
     while (elements--)
     {
         bytes = length;
@@ -2184,6 +2314,10 @@ void UnityMessage(const char* msg, const UNITY_LINE_TYPE line)
 #ifndef UNITY_SKIP_DEFAULT_RUNNER
 void UnityDefaultTestRun(UnityTestFunction Func, const char* FuncName, const int FuncLineNum)
 {
+    if (UNITY_FORK_TEST_RUN(Func, FuncName, FuncLineNum))
+    {
+        return;
+    }
     Unity.CurrentTestName = FuncName;
     Unity.CurrentTestLineNumber = (UNITY_LINE_TYPE)FuncLineNum;
     Unity.NumberOfTests++;
@@ -2228,6 +2362,7 @@ void UnityBegin(const char* filename)
 /*-----------------------------------------------*/
 int UnityEnd(void)
 {
+    UNITY_FORK_FINISH();
     UNITY_PRINT_EOL();
     UnityPrint(UnityStrBreaker);
     UNITY_PRINT_EOL();
@@ -2262,14 +2397,112 @@ int UnityEnd(void)
 
 char* UnityOptionIncludeNamed = NULL;
 char* UnityOptionExcludeNamed = NULL;
+char* UnityOptionIndexes      = NULL;
+UNITY_UINT32 UnityOptionShardIndex = 0;
+UNITY_UINT32 UnityOptionShardCount = 0;
 int UnityVerbosity            = 1;
 
+/*-----------------------------------------------*/
+/* Reads decimal digits at *text and moves *text past them. Returns 0 if there are none. */
+static int UnityParseIndex(const char** text, UNITY_UINT32* value)
+{
+    const char* pch = *text;
+    *value = 0;
+
+    while ((*pch >= '0') && (*pch <= '9'))
+    {
+        *value = (*value * 10u) + (UNITY_UINT32)(*pch - '0');
+        pch++;
+    }
+
+    if (pch == *text)
+    {
+        return 0;
+    }
+    *text = pch;
+    return 1;
+}
+
+/*-----------------------------------------------*/
+/* Returns 1 if index is in a list like "3,10-19". Returns -1 if the list is malformed. */
+static int UnityIndexListMatches(const char* list, UNITY_UINT32 index)
+{
+    const char* pch = list;
+    int found = 0;
+
+    for (;;)
+    {
+        UNITY_UINT32 first;
+        UNITY_UINT32 last;
+
+        if (!UnityParseIndex(&pch, &first))
+        {
+            return -1;
+        }
+        last = first;
+        if (*pch == '-')
+        {
+            pch++;
+            if (!UnityParseIndex(&pch, &last))
+            {
+                return -1;
+            }
+        }
+        if ((index >= first) && (index <= last))
+        {
+            found = 1;
+        }
+        if (*pch == 0)
+        {
+            return found;
+        }
+        if (*pch++ != ',')
+        {
+            return -1;
+        }
+    }
+}
+
+/*-----------------------------------------------*/
+/* Returns the rest of text if it starts with prefix, otherwise NULL */
+static const char* UnitySkipPrefix(const char* text, const char* prefix)
+{
+    while (*prefix != 0)
+    {
+        if (*text++ != *prefix++)
+        {
+            return NULL;
+        }
+    }
+    return text;
+}
+
+/*-----------------------------------------------*/
+/* Parses "i/n" into the shard options. Returns 0 if it is malformed or i is not below n. */
+static int UnityParseShard(const char* text)
+{
+    const char* pch = text;
+    UNITY_UINT32 index;
+    UNITY_UINT32 count;
+
+    if (!UnityParseIndex(&pch, &index) || (*pch++ != '/') || !UnityParseIndex(&pch, &count) || (*pch != 0) || (index >= count))
+    {
+        return 0;
+    }
+    UnityOptionShardIndex = index;
+    UnityOptionShardCount = count;
+    return 1;
+}
+
 /*-----------------------------------------------*/
 int UnityParseOptions(int argc, char** argv)
 {
     int i;
     UnityOptionIncludeNamed = NULL;
     UnityOptionExcludeNamed = NULL;
+    UnityOptionIndexes      = NULL;
+    UnityOptionShardIndex   = 0;
+    UnityOptionShardCount   = 0;
 
     for (i = 1; i < argc; i++)
     {
@@ -2279,6 +2512,55 @@ int UnityParseOptions(int argc, char** argv)
             {
                 case 'l': /* list tests */
                     return -1;
+                case 'i': /* include tests by their position in the list, i.e. 0,4-7 */
+                    if (argv[i][2] == '=')
+                    {
+                        UnityOptionIndexes = &argv[i][3];
+                    }
+                    else if (++i < argc)
+                    {
+                        UnityOptionIndexes = argv[i];
+                    }
+                    else
+                    {
+                        UnityPrint("ERROR: No Test Index to Include");
+                        UNITY_PRINT_EOL();
+                        return 1;
+                    }
+                    if (UnityIndexListMatches(UnityOptionIndexes, 0) < 0)
+                    {
+                        UnityPrint("ERROR: Invalid Test Index ");
+                        UnityPrint(UnityOptionIndexes);
+                        UNITY_PRINT_EOL();
+                        return 1;
+                    }
+                    break;
+                case '-': /* --shard i/n runs every nth test starting at the ith */
+                {
+                    const char* shard = UnitySkipPrefix(&argv[i][2], "shard");
+                    if ((shard != NULL) && (*shard == 0))
+                    {
+                        shard = (++i < argc) ? argv[i] : "";
+                    }
+                    else if ((shard != NULL) && (*shard == '='))
+                    {
+                        shard++;
+                    }
+                    else
+                    {
+                        UnityPrint("ERROR: Unknown Option ");
+                        UnityPrint(&argv[i][2]);
+                        UNITY_PRINT_EOL();
+                        return 1;
+                    }
+                    if (!UnityParseShard(shard))
+                    {
+                        UnityPrint("ERROR: Invalid Shard, expected i/n with i < n");
+                        UNITY_PRINT_EOL();
+                        return 1;
+                    }
+                    break;
+                }
                 case 'n': /* include tests with name including this string */
                 case 'f': /* an alias for -n */
                     if (argv[i][2] == '=')
@@ -2464,5 +2746,21 @@ int UnityTestMatches(void)
     return retval;
 }
 
+/*-----------------------------------------------*/
+int UnityTestIndexMatches(UNITY_UINT32 index)
+{
+    if ((UnityOptionShardCount > 1) && ((index % UnityOptionShardCount) != UnityOptionShardIndex))
+    {
+        return 0;
+    }
+
+    if (UnityOptionIndexes)
+    {
+        return UnityIndexListMatches(UnityOptionIndexes, index) == 1;
+    }
+
+    return 1;
+}
+
 #endif /* UNITY_USE_COMMAND_LINE_ARGS */
 /*-----------------------------------------------*/
@@ -208,6 +208,8 @@
 
 #ifndef UNITY_PTR_ATTRIBUTE
   #define UNITY_PTR_ATTRIBUTE
+#else
+  #define UNITY_PTR_ATTRIBUTE_IS_SET
 #endif
 
 #ifndef UNITY_INTERNAL_PTR
@@ -291,6 +293,25 @@ typedef UNITY_FLOAT_TYPE UNITY_FLOAT;
 
 #endif
 
+/*-------------------------------------------------------
+ * Output Method: Buffered (extras/output_buffer)
+ *-------------------------------------------------------*/
+#ifdef UNITY_INCLUDE_OUTPUT_BUFFER
+  /* Output is collected in a static buffer and written in bulk. Custom transports
+   * are configured with UNITY_OUTPUT_BUFFER_WRITE instead of UNITY_OUTPUT_CHAR. */
+  #if defined(UNITY_OUTPUT_CHAR) || defined(UNITY_OUTPUT_CHARS) || defined(UNITY_OUTPUT_FLUSH)
+    #error "UNITY_INCLUDE_OUTPUT_BUFFER provides UNITY_OUTPUT_CHAR(S) and UNITY_OUTPUT_FLUSH. Define UNITY_OUTPUT_BUFFER_WRITE instead."
+  #endif
+  /* Still included, like the stdout default, so tests relying on it build either way */
+  #include <stdio.h>
+  void UnityOutputBuffer_Char(int c);
+  void UnityOutputBuffer_Write(const char* data, UNITY_UINT32 length);
+  void UnityOutputBuffer_Flush(void);
+  #define UNITY_OUTPUT_CHAR(a)    UnityOutputBuffer_Char(a)
+  #define UNITY_OUTPUT_CHARS(data, length) UnityOutputBuffer_Write(data, length)
+  #define UNITY_OUTPUT_FLUSH()    UnityOutputBuffer_Flush()
+#endif
+
 /*-------------------------------------------------------
  * Output Method: stdout (DEFAULT)
  *-------------------------------------------------------*/
@@ -298,6 +319,10 @@ typedef UNITY_FLOAT_TYPE UNITY_FLOAT;
   /* Default to using putchar, which is defined in stdio.h */
   #include <stdio.h>
   #define UNITY_OUTPUT_CHAR(a) (void)putchar(a)
+  #ifndef UNITY_OUTPUT_CHARS
+    /* Formatted numbers are written with one call instead of one putchar per digit */
+    #define UNITY_OUTPUT_CHARS(data, length) (void)fwrite(data, 1, (size_t)(length), stdout)
+  #endif
 #else
   /* If defined as something else, make sure we declare it here so it's ready for use */
   #ifdef UNITY_OUTPUT_CHAR_HEADER_DECLARATION
@@ -305,6 +330,12 @@ typedef UNITY_FLOAT_TYPE UNITY_FLOAT;
   #endif
 #endif
 
+/* UNITY_OUTPUT_CHARS(data, length) is optional. Without it, Unity writes its formatted numbers
+ * one UNITY_OUTPUT_CHAR at a time. */
+#ifdef UNITY_OUTPUT_CHARS_HEADER_DECLARATION
+  extern void UNITY_OUTPUT_CHARS_HEADER_DECLARATION;
+#endif
+
 #ifndef UNITY_OUTPUT_FLUSH
   #ifdef UNITY_USE_FLUSH_STDOUT
     /* We want to use the stdout flush utility */
@@ -402,6 +433,25 @@ typedef UNITY_FLOAT_TYPE UNITY_FLOAT;
 #define UNITY_PRINT_EXEC_TIME() do { /* nothing*/ } while (0)
 #endif
 
+#ifdef UNITY_INCLUDE_BENCH
+  /* Results of TEST_BENCH_LOOP (extras/bench) are printed after the test's PASS/FAIL */
+  void UnityBench_PrintResult(void);
+  #define UNITY_PRINT_BENCH_RESULT() UnityBench_PrintResult()
+#else
+  #define UNITY_PRINT_BENCH_RESULT() do { /* nothing*/ } while (0)
+#endif
+
+#ifdef UNITY_INCLUDE_FORK
+  /* Each RUN_TEST runs in a child process (extras/fork). Nonzero if the test was run or skipped there. */
+  int  UnityFork_TestRun(void (*Func)(void), const char* FuncName, const int FuncLineNum);
+  void UnityFork_Finish(void);
+  #define UNITY_FORK_TEST_RUN(func, name, line) UnityFork_TestRun(func, name, line)
+  #define UNITY_FORK_FINISH() UnityFork_Finish()
+#else
+  #define UNITY_FORK_TEST_RUN(func, name, line) 0
+  #define UNITY_FORK_FINISH() do { /* nothing*/ } while (0)
+#endif
+
 /*-------------------------------------------------------
  * Footprint
  *-------------------------------------------------------*/
@@ -840,6 +890,7 @@ extern const char UnityStrErrShorthand[];
 #ifdef UNITY_USE_COMMAND_LINE_ARGS
 int UnityParseOptions(int argc, char** argv);
 int UnityTestMatches(void);
+int UnityTestIndexMatches(UNITY_UINT32 index);
 #endif
 
 /*-------------------------------------------------------
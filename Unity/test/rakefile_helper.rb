@@ -248,6 +248,72 @@ module RakefileHelpers
     end
   end
 
+  def test_bench()
+    report "\nRunning Bench Addon"
+
+    # Get a list of all source files needed
+    src_files  = Dir[File.join('..','extras','bench','src','*.c')]
+    src_files += Dir[File.join('..','extras','bench','test','*.c')]
+    src_files << File.join('..','src','unity.c')
+
+    # Build object files. Short samples keep the self-test fast.
+    defs = ['UNITY_INCLUDE_BENCH', 'UNITY_BENCH_MIN_SAMPLE_NS=10000u']
+    $extra_paths = [File.join('..','extras','bench','src')]
+    obj_list = src_files.map { |f| compile(f, defs) }
+
+    # Link the test executable
+    test_base = "bench_test"
+    link_it(test_base, obj_list)
+
+    # Run and collect output
+    output = runtest(test_base)
+    save_test_results(test_base, output)
+  end
+
+  def test_output_buffer()
+    report "\nRunning Output Buffer Addon"
+
+    # Get a list of all source files needed
+    src_files  = Dir[File.join('..','extras','output_buffer','src','*.c')]
+    src_files += Dir[File.join('..','extras','output_buffer','test','*.c')]
+    src_files << File.join('..','src','unity.c')
+
+    # Build object files. A small buffer exercises flushing when the buffer is full.
+    defs = ['UNITY_INCLUDE_OUTPUT_BUFFER', 'UNITY_OUTPUT_BUFFER_SIZE=32']
+    $extra_paths = [File.join('..','extras','output_buffer','src')]
+    obj_list = src_files.map { |f| compile(f, defs) }
+
+    # Link the test executable
+    test_base = "output_buffer_test"
+    link_it(test_base, obj_list)
+
+    # Run and collect output
+    output = runtest(test_base)
+    save_test_results(test_base, output)
+  end
+
+  def test_fork()
+    report "\nRunning Fork Addon"
+
+    # Get a list of all source files needed
+    src_files  = Dir[File.join('..','extras','fork','src','*.c')]
+    src_files += Dir[File.join('..','extras','fork','test','*.c')]
+    src_files << File.join('..','src','unity.c')
+
+    # Build object files
+    defs = ['UNITY_INCLUDE_FORK']
+    $extra_paths = [File.join('..','extras','fork','src')]
+    obj_list = src_files.map { |f| compile(f, defs) }
+
+    # Link the test executable
+    test_base = "fork_test"
+    link_it(test_base, obj_list)
+
+    # Run and collect output
+    output = runtest(test_base)
+    save_test_results(test_base, output)
+  end
+
   def run_tests(test_files)
     report "\nRunning Unity system tests"
 
@@ -2552,6 +2552,53 @@ void testNotEqualUINT8EachEqual3(void)
     VERIFY_FAILS_END
 }
 
+void testNotEqualUINT8EachEqualLongArrayLastElement(void)
+{
+    unsigned char p0[257];
+    int i;
+
+    for (i = 0; i < 257; i++)
+    {
+        p0[i] = 0xA5u;
+    }
+    p0[256] = 0x5Au;
+
+    TEST_ASSERT_EACH_EQUAL_UINT8(0xA5u, p0, 256);
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EACH_EQUAL_UINT8(0xA5u, p0, 257);
+    VERIFY_FAILS_END
+}
+
+void testNotEqualUINT8EachEqualAllElementsDiffer(void)
+{
+    unsigned char p0[] = {54u, 54u, 54u, 54u};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EACH_EQUAL_UINT8(55u, p0, 4);
+    VERIFY_FAILS_END
+}
+
+void testNotEqualUINT32ArrayLongArrayLastElement(void)
+{
+    UNITY_UINT32 p0[100];
+    UNITY_UINT32 p1[100];
+    int i;
+
+    for (i = 0; i < 100; i++)
+    {
+        p0[i] = (UNITY_UINT32)i * 65537u;
+        p1[i] = (UNITY_UINT32)i * 65537u;
+    }
+    p1[99] ^= 0x80000000u;
+
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(p0, p1, 99);
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(p0, p1, 100);
+    VERIFY_FAILS_END
+}
+
 void testEqualUINT16EachEqual(void)
 {
     unsigned short p0[] = {65132u, 65132u, 65132u, 65132u};
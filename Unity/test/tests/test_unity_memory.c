@@ -79,3 +79,56 @@ void testNotEqualMemoryLengthZero(void)
     TEST_ASSERT_EQUAL_MEMORY(NULL, NULL, 0);
     VERIFY_FAILS_END
 }
+
+void testEqualMemoryArray(void)
+{
+    int p0[] = {1, 8, 987, -2};
+    int p1[] = {1, 8, 987, -2, 1, 8, 987, -2};
+
+    TEST_ASSERT_EQUAL_MEMORY_ARRAY(p0, p0, sizeof(int), 4);
+    TEST_ASSERT_EQUAL_MEMORY_ARRAY(p0, p1, sizeof(int), 4);
+    TEST_ASSERT_EQUAL_MEMORY_ARRAY(p0, p1 + 4, sizeof(int), 4);
+    TEST_ASSERT_EQUAL_MEMORY_ARRAY(p0, p1, sizeof(p0), 1);
+}
+
+void testNotEqualMemoryArrayLastByte(void)
+{
+    unsigned char p0[64] = {0};
+    unsigned char p1[64] = {0};
+
+    p1[63] = 1;
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EQUAL_MEMORY_ARRAY(p0, p1, 8, 8);
+    VERIFY_FAILS_END
+}
+
+void testEqualMemoryEachEqual(void)
+{
+    int p0[] = {1, 8, 987, -2};
+    int p1[] = {1, 8, 987, -2, 1, 8, 987, -2};
+
+    TEST_ASSERT_EACH_EQUAL_MEMORY(p0, p0, sizeof(p0), 1);
+    TEST_ASSERT_EACH_EQUAL_MEMORY(p0, p1, sizeof(p0), 2);
+    TEST_ASSERT_EACH_EQUAL_MEMORY(p0, p1, sizeof(int), 1);
+}
+
+void testNotEqualMemoryEachEqualLastElement(void)
+{
+    int p0[] = {1, 8};
+    int p1[] = {1, 8, 1, 8, 1, 9};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EACH_EQUAL_MEMORY(p0, p1, sizeof(p0), 3);
+    VERIFY_FAILS_END
+}
+
+void testNotEqualMemoryEachEqualAllElementsDiffer(void)
+{
+    int p0[] = {1, 8};
+    int p1[] = {1, 9, 1, 9, 1, 9};
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_EACH_EQUAL_MEMORY(p0, p1, sizeof(p0), 3);
+    VERIFY_FAILS_END
+}
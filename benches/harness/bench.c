@@ -0,0 +1,591 @@
+/**
+ * @file bench.c
+ * @author agent
+ * @brief Microbenchmark Harness used to measure the Classes in this repository. See bench.h for more details.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+/* Translation Unit */
+#include "bench.h"
+
+/* STD-C Libraries */
+#include <math.h>       /* sqrt */
+#include <stdlib.h>     /* strtoul, qsort, EXIT_SUCCESS */
+#include <string.h>     /* strncmp, strstr, strlen */
+#include <time.h>       /* clock_gettime */
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------- DEFAULT VALUES ----------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+#define BENCH_DEFAULT_WARMUP                                                2
+#define BENCH_DEFAULT_REPETITIONS                                           15
+#define BENCH_DEFAULT_MIN_SAMPLE_NS                                         2000000ULL
+
+
+/**
+ * @brief Number of back-to-back Timer reads used to estimate the cost of reading the Timer.
+ */
+#define BENCH_OVERHEAD_SAMPLES                                              1001
+
+
+/**
+ * @brief Time spent calibrating the Cycle Counter against CLOCK_MONOTONIC.
+ */
+#define BENCH_TSC_CALIBRATION_NS                                            50000000ULL
+
+
+/**
+ * @brief Names of the Timers. Indexed by Bench_Timer.
+ */
+static const char * const Timer_Names[] = { "clock_gettime", "rdtsc", "cycles" };
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------------------- TIMER STATE ------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+static Bench_Timer Selected_Timer = BENCH_TIMER_CLOCK_GETTIME;
+static double Ns_Per_Tick = 1.0;
+static double Units_Per_Tick = 1.0;             /* Ticks to the unit results are reported in. */
+static uint64_t Timer_Overhead_Ticks = 0;
+static bool Counters_Active = false;
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ HELPER FUNCTIONS ---------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Returns CLOCK_MONOTONIC in nanoseconds.
+ */
+static inline uint64_t Monotonic_Ns(void);
+static inline uint64_t Monotonic_Ns(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+
+/**
+ * @brief Returns the unit results are reported in: ns, or the unit of the Cycle Counter for BENCH_TIMER_CYCLES.
+ */
+static const char * Timer_Unit(void);
+static const char * Timer_Unit(void)
+{
+    return (Selected_Timer == BENCH_TIMER_CYCLES) ? Bench_Cycles_Unit() : "ns";
+}
+
+
+/**
+ * @brief Reads the selected Timer without touching the Hardware Performance Counters.
+ */
+static inline uint64_t Read_Timer(void);
+static inline uint64_t Read_Timer(void)
+{
+    if (Selected_Timer != BENCH_TIMER_CLOCK_GETTIME)
+    {
+        return Bench_Cycles_Read();
+    }
+
+    return Monotonic_Ns();
+}
+
+
+/**
+ * @brief qsort comparison for doubles.
+ */
+static int Compare_Doubles(const void * a, const void * b);
+static int Compare_Doubles(const void * a, const void * b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+
+/**
+ * @brief Measures how many nanoseconds a single Cycle Counter Tick is. Returns false if the Cycle Counter is not
+ * available on this target, or for BENCH_TIMER_RDTSC if it is not the Time Stamp Counter.
+ */
+static bool Calibrate_Cycles(Bench_Timer timer);
+static bool Calibrate_Cycles(Bench_Timer timer)
+{
+    bool success = false;
+
+    if ((Bench_Cycles_Init()) && ((timer != BENCH_TIMER_RDTSC) || (strcmp(Bench_Cycles_Source(), "rdtsc") == 0)))
+    {
+        uint64_t ns_start = Monotonic_Ns();
+        uint64_t cycles_start = Bench_Cycles_Read();
+        uint64_t ns_now;
+
+        do
+        {
+            ns_now = Monotonic_Ns();
+        } while ((ns_now - ns_start) < BENCH_TSC_CALIBRATION_NS);
+
+        uint64_t cycles_end = Bench_Cycles_Read();
+
+        if (cycles_end > cycles_start)
+        {
+            Ns_Per_Tick = (double)(ns_now - ns_start) / (double)(cycles_end - cycles_start);
+            success = true;
+        }
+    }
+
+    return success;
+}
+
+
+/**
+ * @brief Estimates the number of Ticks consumed by a Bench_Ticks() pair so it can be removed from
+ * every measured region. The median is used so a preempted read does not skew the estimate.
+ */
+static void Calibrate_Overhead(void);
+static void Calibrate_Overhead(void)
+{
+    static double deltas[BENCH_OVERHEAD_SAMPLES];
+
+    for (uint32_t i = 0; i < BENCH_OVERHEAD_SAMPLES; i++)
+    {
+        uint64_t start = Read_Timer();
+        deltas[i] = (double)(Read_Timer() - start);
+    }
+
+    qsort(deltas, BENCH_OVERHEAD_SAMPLES, sizeof(deltas[0]), Compare_Doubles);
+    Timer_Overhead_Ticks = (uint64_t)deltas[BENCH_OVERHEAD_SAMPLES / 2];
+}
+
+
+/**
+ * @brief Sorts the first @p n entries of @p values into @p sorted and returns their median.
+ */
+static double Sorted_Median(const double * values, uint32_t n, double * sorted);
+static double Sorted_Median(const double * values, uint32_t n, double * sorted)
+{
+    memcpy(sorted, values, n * sizeof(sorted[0]));
+    qsort(sorted, n, sizeof(sorted[0]), Compare_Doubles);
+    return (n % 2) ? sorted[n / 2] : ((sorted[(n / 2) - 1] + sorted[n / 2]) / 2.0);
+}
+
+
+/**
+ * @brief Computes min, median, mean and standard deviation of the recorded samples, and the median
+ * of every Hardware Performance Counter if they were captured.
+ */
+static void Compute_Statistics(Bench_Result * result);
+static void Compute_Statistics(Bench_Result * result)
+{
+    double sorted[BENCH_MAX_REPETITIONS];
+    double sum = 0.0;
+    double sum_sq = 0.0;
+    uint32_t n = result->samples;
+
+    if (result->has_counters)
+    {
+        for (uint32_t c = 0; c < BENCH_COUNTER_COUNT; c++)
+        {
+            result->counter_medians[c] = Sorted_Median(result->counters_per_op[c], n, sorted);
+        }
+    }
+
+    result->median = Sorted_Median(result->per_op, n, sorted);
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+        sum += sorted[i];
+    }
+    result->mean = sum / n;
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+        sum_sq += (sorted[i] - result->mean) * (sorted[i] - result->mean);
+    }
+
+    result->min = sorted[0];
+    result->stddev = (n > 1) ? sqrt(sum_sq / (n - 1)) : 0.0;
+}
+
+
+/**
+ * @brief Writes a single Benchmark Case result in the configured format. A human readable table
+ * is additionally written to stdout whenever results are going to a file.
+ */
+static void Report_Result(Bench_Config * config, const Bench_Case * bench_case, const Bench_Result * result);
+static void Report_Result(Bench_Config * config, const Bench_Case * bench_case, const Bench_Result * result)
+{
+    FILE * out = config->output;
+
+    if ((config->format == BENCH_FORMAT_TABLE) || (out != stdout))
+    {
+        printf("%-48s %10lu %10.2f %10.2f %10.2f %8.2f\n", bench_case->name, (unsigned long)result->iterations,
+               result->min, result->median, result->mean, result->stddev);
+
+        if (result->has_counters)
+        {
+            printf("%-48s", "    per op (median):");
+            for (uint32_t c = 0; c < BENCH_COUNTER_COUNT; c++)
+            {
+                if (Bench_Counters_Available((Bench_Counter)c))
+                {
+                    printf(" %s %.2f", Bench_Counters_Name((Bench_Counter)c), result->counter_medians[c]);
+                }
+            }
+            if ((Bench_Counters_Available(BENCH_COUNTER_CYCLES)) && (Bench_Counters_Available(BENCH_COUNTER_INSTRUCTIONS)) &&
+                (result->counter_medians[BENCH_COUNTER_CYCLES] > 0.0))
+            {
+                printf(" ipc %.2f", result->counter_medians[BENCH_COUNTER_INSTRUCTIONS] / result->counter_medians[BENCH_COUNTER_CYCLES]);
+            }
+            printf("\n");
+        }
+    }
+
+    if (config->format == BENCH_FORMAT_CSV)
+    {
+        for (uint32_t i = 0; i < result->samples; i++)
+        {
+            fprintf(out, "%s,%lu,%lu,%.4f", bench_case->name, (unsigned long)i, (unsigned long)result->iterations,
+                    result->per_op[i]);
+
+            /* Unavailable counters are left empty so every row has the same columns. */
+            for (uint32_t c = 0; (config->counters) && (c < BENCH_COUNTER_COUNT); c++)
+            {
+                if ((result->has_counters) && (Bench_Counters_Available((Bench_Counter)c)))
+                {
+                    fprintf(out, ",%.4f", result->counters_per_op[c][i]);
+                }
+                else
+                {
+                    fprintf(out, ",");
+                }
+            }
+            fprintf(out, "\n");
+        }
+    }
+    else if (config->format == BENCH_FORMAT_JSON)
+    {
+        fprintf(out, "%s\n    {\"name\": \"%s\", \"iterations\": %lu, \"min\": %.4f, \"median\": %.4f, \"mean\": %.4f, "
+                "\"stddev\": %.4f, \"samples\": [", (config->cases_reported) ? "," : "", bench_case->name,
+                (unsigned long)result->iterations, result->min, result->median, result->mean, result->stddev);
+
+        for (uint32_t i = 0; i < result->samples; i++)
+        {
+            fprintf(out, "%s%.4f", (i) ? ", " : "", result->per_op[i]);
+        }
+        fprintf(out, "]");
+
+        if (result->has_counters)
+        {
+            bool first = true;
+            fprintf(out, ", \"counters_per_op\": {");
+            for (uint32_t c = 0; c < BENCH_COUNTER_COUNT; c++)
+            {
+                if (Bench_Counters_Available((Bench_Counter)c))
+                {
+                    fprintf(out, "%s\"%s\": %.4f", (first) ? "" : ", ", Bench_Counters_Name((Bench_Counter)c), result->counter_medians[c]);
+                    first = false;
+                }
+            }
+            fprintf(out, "}");
+        }
+        fprintf(out, "}");
+    }
+
+    config->cases_reported++;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ PUBLIC FUNCTIONS ---------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+bool Bench_Begin(Bench_Config * config, int argc, char ** argv)
+{
+    bool success = true;
+
+    config->format = BENCH_FORMAT_TABLE;
+    config->timer = BENCH_TIMER_CLOCK_GETTIME;
+    config->output = stdout;
+    config->output_path = NULL;
+    config->filter = NULL;
+    config->label = "";
+    config->warmup = BENCH_DEFAULT_WARMUP;
+    config->repetitions = BENCH_DEFAULT_REPETITIONS;
+    config->min_sample_ns = BENCH_DEFAULT_MIN_SAMPLE_NS;
+    config->counters = false;
+    config->cases_reported = 0;
+
+    for (int i = 1; (i < argc) && (success); i++)
+    {
+        const char * value;
+        unsigned long number;
+
+        if (strcmp(argv[i], "--counters") == 0)
+        {
+            config->counters = true;
+        }
+        else if ((value = Bench_Arg_Value(argv[i], "--format")))
+        {
+            if (strcmp(value, "table") == 0)        { config->format = BENCH_FORMAT_TABLE; }
+            else if (strcmp(value, "csv") == 0)     { config->format = BENCH_FORMAT_CSV; }
+            else if (strcmp(value, "json") == 0)    { config->format = BENCH_FORMAT_JSON; }
+            else                                    { success = false; }
+        }
+        else if ((value = Bench_Arg_Value(argv[i], "--timer")))
+        {
+            if (strcmp(value, "clock") == 0)        { config->timer = BENCH_TIMER_CLOCK_GETTIME; }
+            else if (strcmp(value, "rdtsc") == 0)   { config->timer = BENCH_TIMER_RDTSC; }
+            else if (strcmp(value, "cycles") == 0)  { config->timer = BENCH_TIMER_CYCLES; }
+            else                                    { success = false; }
+        }
+        else if ((value = Bench_Arg_Value(argv[i], "--output")))
+        {
+            config->output_path = value;
+        }
+        else if ((value = Bench_Arg_Value(argv[i], "--filter")))
+        {
+            config->filter = value;
+        }
+        else if ((value = Bench_Arg_Value(argv[i], "--label")))
+        {
+            config->label = value;
+        }
+        else if ((value = Bench_Arg_Value(argv[i], "--warmup")) && Bench_Arg_Unsigned(value, &number))
+        {
+            config->warmup = (uint32_t)number;
+        }
+        else if ((value = Bench_Arg_Value(argv[i], "--repetitions")) && Bench_Arg_Unsigned(value, &number) &&
+                 (number > 0) && (number <= BENCH_MAX_REPETITIONS))
+        {
+            config->repetitions = (uint32_t)number;
+        }
+        else if ((value = Bench_Arg_Value(argv[i], "--min-sample-us")) && Bench_Arg_Unsigned(value, &number))
+        {
+            config->min_sample_ns = (uint64_t)number * 1000ULL;
+        }
+        else
+        {
+            success = false;
+        }
+
+        if (!success)
+        {
+            fprintf(stderr, "Invalid argument: %s\n", argv[i]);
+        }
+    }
+
+    if ((success) && (config->output_path))
+    {
+        config->output = fopen(config->output_path, "w");
+        if (!config->output)
+        {
+            fprintf(stderr, "Unable to open %s\n", config->output_path);
+            success = false;
+        }
+    }
+
+    if ((success) && (config->timer != BENCH_TIMER_CLOCK_GETTIME) && (!Calibrate_Cycles(config->timer)))
+    {
+        fprintf(stderr, "%s is not available on this target. Falling back to clock_gettime.\n", Timer_Names[config->timer]);
+        config->timer = BENCH_TIMER_CLOCK_GETTIME;
+    }
+
+    if ((success) && (config->counters) && (!Bench_Counters_Open()))
+    {
+        fprintf(stderr, "Hardware Performance Counters are unavailable (perf_event_open failed). Continuing without them.\n");
+        config->counters = false;
+    }
+
+    if (success)
+    {
+        Counters_Active = config->counters;
+        Selected_Timer = config->timer;
+        if (Selected_Timer == BENCH_TIMER_CLOCK_GETTIME)
+        {
+            Ns_Per_Tick = 1.0;
+        }
+        Units_Per_Tick = (Selected_Timer == BENCH_TIMER_CYCLES) ? 1.0 : Ns_Per_Tick;
+        Calibrate_Overhead();
+
+        if ((config->format == BENCH_FORMAT_TABLE) || (config->output != stdout))
+        {
+            char heading[BENCH_NAME_MAX_LENGTH];
+            (void)snprintf(heading, sizeof(heading), "benchmark (%s/op)", Timer_Unit());
+            printf("%-48s %10s %10s %10s %10s %8s\n", heading, "iters", "min", "median", "mean", "stddev");
+        }
+
+        if (config->format == BENCH_FORMAT_CSV)
+        {
+            fprintf(config->output, "benchmark,sample,iterations,%s_per_op", Timer_Unit());
+            for (uint32_t c = 0; (config->counters) && (c < BENCH_COUNTER_COUNT); c++)
+            {
+                fprintf(config->output, ",%s_per_op", Bench_Counters_Name((Bench_Counter)c));
+            }
+            fprintf(config->output, "\n");
+        }
+        else if (config->format == BENCH_FORMAT_JSON)
+        {
+            fprintf(config->output, "{\n  \"label\": \"%s\",\n  \"timer\": \"%s\",\n  \"cycle_counter\": \"%s\",\n"
+                    "  \"unit\": \"%s\",\n  \"timer_overhead_ns\": %.2f,\n  \"benchmarks\": [", config->label,
+                    Timer_Names[Selected_Timer], Bench_Cycles_Source(), Timer_Unit(),
+                    Bench_Ticks_To_Ns(Timer_Overhead_Ticks));
+        }
+    }
+
+    return success;
+}
+
+
+bool Bench_Run(Bench_Config * config, const Bench_Case * bench_case)
+{
+    static Bench_Result result;
+    bool success = true;
+
+    if ((config->filter) && (!strstr(bench_case->name, config->filter)))
+    {
+        /* Filtered out. Nothing to do. */
+    }
+    else if ((bench_case->setup) && (!bench_case->setup(bench_case->ctx)))
+    {
+        fprintf(stderr, "%s: Setup failed\n", bench_case->name);
+        success = false;
+    }
+    else
+    {
+        /**
+         * Calibrate the number of operations per sample by doubling until a single sample
+         * takes at least min_sample_ns. This also serves as the first part of the warm-up.
+         */
+        uint32_t iterations = 1;
+        while ((iterations < BENCH_MAX_ITERATIONS_PER_SAMPLE) &&
+               (Bench_Ticks_To_Ns(bench_case->run(bench_case->ctx, iterations)) < (double)config->min_sample_ns))
+        {
+            iterations *= 2;
+        }
+
+        for (uint32_t i = 0; i < config->warmup; i++)
+        {
+            (void)bench_case->run(bench_case->ctx, iterations);
+        }
+
+        result.iterations = iterations;
+        result.samples = config->repetitions;
+        result.has_counters = Counters_Active;
+        for (uint32_t i = 0; i < config->repetitions; i++)
+        {
+            uint64_t counts[BENCH_COUNTER_COUNT];
+
+            Bench_Counters_Reset();
+            result.per_op[i] = ((double)bench_case->run(bench_case->ctx, iterations) * Units_Per_Tick) / iterations;
+
+            if ((Counters_Active) && (Bench_Counters_Read(counts)))
+            {
+                for (uint32_t c = 0; c < BENCH_COUNTER_COUNT; c++)
+                {
+                    result.counters_per_op[c][i] = (double)counts[c] / iterations;
+                }
+            }
+            else
+            {
+                result.has_counters = false;
+            }
+        }
+
+        if (bench_case->teardown)
+        {
+            bench_case->teardown(bench_case->ctx);
+        }
+
+        Compute_Statistics(&result);
+        Report_Result(config, bench_case, &result);
+    }
+
+    return success;
+}
+
+
+int Bench_End(Bench_Config * config)
+{
+    if (config->format == BENCH_FORMAT_JSON)
+    {
+        fprintf(config->output, "\n  ]\n}\n");
+    }
+
+    if (config->output != stdout)
+    {
+        (void)fclose(config->output);
+        config->output = stdout;
+    }
+
+    if (Counters_Active)
+    {
+        Bench_Counters_Close();
+        Counters_Active = false;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+
+uint64_t Bench_Ticks(void)
+{
+    /* Counters are enabled before the Timer is read so the enable itself is not timed. */
+    if (Counters_Active)
+    {
+        Bench_Counters_Enable();
+    }
+
+    return Read_Timer();
+}
+
+
+uint64_t Bench_Elapsed(uint64_t start)
+{
+    uint64_t elapsed = Read_Timer() - start;
+
+    if (Counters_Active)
+    {
+        Bench_Counters_Disable();
+    }
+
+    return (elapsed > Timer_Overhead_Ticks) ? (elapsed - Timer_Overhead_Ticks) : 0;
+}
+
+
+double Bench_Ticks_To_Ns(uint64_t ticks)
+{
+    return (double)ticks * Ns_Per_Tick;
+}
+
+
+const char * Bench_Arg_Value(const char * arg, const char * key)
+{
+    size_t key_len = strlen(key);
+    const char * value = NULL;
+
+    if ((strncmp(arg, key, key_len) == 0) && (arg[key_len] == '='))
+    {
+        value = &arg[key_len + 1];
+    }
+
+    return value;
+}
+
+
+bool Bench_Arg_Unsigned(const char * text, unsigned long * value)
+{
+    char * end = NULL;
+    *value = strtoul(text, &end, 10);
+    return (text[0] != '\0') && (end) && (*end == '\0');
+}
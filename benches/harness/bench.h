@@ -0,0 +1,271 @@
+/**
+ * @file bench.h
+ * @author agent
+ * @brief Microbenchmark Harness used to measure the Classes in this repository. A Benchmark Case supplies a Run
+ * function that performs a requested number of operations and returns the number of Timer Ticks spent in the
+ * region it wants measured. The Harness takes care of warm-up, calibrating the number of operations per sample,
+ * repeating the sample, computing statistics and reporting the results as a table, CSV or JSON. Raw samples are
+ * always reported so results from different commits can be compared statistically.
+ *
+ * Typical usage in a Benchmark executable:
+ *
+ * int main(int argc, char ** argv)
+ * {
+ *      Bench_Config config;
+ *
+ *      if (!Bench_Begin(&config, argc, argv)) { return EXIT_FAILURE; }
+ *      (void)Bench_Run(&config, &some_case);
+ *      return Bench_End(&config);
+ * }
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+
+/* STD-C Libraries */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/* Benchmark Harness */
+#include "bench_counters.h"
+#include "bench_cycles.h"
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ HARNESS LIMITS -----------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Maximum number of samples (repetitions) stored for each Benchmark Case. Samples are stored in
+ * a fixed-size array so the Harness itself never allocates memory while measuring.
+ */
+#define BENCH_MAX_REPETITIONS                                               100
+
+
+/**
+ * @brief Maximum number of characters in a Benchmark Case name, including the NULL terminator.
+ */
+#define BENCH_NAME_MAX_LENGTH                                               96
+
+
+/**
+ * @brief Upper bound on the number of operations performed in a single sample when the Harness is
+ * calibrating how many operations are needed to reach the minimum sample time.
+ */
+#define BENCH_MAX_ITERATIONS_PER_SAMPLE                                     (1UL << 24)
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------------- CONFIGURATION TYPES ----------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief The clock source used to timestamp measured regions.
+ */
+typedef enum
+{
+    BENCH_TIMER_CLOCK_GETTIME,          /* CLOCK_MONOTONIC. 1 Tick = 1 ns. Available on every host. */
+    BENCH_TIMER_RDTSC,                  /* x86 Time Stamp Counter calibrated against CLOCK_MONOTONIC. Lower overhead. */
+    BENCH_TIMER_CYCLES                  /* Cycle Counter (see bench_cycles.h). Results are in its unit, not ns. */
+} Bench_Timer;
+
+
+/**
+ * @brief The format results are written in.
+ */
+typedef enum
+{
+    BENCH_FORMAT_TABLE,                 /* Human readable summary. */
+    BENCH_FORMAT_CSV,                   /* One row per sample. */
+    BENCH_FORMAT_JSON                   /* Summary and raw samples of every Benchmark Case. */
+} Bench_Format;
+
+
+/**
+ * @brief Harness configuration. Filled with defaults and command line overrides by Bench_Begin().
+ */
+typedef struct
+{
+    Bench_Format format;
+    Bench_Timer timer;
+    FILE * output;                      /* Where results in the selected format are written. */
+    const char * output_path;           /* NULL when writing to stdout. */
+    const char * filter;                /* Only Benchmark Cases whose name contains this substring run. NULL runs all. */
+    const char * label;                 /* Free-form label (i.e. commit hash) stored with the results. */
+    uint32_t warmup;                    /* Number of samples run and discarded before measuring. */
+    uint32_t repetitions;               /* Number of samples recorded. Must be <= BENCH_MAX_REPETITIONS. */
+    uint64_t min_sample_ns;             /* Operations per sample are calibrated until a sample takes at least this long. */
+    bool counters;                      /* Capture Hardware Performance Counters. Cleared if none are available. */
+    uint32_t cases_reported;            /* Internal. Number of Benchmark Cases reported so far. */
+} Bench_Config;
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ BENCHMARK CASES ----------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Prepares the Benchmark Case's context before any samples are taken.
+ *
+ * @return True if successful. False aborts the Benchmark Case.
+ */
+typedef bool (*Bench_Setup_Fn)(void * ctx);
+
+
+/**
+ * @brief Performs @p iterations operations and returns the number of Timer Ticks spent in the measured region.
+ * Work that should not be measured (i.e. refilling a Ring Buffer) can be excluded by timing only part of the loop
+ * with Bench_Ticks() and Bench_Elapsed().
+ */
+typedef uint64_t (*Bench_Run_Fn)(void * ctx, uint32_t iterations);
+
+
+/**
+ * @brief Releases anything acquired by the Setup function.
+ */
+typedef void (*Bench_Teardown_Fn)(void * ctx);
+
+
+/**
+ * @brief A single Benchmark Case. Setup and Teardown are optional and may be NULL.
+ */
+typedef struct
+{
+    char name[BENCH_NAME_MAX_LENGTH];   /* I.e. "write/element_size=4/fill=50". */
+    Bench_Setup_Fn setup;
+    Bench_Run_Fn run;
+    Bench_Teardown_Fn teardown;
+    void * ctx;
+} Bench_Case;
+
+
+/**
+ * @brief Measurements of a single Benchmark Case. All times are per operation, in nanoseconds or in the unit of the
+ * Cycle Counter (Bench_Cycles_Unit()) for BENCH_TIMER_CYCLES.
+ */
+typedef struct
+{
+    uint32_t iterations;                /* Operations per sample. */
+    uint32_t samples;                   /* Number of valid entries in per_op[]. */
+    double per_op[BENCH_MAX_REPETITIONS];
+    double min;
+    double median;
+    double mean;
+    double stddev;
+    bool has_counters;                  /* True if counters_per_op[] is valid. */
+    double counters_per_op[BENCH_COUNTER_COUNT][BENCH_MAX_REPETITIONS];
+    double counter_medians[BENCH_COUNTER_COUNT];
+} Bench_Result;
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------------- PUBLIC FUNCTIONS -------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Fills @p config with defaults, applies command line overrides, initializes the selected Timer and
+ * writes the start of the report. Supported arguments:
+ *
+ * --format=table|csv|json  --output=FILE  --filter=SUBSTRING  --label=TEXT  --timer=clock|rdtsc|cycles
+ * --warmup=N  --repetitions=N  --min-sample-us=N  --counters
+ *
+ * --timer=cycles reports raw Cycle Counter counts per operation, without converting them to ns. On x86 that is rdtsc,
+ * reported as tsc_ticks. If the target has none a notice is printed and clock_gettime is used instead.
+ *
+ * --counters captures Hardware Performance Counters (see bench_counters.h) around every measured region and
+ * reports them per operation. If no counter can be opened a notice is printed and Benchmarks run without them.
+ *
+ * @param config Configuration to initialize.
+ * @param argc Argument count passed to main().
+ * @param argv Argument vector passed to main().
+ *
+ * @return True if successful. False if an argument was invalid or the output file could not be opened.
+ */
+bool Bench_Begin(Bench_Config * config, int argc, char ** argv);
+
+
+/**
+ * @brief Runs a Benchmark Case (if it matches the filter) and reports its results.
+ *
+ * @param config Configuration returned by Bench_Begin().
+ * @param bench_case Benchmark Case to run.
+ *
+ * @return True if the Benchmark Case ran or was filtered out. False if its Setup function failed.
+ */
+bool Bench_Run(Bench_Config * config, const Bench_Case * bench_case);
+
+
+/**
+ * @brief Writes the end of the report and closes the output file.
+ *
+ * @param config Configuration returned by Bench_Begin().
+ *
+ * @return EXIT_SUCCESS so it can be returned directly from main().
+ */
+int Bench_End(Bench_Config * config);
+
+
+/**
+ * @brief Starts a measured region and returns the current value of the selected Timer in Ticks.
+ * Hardware Performance Counters (if enabled) start counting just before the Timer is read.
+ */
+uint64_t Bench_Ticks(void);
+
+
+/**
+ * @brief Ends a measured region and returns the number of Ticks elapsed since @p start with the cost of
+ * reading the Timer removed. Use this for every measured region so short regions are not dominated by
+ * Timer overhead. Hardware Performance Counters (if enabled) stop counting just after the Timer is read.
+ *
+ * @param start Value previously returned by Bench_Ticks().
+ */
+uint64_t Bench_Elapsed(uint64_t start);
+
+
+/**
+ * @brief Converts Timer Ticks to nanoseconds.
+ */
+double Bench_Ticks_To_Ns(uint64_t ticks);
+
+
+/**
+ * @brief Returns the value of a "--key=value" argument if @p arg starts with @p key. Otherwise NULL.
+ * Shared with the other Harnesses in this directory so every Benchmark parses arguments the same way.
+ */
+const char * Bench_Arg_Value(const char * arg, const char * key);
+
+
+/**
+ * @brief Parses an unsigned integer argument value.
+ *
+ * @return True if @p text is entirely a number. False otherwise.
+ */
+bool Bench_Arg_Unsigned(const char * text, unsigned long * value);
+
+
+/**
+ * @brief Prevents the compiler from optimizing away a value computed inside a measured region.
+ */
+#define BENCH_DO_NOT_OPTIMIZE(value)                                        __asm__ __volatile__("" : : "g"(value) : "memory")
+
+
+/**
+ * @brief Prevents the compiler from caching memory contents in registers across this point.
+ */
+#define BENCH_CLOBBER_MEMORY()                                              __asm__ __volatile__("" : : : "memory")
+
+
+#endif /* BENCH_H_ */
@@ -0,0 +1,949 @@
+/**
+ * @file bench_contention.c
+ * @author agent
+ * @brief Multi-threaded contention Harness for concurrent queues. See bench_contention.h for more details.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+/* CPU affinity (pthread_attr_setaffinity_np, sched_getaffinity) is a GNU extension. Must come before any system header. */
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+    #define _GNU_SOURCE
+#endif
+
+/* Translation Unit */
+#include "bench_contention.h"
+
+/* STD-C Libraries */
+#include <pthread.h>
+#include <sched.h>      /* sched_yield, sched_getaffinity, CPU_SET */
+#include <stdlib.h>     /* malloc, free, qsort, EXIT_SUCCESS */
+#include <string.h>     /* strcmp, strstr, memset */
+#include <time.h>       /* clock_gettime, nanosleep */
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------- DEFAULT VALUES ----------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+#define BENCH_CONTENTION_DEFAULT_DURATION_MS                                200
+#define BENCH_CONTENTION_DEFAULT_WARMUP_MS                                  20
+#define BENCH_CONTENTION_DEFAULT_CAPACITY                                   16
+#define BENCH_CONTENTION_DEFAULT_INTERVAL_NS                                1000
+#define BENCH_CONTENTION_DEFAULT_REPETITIONS                                5
+
+
+/**
+ * @brief Number of failed attempts a thread spins for before yielding its CPU. Yielding keeps the
+ * measurement making progress when there are more threads than CPUs.
+ */
+#define BENCH_CONTENTION_SPINS_BEFORE_YIELD                                 64
+
+
+/**
+ * @brief Thread state is padded to this many bytes so counters of different threads never share a cache line.
+ */
+#define BENCH_CONTENTION_CACHE_LINE                                         64
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------------------- TEST STATE -------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+typedef enum
+{
+    TEST_THROUGHPUT,
+    TEST_PING_PONG,
+    TEST_ONE_WAY
+} Contention_Test;
+
+static const char * const Test_Names[] = {"throughput", "ping_pong", "one_way"};
+
+
+/**
+ * @brief Phases every thread moves through. Counters are zeroed when a thread first sees PHASE_MEASURE
+ * so warm-up work is never reported.
+ */
+typedef enum
+{
+    PHASE_WAIT,
+    PHASE_WARMUP,
+    PHASE_MEASURE,
+    PHASE_STOP
+} Contention_Phase;
+
+
+/**
+ * @brief State shared by every thread of a single measurement. Phase and ready are only accessed
+ * with the __atomic builtins.
+ */
+typedef struct
+{
+    const Bench_Queue_Ops * queue;
+    void * request;                     /* Queue every test pushes into. */
+    void * reply;                       /* Queue ping_pong responses come back on. NULL otherwise. */
+    Contention_Test test;
+    uint64_t interval_ns;
+    int phase;                          /* Contention_Phase */
+    uint32_t ready;                     /* Number of threads waiting for the start signal. */
+} Contention_Shared;
+
+
+/**
+ * @brief Per-thread state. Only the owning thread writes to it until it is joined.
+ */
+typedef struct
+{
+    pthread_t thread;
+    Contention_Shared * shared;
+    bool producer;
+    bool measuring;
+    uint64_t ops;                       /* Successful operations while measuring. */
+    uint64_t retries;                   /* Failed try_push/try_pop calls while measuring. */
+    uint64_t pushed;                    /* Successful pushes over the whole run. Used to detect lost elements. */
+    uint64_t popped;                    /* Successful pops over the whole run. */
+    uint64_t * latencies;               /* NULL for threads that do not record latency. */
+    uint64_t latency_count;             /* Latencies recorded while measuring. May exceed the buffer length. */
+} __attribute__((aligned(BENCH_CONTENTION_CACHE_LINE))) Contention_Thread;
+
+
+/**
+ * @brief Results of a single data point.
+ */
+typedef struct
+{
+    double seconds;
+    uint64_t ops;                       /* Elements delivered (throughput, one_way) or round trips (ping_pong). */
+    double ns_per_op;                   /* Wall-clock nanoseconds per op. The sample compared between runs. */
+    double full_per_push;               /* Failed pushes per successful push. */
+    double empty_per_pop;               /* Failed pops per successful pop. */
+    uint64_t latency_samples;
+    uint64_t p50, p90, p99, p999, max;  /* Latency in nanoseconds. */
+    bool oversubscribed;                /* More threads than CPUs. */
+} Contention_Result;
+
+
+static Contention_Thread Threads[2 * BENCH_CONTENTION_MAX_THREADS];
+
+#if defined(__linux__)
+    static int Cpu_List[CPU_SETSIZE];
+#endif
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ HELPER FUNCTIONS ---------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Returns CLOCK_MONOTONIC in nanoseconds. CLOCK_MONOTONIC is consistent across CPUs so a timestamp
+ * taken by a producer can be compared against one taken by a consumer.
+ */
+static inline uint64_t Now_Ns(void);
+static inline uint64_t Now_Ns(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+
+/**
+ * @brief Sleeps the calling thread for at least @p ms milliseconds.
+ */
+static void Sleep_Ms(uint32_t ms);
+static void Sleep_Ms(uint32_t ms)
+{
+    struct timespec ts;
+    ts.tv_sec = (time_t)(ms / 1000);
+    ts.tv_nsec = (long)(ms % 1000) * 1000000L;
+
+    while (nanosleep(&ts, &ts) != 0)
+    {
+        /* Interrupted. Sleep for the remaining time. */
+    }
+}
+
+
+/**
+ * @brief Tells the CPU the caller is spin-waiting.
+ */
+static inline void Cpu_Relax(void);
+static inline void Cpu_Relax(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+
+/**
+ * @brief Called after every failed try_push/try_pop. Spins for a while and then yields.
+ */
+static inline void Backoff(uint32_t * spins);
+static inline void Backoff(uint32_t * spins)
+{
+    if (++(*spins) >= BENCH_CONTENTION_SPINS_BEFORE_YIELD)
+    {
+        *spins = 0;
+        (void)sched_yield();
+    }
+    else
+    {
+        Cpu_Relax();
+    }
+}
+
+
+/**
+ * @brief Returns the current phase and zeros the thread's counters the first time it sees PHASE_MEASURE.
+ */
+static inline int Update_Phase(Contention_Thread * self);
+static inline int Update_Phase(Contention_Thread * self)
+{
+    int phase = __atomic_load_n(&self->shared->phase, __ATOMIC_ACQUIRE);
+
+    if ((phase == PHASE_MEASURE) && (!self->measuring))
+    {
+        self->measuring = true;
+        self->ops = 0;
+        self->retries = 0;
+        self->latency_count = 0;
+    }
+
+    return phase;
+}
+
+
+/**
+ * @brief Records a latency sample, overwriting the oldest sample once the buffer is full.
+ */
+static inline void Record_Latency(Contention_Thread * self, uint64_t ns);
+static inline void Record_Latency(Contention_Thread * self, uint64_t ns)
+{
+    self->latencies[self->latency_count % BENCH_CONTENTION_MAX_LATENCY_SAMPLES] = ns;
+    self->latency_count++;
+}
+
+
+/**
+ * @brief Pushes @p value, retrying until it succeeds or the measurement stops.
+ *
+ * @return True if @p value was pushed.
+ */
+static bool Push_Until_Stopped(Contention_Thread * self, void * queue, uint64_t value);
+static bool Push_Until_Stopped(Contention_Thread * self, void * queue, uint64_t value)
+{
+    uint32_t spins = 0;
+
+    while (!self->shared->queue->try_push(queue, value))
+    {
+        self->retries++;
+        if (Update_Phase(self) == PHASE_STOP)
+        {
+            return false;
+        }
+        Backoff(&spins);
+    }
+
+    self->pushed++;
+    return true;
+}
+
+
+/**
+ * @brief Pops into @p value, retrying until it succeeds or the measurement stops.
+ *
+ * @return True if an element was popped.
+ */
+static bool Pop_Until_Stopped(Contention_Thread * self, void * queue, uint64_t * value);
+static bool Pop_Until_Stopped(Contention_Thread * self, void * queue, uint64_t * value)
+{
+    uint32_t spins = 0;
+
+    while (!self->shared->queue->try_pop(queue, value))
+    {
+        self->retries++;
+        if (Update_Phase(self) == PHASE_STOP)
+        {
+            return false;
+        }
+        Backoff(&spins);
+    }
+
+    self->popped++;
+    return true;
+}
+
+
+/**
+ * @brief Body of every producer and consumer thread.
+ */
+static void * Thread_Main(void * arg);
+static void * Thread_Main(void * arg)
+{
+    Contention_Thread * self = (Contention_Thread *)arg;
+    Contention_Shared * shared = self->shared;
+    uint64_t value = 0;
+    uint64_t next_push = 0;
+    uint32_t idle_spins = 0;
+
+    (void)__atomic_add_fetch(&shared->ready, 1, __ATOMIC_ACQ_REL);
+    while (__atomic_load_n(&shared->phase, __ATOMIC_ACQUIRE) == PHASE_WAIT)
+    {
+        (void)sched_yield();
+    }
+
+    next_push = Now_Ns();
+
+    while (Update_Phase(self) != PHASE_STOP)
+    {
+        switch (shared->test)
+        {
+            case TEST_THROUGHPUT:
+            {
+                if ((self->producer) && (Push_Until_Stopped(self, shared->request, value)))
+                {
+                    value++;
+                    self->ops++;
+                }
+                else if ((!self->producer) && (Pop_Until_Stopped(self, shared->request, &value)))
+                {
+                    self->ops++;
+                }
+                break;
+            }
+
+            case TEST_PING_PONG:
+            {
+                if (self->producer)
+                {
+                    uint64_t start = Now_Ns();
+                    if ((Push_Until_Stopped(self, shared->request, start)) && (Pop_Until_Stopped(self, shared->reply, &value)))
+                    {
+                        Record_Latency(self, Now_Ns() - start);
+                        self->ops++;
+                    }
+                }
+                else if ((Pop_Until_Stopped(self, shared->request, &value)) && (Push_Until_Stopped(self, shared->reply, value)))
+                {
+                    self->ops++;
+                }
+                break;
+            }
+
+            case TEST_ONE_WAY:
+            {
+                if (self->producer)
+                {
+                    uint64_t now = Now_Ns();
+                    if (now < next_push)
+                    {
+                        Backoff(&idle_spins);
+                    }
+                    else if (Push_Until_Stopped(self, shared->request, Now_Ns()))
+                    {
+                        /* Do not burst to catch up after a stall. Keep the interval between pushes. */
+                        next_push = now + shared->interval_ns;
+                        self->ops++;
+                    }
+                }
+                else if (Pop_Until_Stopped(self, shared->request, &value))
+                {
+                    Record_Latency(self, Now_Ns() - value);
+                    self->ops++;
+                }
+                break;
+            }
+
+            default:
+            {
+                break;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+
+/**
+ * @brief qsort comparison for uint64_t.
+ */
+static int Compare_U64(const void * a, const void * b);
+static int Compare_U64(const void * a, const void * b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+
+/**
+ * @brief qsort comparison of Contention_Result by ns_per_op.
+ */
+static int Compare_Ns_Per_Op(const void * a, const void * b);
+static int Compare_Ns_Per_Op(const void * a, const void * b)
+{
+    double x = ((const Contention_Result *)a)->ns_per_op;
+    double y = ((const Contention_Result *)b)->ns_per_op;
+    return (x > y) - (x < y);
+}
+
+
+/**
+ * @brief Merges the latency samples of @p threads and computes percentiles.
+ *
+ * @return False if the merge buffer could not be allocated.
+ */
+static bool Compute_Latency(Contention_Result * result, uint32_t threads);
+static bool Compute_Latency(Contention_Result * result, uint32_t threads)
+{
+    uint64_t total = 0;
+    uint64_t * merged;
+
+    for (uint32_t i = 0; i < threads; i++)
+    {
+        if (Threads[i].latencies)
+        {
+            total += (Threads[i].latency_count < BENCH_CONTENTION_MAX_LATENCY_SAMPLES) ?
+                     Threads[i].latency_count : BENCH_CONTENTION_MAX_LATENCY_SAMPLES;
+        }
+    }
+
+    result->latency_samples = total;
+    if (total == 0)
+    {
+        return true;
+    }
+
+    merged = (uint64_t *)malloc((size_t)total * sizeof(merged[0]));
+    if (!merged)
+    {
+        return false;
+    }
+
+    total = 0;
+    for (uint32_t i = 0; i < threads; i++)
+    {
+        if (Threads[i].latencies)
+        {
+            uint64_t count = (Threads[i].latency_count < BENCH_CONTENTION_MAX_LATENCY_SAMPLES) ?
+                             Threads[i].latency_count : BENCH_CONTENTION_MAX_LATENCY_SAMPLES;
+            memcpy(&merged[total], Threads[i].latencies, (size_t)count * sizeof(merged[0]));
+            total += count;
+        }
+    }
+
+    qsort(merged, (size_t)total, sizeof(merged[0]), Compare_U64);
+    result->p50 = merged[(total - 1) * 50 / 100];
+    result->p90 = merged[(total - 1) * 90 / 100];
+    result->p99 = merged[(total - 1) * 99 / 100];
+    result->p999 = merged[(total - 1) * 999 / 1000];
+    result->max = merged[total - 1];
+
+    free(merged);
+    return true;
+}
+
+
+/**
+ * @brief Runs a single data point: @p producers and @p consumers threads running @p test against fresh queues.
+ *
+ * @return True if successful. False if a queue or thread could not be created or elements were lost.
+ */
+static bool Measure(const Bench_Contention_Config * config, const Bench_Queue_Ops * queue, Contention_Test test,
+                    uint32_t producers, uint32_t consumers, Contention_Result * result);
+static bool Measure(const Bench_Contention_Config * config, const Bench_Queue_Ops * queue, Contention_Test test,
+                    uint32_t producers, uint32_t consumers, Contention_Result * result)
+{
+    static Contention_Shared shared;
+    uint32_t total = producers + consumers;
+    uint32_t started = 0;
+    uint64_t pushed = 0;
+    uint64_t popped = 0;
+    uint64_t producer_ops = 0, producer_retries = 0;
+    uint64_t consumer_ops = 0, consumer_retries = 0;
+    uint64_t start = 0;
+    uint64_t end = 0;
+    uint64_t value;
+    bool success = true;
+
+    memset(result, 0, sizeof(*result));
+    memset(&shared, 0, sizeof(shared));
+    shared.queue = queue;
+    shared.test = test;
+    shared.interval_ns = config->interval_ns;
+    shared.phase = PHASE_WAIT;
+    shared.request = queue->create(config->capacity);
+    shared.reply = (test == TEST_PING_PONG) ? queue->create(config->capacity) : NULL;
+
+    if ((!shared.request) || ((test == TEST_PING_PONG) && (!shared.reply)))
+    {
+        fprintf(stderr, "%s: unable to create a queue of %lu elements\n", queue->name, (unsigned long)config->capacity);
+        success = false;
+    }
+
+    /* Producers come first so producer i and consumer i land on different CPUs whenever there are enough. */
+    for (uint32_t i = 0; (success) && (i < total); i++)
+    {
+        Contention_Thread * self = &Threads[i];
+        pthread_attr_t attr;
+
+        memset(self, 0, sizeof(*self));
+        self->shared = &shared;
+        self->producer = (i < producers);
+
+        if (((test == TEST_PING_PONG) && (self->producer)) || ((test == TEST_ONE_WAY) && (!self->producer)))
+        {
+            self->latencies = (uint64_t *)malloc(BENCH_CONTENTION_MAX_LATENCY_SAMPLES * sizeof(self->latencies[0]));
+            success = (self->latencies != NULL);
+        }
+
+        success = (success) && (pthread_attr_init(&attr) == 0);
+
+#if defined(__linux__)
+        if ((success) && (config->pin))
+        {
+            cpu_set_t cpus;
+            CPU_ZERO(&cpus);
+            CPU_SET(Cpu_List[i % config->cpus], &cpus);
+            (void)pthread_attr_setaffinity_np(&attr, sizeof(cpus), &cpus);
+        }
+#endif
+
+        if ((success) && (pthread_create(&self->thread, &attr, Thread_Main, self) == 0))
+        {
+            started++;
+        }
+        else
+        {
+            fprintf(stderr, "%s: unable to start thread %lu\n", queue->name, (unsigned long)i);
+            success = false;
+        }
+        (void)pthread_attr_destroy(&attr);
+    }
+
+    if (success)
+    {
+        while (__atomic_load_n(&shared.ready, __ATOMIC_ACQUIRE) < total)
+        {
+            (void)sched_yield();
+        }
+
+        __atomic_store_n(&shared.phase, PHASE_WARMUP, __ATOMIC_RELEASE);
+        Sleep_Ms(config->warmup_ms);
+        start = Now_Ns();
+        __atomic_store_n(&shared.phase, PHASE_MEASURE, __ATOMIC_RELEASE);
+        Sleep_Ms(config->duration_ms);
+        end = Now_Ns();
+    }
+
+    __atomic_store_n(&shared.phase, PHASE_STOP, __ATOMIC_RELEASE);
+    for (uint32_t i = 0; i < started; i++)
+    {
+        (void)pthread_join(Threads[i].thread, NULL);
+
+        pushed += Threads[i].pushed;
+        popped += Threads[i].popped;
+        if (Threads[i].producer)
+        {
+            producer_ops += Threads[i].ops;
+            producer_retries += Threads[i].retries;
+        }
+        else
+        {
+            consumer_ops += Threads[i].ops;
+            consumer_retries += Threads[i].retries;
+        }
+    }
+
+    if (success)
+    {
+        /* Every element pushed must either have been popped or still be in a queue. */
+        while ((shared.request) && (queue->try_pop(shared.request, &value)))
+        {
+            popped++;
+        }
+        while ((shared.reply) && (queue->try_pop(shared.reply, &value)))
+        {
+            popped++;
+        }
+
+        if (pushed != popped)
+        {
+            fprintf(stderr, "%s/%s: %llu elements pushed but %llu popped\n", queue->name, Test_Names[test],
+                    (unsigned long long)pushed, (unsigned long long)popped);
+            success = false;
+        }
+
+        result->seconds = (double)(end - start) / 1e9;
+        result->ops = (test == TEST_PING_PONG) ? producer_ops : consumer_ops;
+        result->full_per_push = (producer_ops) ? (double)producer_retries / (double)producer_ops : 0.0;
+        result->empty_per_pop = (consumer_ops) ? (double)consumer_retries / (double)consumer_ops : 0.0;
+        result->ns_per_op = (result->ops) ? (result->seconds * 1e9) / (double)result->ops : 0.0;
+        result->oversubscribed = (total > config->cpus);
+        success = (Compute_Latency(result, total)) && (success);
+    }
+
+    for (uint32_t i = 0; i < total; i++)
+    {
+        free(Threads[i].latencies);
+        Threads[i].latencies = NULL;
+    }
+
+    if (shared.request)
+    {
+        queue->destroy(shared.request);
+    }
+    if (shared.reply)
+    {
+        queue->destroy(shared.reply);
+    }
+
+    return success;
+}
+
+
+/**
+ * @brief Writes a single data point in the configured format. @p results holds every repetition and @p median the
+ * repetition with the median ns_per_op, whose throughput and latencies stand for the data point. CSV has one row
+ * per repetition and JSON lists every ns_per_op as a sample, the schema bench_compare.py reads. A human readable table
+ * of the median is additionally written to stdout whenever results are going to a file.
+ */
+static void Report_Result(Bench_Contention_Config * config, const char * name, const Bench_Queue_Ops * queue,
+                          Contention_Test test, uint32_t producers, uint32_t consumers, const Contention_Result * results,
+                          const Contention_Result * median);
+static void Report_Result(Bench_Contention_Config * config, const char * name, const Bench_Queue_Ops * queue,
+                          Contention_Test test, uint32_t producers, uint32_t consumers, const Contention_Result * results,
+                          const Contention_Result * median)
+{
+    FILE * out = config->output;
+    double ops_per_sec = (median->seconds > 0.0) ? (double)median->ops / median->seconds : 0.0;
+
+    if ((config->format == BENCH_FORMAT_TABLE) || (out != stdout))
+    {
+        printf("%-52s %10.3f %8.2f %8.2f", name, ops_per_sec / 1e6, median->full_per_push, median->empty_per_pop);
+        if (median->latency_samples)
+        {
+            printf(" %9llu %9llu %9llu %9llu", (unsigned long long)median->p50, (unsigned long long)median->p99,
+                   (unsigned long long)median->p999, (unsigned long long)median->max);
+        }
+        else
+        {
+            printf(" %9s %9s %9s %9s", "-", "-", "-", "-");
+        }
+        printf("%s\n", (median->oversubscribed) ? "  (oversubscribed)" : "");
+    }
+
+    if (config->format == BENCH_FORMAT_CSV)
+    {
+        for (uint32_t i = 0; i < config->repetitions; i++)
+        {
+            const Contention_Result * result = &results[i];
+            double rate = (result->seconds > 0.0) ? (double)result->ops / result->seconds : 0.0;
+
+            fprintf(out, "%s,%lu,%s,%s,%lu,%lu,%d,%d,%.6f,%llu,%.4f,%.2f,%.4f,%.4f,%llu,%llu,%llu,%llu,%llu,%llu\n", name,
+                    (unsigned long)i, queue->name, Test_Names[test], (unsigned long)producers, (unsigned long)consumers,
+                    (int)config->pin, (int)result->oversubscribed, result->seconds, (unsigned long long)result->ops,
+                    result->ns_per_op, rate, result->full_per_push, result->empty_per_pop,
+                    (unsigned long long)result->latency_samples, (unsigned long long)result->p50,
+                    (unsigned long long)result->p90, (unsigned long long)result->p99, (unsigned long long)result->p999,
+                    (unsigned long long)result->max);
+        }
+    }
+    else if (config->format == BENCH_FORMAT_JSON)
+    {
+        fprintf(out, "%s\n    {\"name\": \"%s\", \"queue\": \"%s\", \"test\": \"%s\", \"producers\": %lu, \"consumers\": %lu, "
+                "\"oversubscribed\": %s, \"seconds\": %.6f, \"ops\": %llu, \"ops_per_sec\": %.2f, \"full_per_push\": %.4f, "
+                "\"empty_per_pop\": %.4f", (config->cases_reported) ? "," : "", name, queue->name, Test_Names[test],
+                (unsigned long)producers, (unsigned long)consumers, (median->oversubscribed) ? "true" : "false",
+                median->seconds, (unsigned long long)median->ops, ops_per_sec, median->full_per_push, median->empty_per_pop);
+
+        if (median->latency_samples)
+        {
+            fprintf(out, ", \"latency_ns\": {\"samples\": %llu, \"p50\": %llu, \"p90\": %llu, \"p99\": %llu, \"p999\": %llu, "
+                    "\"max\": %llu}", (unsigned long long)median->latency_samples, (unsigned long long)median->p50,
+                    (unsigned long long)median->p90, (unsigned long long)median->p99, (unsigned long long)median->p999,
+                    (unsigned long long)median->max);
+        }
+
+        fprintf(out, ", \"median\": %.4f, \"samples\": [", median->ns_per_op);
+        for (uint32_t i = 0; i < config->repetitions; i++)
+        {
+            fprintf(out, "%s%.4f", (i) ? ", " : "", results[i].ns_per_op);
+        }
+        fprintf(out, "]}");
+    }
+
+    config->cases_reported++;
+}
+
+
+/**
+ * @brief Measures a single data point --repetitions times and reports it, unless it is filtered out or unsupported
+ * by @p queue.
+ *
+ * @return False if the data point ran and failed.
+ */
+static bool Run_Point(Bench_Contention_Config * config, const Bench_Queue_Ops * queue, Contention_Test test,
+                      uint32_t producers, uint32_t consumers);
+static bool Run_Point(Bench_Contention_Config * config, const Bench_Queue_Ops * queue, Contention_Test test,
+                      uint32_t producers, uint32_t consumers)
+{
+    static Contention_Result results[BENCH_MAX_REPETITIONS];
+    static Contention_Result sorted[BENCH_MAX_REPETITIONS];
+    char name[BENCH_NAME_MAX_LENGTH];
+    bool success = true;
+
+    (void)snprintf(name, sizeof(name), "%s/%s/p=%lu/c=%lu", queue->name, Test_Names[test],
+                   (unsigned long)producers, (unsigned long)consumers);
+
+    if (((queue->max_producers) && (producers > queue->max_producers)) ||
+        ((queue->max_consumers) && (consumers > queue->max_consumers)) ||
+        ((config->filter) && (!strstr(name, config->filter))))
+    {
+        /* Unsupported or filtered out. Nothing to do. */
+    }
+    else
+    {
+        for (uint32_t i = 0; (i < config->repetitions) && (success); i++)
+        {
+            success = Measure(config, queue, test, producers, consumers, &results[i]);
+        }
+
+        if (success)
+        {
+            memcpy(sorted, results, config->repetitions * sizeof(results[0]));
+            qsort(sorted, (size_t)config->repetitions, sizeof(sorted[0]), Compare_Ns_Per_Op);
+            Report_Result(config, name, queue, test, producers, consumers, results, &sorted[(config->repetitions - 1) / 2]);
+        }
+        else
+        {
+            fprintf(stderr, "%s: failed\n", name);
+        }
+    }
+
+    return success;
+}
+
+
+/**
+ * @brief Returns the number of CPUs this process may run on and fills Cpu_List with their IDs.
+ */
+static uint32_t Discover_Cpus(void);
+static uint32_t Discover_Cpus(void)
+{
+    uint32_t count = 0;
+
+#if defined(__linux__)
+    cpu_set_t cpus;
+    if (sched_getaffinity(0, sizeof(cpus), &cpus) == 0)
+    {
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+        {
+            if (CPU_ISSET(cpu, &cpus))
+            {
+                Cpu_List[count++] = cpu;
+            }
+        }
+    }
+#endif
+
+    return (count) ? count : 1;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ PUBLIC FUNCTIONS ---------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+bool Bench_Contention_Begin(Bench_Contention_Config * config, int argc, char ** argv)
+{
+    bool success = true;
+
+    config->format = BENCH_FORMAT_TABLE;
+    config->output = stdout;
+    config->output_path = NULL;
+    config->filter = NULL;
+    config->label = "";
+    config->duration_ms = BENCH_CONTENTION_DEFAULT_DURATION_MS;
+    config->warmup_ms = BENCH_CONTENTION_DEFAULT_WARMUP_MS;
+    config->capacity = BENCH_CONTENTION_DEFAULT_CAPACITY;
+    config->interval_ns = BENCH_CONTENTION_DEFAULT_INTERVAL_NS;
+    config->repetitions = BENCH_CONTENTION_DEFAULT_REPETITIONS;
+    config->cpus = Discover_Cpus();
+    config->pin = true;
+    config->cases_reported = 0;
+
+    /* Default to one producer and one consumer per pair of CPUs. */
+    config->max_threads = (config->cpus >= 2) ? (config->cpus / 2) : 1;
+    if (config->max_threads > BENCH_CONTENTION_MAX_THREADS)
+    {
+        config->max_threads = BENCH_CONTENTION_MAX_THREADS;
+    }
+
+    for (int i = 1; (i < argc) && (success); i++)
+    {
+        const char * value;
+        unsigned long number;
+
+        if (strcmp(argv[i], "--no-pin") == 0)
+        {
+            config->pin = false;
+        }
+        else if ((value = Bench_Arg_Value(argv[i], "--format")))
+        {
+            if (strcmp(value, "table") == 0)        { config->format = BENCH_FORMAT_TABLE; }
+            else if (strcmp(value, "csv") == 0)     { config->format = BENCH_FORMAT_CSV; }
+            else if (strcmp(value, "json") == 0)    { config->format = BENCH_FORMAT_JSON; }
+            else                                    { success = false; }
+        }
+        else if ((value = Bench_Arg_Value(argv[i], "--output")))
+        {
+            config->output_path = value;
+        }
+        else if ((value = Bench_Arg_Value(argv[i], "--filter")))
+        {
+            config->filter = value;
+        }
+        else if ((value = Bench_Arg_Value(argv[i], "--label")))
+        {
+            config->label = value;
+        }
+        else if ((value = Bench_Arg_Value(argv[i], "--duration-ms")) && Bench_Arg_Unsigned(value, &number) && (number > 0))
+        {
+            config->duration_ms = (uint32_t)number;
+        }
+        else if ((value = Bench_Arg_Value(argv[i], "--warmup-ms")) && Bench_Arg_Unsigned(value, &number))
+        {
+            config->warmup_ms = (uint32_t)number;
+        }
+        else if ((value = Bench_Arg_Value(argv[i], "--max-threads")) && Bench_Arg_Unsigned(value, &number) &&
+                 (number > 0) && (number <= BENCH_CONTENTION_MAX_THREADS))
+        {
+            config->max_threads = (uint32_t)number;
+        }
+        else if ((value = Bench_Arg_Value(argv[i], "--capacity")) && Bench_Arg_Unsigned(value, &number) && (number > 0))
+        {
+            config->capacity = (uint32_t)number;
+        }
+        else if ((value = Bench_Arg_Value(argv[i], "--interval-ns")) && Bench_Arg_Unsigned(value, &number))
+        {
+            config->interval_ns = (uint32_t)number;
+        }
+        else if ((value = Bench_Arg_Value(argv[i], "--repetitions")) && Bench_Arg_Unsigned(value, &number) &&
+                 (number > 0) && (number <= BENCH_MAX_REPETITIONS))
+        {
+            config->repetitions = (uint32_t)number;
+        }
+        else if ((strcmp(argv[i], "--counters") == 0) || (Bench_Arg_Value(argv[i], "--timer")) ||
+                 (Bench_Arg_Value(argv[i], "--warmup")) || (Bench_Arg_Value(argv[i], "--min-sample-us")))
+        {
+            /* Single-thread Harness argument. Ignored. */
+        }
+        else
+        {
+            success = false;
+        }
+
+        if (!success)
+        {
+            fprintf(stderr, "Invalid argument: %s\n", argv[i]);
+        }
+    }
+
+    if ((success) && (config->output_path))
+    {
+        config->output = fopen(config->output_path, "w");
+        if (!config->output)
+        {
+            fprintf(stderr, "Unable to open %s\n", config->output_path);
+            success = false;
+        }
+    }
+
+#if !defined(__linux__)
+    config->pin = false;
+#endif
+
+    if (success)
+    {
+        if ((config->format == BENCH_FORMAT_TABLE) || (config->output != stdout))
+        {
+            printf("%lu CPUs, %s, %lu x %lu ms per point (median shown)\n", (unsigned long)config->cpus,
+                   (config->pin) ? "pinned" : "not pinned", (unsigned long)config->repetitions,
+                   (unsigned long)config->duration_ms);
+            printf("%-52s %10s %8s %8s %9s %9s %9s %9s\n", "benchmark", "Mops/s", "full/op", "empty/op",
+                   "p50 ns", "p99 ns", "p99.9 ns", "max ns");
+        }
+
+        if (config->format == BENCH_FORMAT_CSV)
+        {
+            fprintf(config->output, "benchmark,repetition,queue,test,producers,consumers,pinned,oversubscribed,seconds,ops,"
+                    "ns_per_op,ops_per_sec,full_per_push,empty_per_pop,latency_samples,p50_ns,p90_ns,p99_ns,p999_ns,max_ns\n");
+        }
+        else if (config->format == BENCH_FORMAT_JSON)
+        {
+            fprintf(config->output, "{\n  \"label\": \"%s\",\n  \"cpus\": %lu,\n  \"pinned\": %s,\n  \"duration_ms\": %lu,\n"
+                    "  \"warmup_ms\": %lu,\n  \"repetitions\": %lu,\n  \"capacity\": %lu,\n  \"interval_ns\": %lu,\n"
+                    "  \"unit\": \"ns\",\n  \"benchmarks\": [", config->label, (unsigned long)config->cpus,
+                    (config->pin) ? "true" : "false", (unsigned long)config->duration_ms, (unsigned long)config->warmup_ms,
+                    (unsigned long)config->repetitions, (unsigned long)config->capacity, (unsigned long)config->interval_ns);
+        }
+    }
+
+    return success;
+}
+
+
+bool Bench_Contention_Run(Bench_Contention_Config * config, const Bench_Queue_Ops * queue)
+{
+    bool success = true;
+
+    /* Scaling curves: balanced, many producers into one consumer, and one producer into many consumers. */
+    for (uint32_t n = 1; n <= config->max_threads; n *= 2)
+    {
+        success &= Run_Point(config, queue, TEST_THROUGHPUT, n, n);
+        if (n > 1)
+        {
+            success &= Run_Point(config, queue, TEST_THROUGHPUT, n, 1);
+            success &= Run_Point(config, queue, TEST_THROUGHPUT, 1, n);
+        }
+    }
+
+    success &= Run_Point(config, queue, TEST_PING_PONG, 1, 1);
+
+    for (uint32_t n = 1; n <= config->max_threads; n *= 2)
+    {
+        success &= Run_Point(config, queue, TEST_ONE_WAY, n, n);
+    }
+
+    return success;
+}
+
+
+int Bench_Contention_End(Bench_Contention_Config * config)
+{
+    if (config->format == BENCH_FORMAT_JSON)
+    {
+        fprintf(config->output, "\n  ]\n}\n");
+    }
+
+    if (config->output != stdout)
+    {
+        (void)fclose(config->output);
+        config->output = stdout;
+    }
+
+    return EXIT_SUCCESS;
+}
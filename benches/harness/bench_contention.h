@@ -0,0 +1,165 @@
+/**
+ * @file bench_contention.h
+ * @author agent
+ * @brief Multi-threaded contention Harness for concurrent queues. Single-thread ns/op says nothing about how a
+ * queue behaves once producers and consumers sit on different cores, so this Harness runs a queue with N producer
+ * and M consumer threads (each pinned to its own CPU when possible) for a fixed wall-clock duration and reports:
+ *
+ * throughput   Producers push as fast as they can and consumers pop as fast as they can. Reports operations per
+ *              second and how often a push found the queue full or a pop found it empty.
+ * ping_pong    One thread pushes a timestamp into a request queue and waits for it to come back on a reply queue.
+ *              Reports the round-trip latency distribution.
+ * one_way      Producers push their current timestamp at a fixed interval and consumers record how long each
+ *              element spent in the queue. Reports the one-way latency distribution.
+ *
+ * Throughput and one-way tests are swept over thread counts 1, 2, 4, ... up to --max-threads so the results form
+ * scaling curves. Any queue can be measured by describing it with a Bench_Queue_Ops table. Elements are always a
+ * uint64_t so one-way latency can carry a timestamp.
+ *
+ * Typical usage in a Benchmark executable:
+ *
+ * int main(int argc, char ** argv)
+ * {
+ *      Bench_Contention_Config config;
+ *
+ *      if (!Bench_Contention_Begin(&config, argc, argv)) { return EXIT_FAILURE; }
+ *      (void)Bench_Contention_Run(&config, &some_queue_ops);
+ *      return Bench_Contention_End(&config);
+ * }
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#ifndef BENCH_CONTENTION_H_
+#define BENCH_CONTENTION_H_
+
+
+/* STD-C Libraries */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/* Benchmark Harness */
+#include "bench.h"
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ HARNESS LIMITS -----------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Maximum number of producer (or consumer) threads in a single measurement.
+ */
+#define BENCH_CONTENTION_MAX_THREADS                                        32
+
+
+/**
+ * @brief Number of latency samples each thread keeps. Older samples are overwritten so the reported
+ * distribution always covers the end of the measurement.
+ */
+#define BENCH_CONTENTION_MAX_LATENCY_SAMPLES                                (1UL << 16)
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ QUEUE INTERFACE ----------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Describes a queue to the Harness. try_push and try_pop are called concurrently from every producer and
+ * consumer thread and must never block for longer than it takes to complete the operation. The Harness retries
+ * (spinning, then yielding) when they return false.
+ */
+typedef struct
+{
+    const char * name;                                      /* Prefix of every result, i.e. "mutex_ring_buffer_static". */
+    void * (*create)(uint32_t capacity);                    /* Returns NULL if @p capacity elements are not supported. */
+    void (*destroy)(void * queue);
+    bool (*try_push)(void * queue, uint64_t value);         /* False if the queue is full. */
+    bool (*try_pop)(void * queue, uint64_t * value);        /* False if the queue is empty. */
+    uint32_t max_producers;                                 /* 1 for SPSC/SPMC queues. 0 if unlimited. */
+    uint32_t max_consumers;                                 /* 1 for SPSC/MPSC queues. 0 if unlimited. */
+} Bench_Queue_Ops;
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------------- CONFIGURATION TYPES ----------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Harness configuration. Filled with defaults and command line overrides by Bench_Contention_Begin().
+ */
+typedef struct
+{
+    Bench_Format format;
+    FILE * output;                      /* Where results in the selected format are written. */
+    const char * output_path;           /* NULL when writing to stdout. */
+    const char * filter;                /* Only measurements whose name contains this substring run. NULL runs all. */
+    const char * label;                 /* Free-form label (i.e. commit hash) stored with the results. */
+    uint32_t duration_ms;               /* Measured duration of every data point. */
+    uint32_t warmup_ms;                 /* Threads run for this long before measurement starts. */
+    uint32_t repetitions;               /* Times every data point is measured. Must be <= BENCH_MAX_REPETITIONS. */
+    uint32_t max_threads;               /* Largest number of producers (and of consumers) in a scaling curve. */
+    uint32_t capacity;                  /* Number of elements passed to Bench_Queue_Ops.create. */
+    uint32_t interval_ns;               /* Delay between pushes of each producer in the one_way test. */
+    uint32_t cpus;                      /* Number of CPUs this process may run on. */
+    bool pin;                           /* Pin every thread to its own CPU. */
+    uint32_t cases_reported;            /* Internal. Number of data points reported so far. */
+} Bench_Contention_Config;
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------------- PUBLIC FUNCTIONS -------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Fills @p config with defaults, applies command line overrides and writes the start of the report.
+ * Supported arguments:
+ *
+ * --format=table|csv|json  --output=FILE  --filter=SUBSTRING  --label=TEXT  --duration-ms=N  --warmup-ms=N
+ * --repetitions=N  --max-threads=N  --capacity=N  --interval-ns=N  --no-pin
+ *
+ * Every data point is measured --repetitions times. Its wall-clock ns per op of each repetition is reported as a
+ * sample, in the same JSON and CSV schema as the single-thread Harness, so runs can be compared with
+ * bench_compare.py. Arguments that only apply to the single-thread Harness (--timer, --warmup, --min-sample-us and
+ * --counters) are accepted and ignored so the same BENCH_ARGS can be passed to every Benchmark.
+ *
+ * @param config Configuration to initialize.
+ * @param argc Argument count passed to main().
+ * @param argv Argument vector passed to main().
+ *
+ * @return True if successful. False if an argument was invalid or the output file could not be opened.
+ */
+bool Bench_Contention_Begin(Bench_Contention_Config * config, int argc, char ** argv);
+
+
+/**
+ * @brief Runs every test and thread count that @p queue supports and reports each data point.
+ *
+ * @param config Configuration returned by Bench_Contention_Begin().
+ * @param queue Queue to measure.
+ *
+ * @return True if every data point ran. False if the queue could not be created, a thread could not be
+ * started or elements were lost (pushed but never popped).
+ */
+bool Bench_Contention_Run(Bench_Contention_Config * config, const Bench_Queue_Ops * queue);
+
+
+/**
+ * @brief Writes the end of the report and closes the output file.
+ *
+ * @param config Configuration returned by Bench_Contention_Begin().
+ *
+ * @return EXIT_SUCCESS so it can be returned directly from main().
+ */
+int Bench_Contention_End(Bench_Contention_Config * config);
+
+
+#endif /* BENCH_CONTENTION_H_ */
@@ -0,0 +1,241 @@
+/**
+ * @file bench_counters.c
+ * @author agent
+ * @brief Optional Hardware Performance Counter capture for the Benchmark Harness. See bench_counters.h for
+ * more details.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+/* syscall() is not declared in strict POSIX mode. Must come before any system header. */
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+    #define _GNU_SOURCE
+#endif
+
+/* Translation Unit */
+#include "bench_counters.h"
+
+/* STD-C Libraries */
+#include <stddef.h>     /* size_t */
+
+#if defined(__linux__)
+    #include <linux/perf_event.h>
+    #include <string.h>         /* memset */
+    #include <sys/ioctl.h>      /* ioctl */
+    #include <sys/syscall.h>    /* __NR_perf_event_open */
+    #include <unistd.h>         /* syscall, read, close */
+#endif
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------- COUNTER STATE -----------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+static const char * const Counter_Names[BENCH_COUNTER_COUNT] =
+{
+    "cycles",
+    "instructions",
+    "l1d_misses",
+    "branch_misses"
+};
+
+#if defined(__linux__)
+
+    /**
+     * @brief perf_event type and config of each Bench_Counter.
+     */
+    static const struct
+    {
+        uint32_t type;
+        uint64_t config;
+    } Counter_Events[BENCH_COUNTER_COUNT] =
+    {
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+        {PERF_TYPE_HW_CACHE, (PERF_COUNT_HW_CACHE_L1D) | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES}
+    };
+
+
+    /**
+     * @brief Layout returned by read() on the group leader with PERF_FORMAT_GROUP | PERF_FORMAT_ID |
+     * PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING.
+     */
+    struct Group_Read_t
+    {
+        uint64_t nr;
+        uint64_t time_enabled;
+        uint64_t time_running;
+        struct
+        {
+            uint64_t value;
+            uint64_t id;
+        } values[BENCH_COUNTER_COUNT];
+    };
+
+    static int Counter_Fds[BENCH_COUNTER_COUNT] = {-1, -1, -1, -1};
+    static uint64_t Counter_Ids[BENCH_COUNTER_COUNT];
+    static int Leader_Fd = -1;
+
+#endif
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ PUBLIC FUNCTIONS ---------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+bool Bench_Counters_Open(void)
+{
+#if defined(__linux__)
+    Bench_Counters_Close();
+
+    for (uint32_t i = 0; i < BENCH_COUNTER_COUNT; i++)
+    {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = Counter_Events[i].type;
+        attr.config = Counter_Events[i].config;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        /* Only the leader starts disabled. Members follow the leader when it is enabled. */
+        attr.disabled = (Leader_Fd < 0) ? 1 : 0;
+
+        int fd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, Leader_Fd, 0);
+        if (fd >= 0)
+        {
+            if (ioctl(fd, PERF_EVENT_IOC_ID, &Counter_Ids[i]) == 0)
+            {
+                Counter_Fds[i] = fd;
+                if (Leader_Fd < 0)
+                {
+                    Leader_Fd = fd;
+                }
+            }
+            else
+            {
+                (void)close(fd);
+            }
+        }
+    }
+
+    return (Leader_Fd >= 0);
+#else
+    return false;
+#endif
+}
+
+
+void Bench_Counters_Close(void)
+{
+#if defined(__linux__)
+    /* Close members before the leader. */
+    for (int i = BENCH_COUNTER_COUNT - 1; i >= 0; i--)
+    {
+        if ((Counter_Fds[i] >= 0) && (Counter_Fds[i] != Leader_Fd))
+        {
+            (void)close(Counter_Fds[i]);
+        }
+        Counter_Fds[i] = -1;
+    }
+
+    if (Leader_Fd >= 0)
+    {
+        (void)close(Leader_Fd);
+        Leader_Fd = -1;
+    }
+#endif
+}
+
+
+bool Bench_Counters_Available(Bench_Counter counter)
+{
+#if defined(__linux__)
+    return (counter < BENCH_COUNTER_COUNT) && (Counter_Fds[counter] >= 0);
+#else
+    (void)counter;
+    return false;
+#endif
+}
+
+
+const char * Bench_Counters_Name(Bench_Counter counter)
+{
+    return (counter < BENCH_COUNTER_COUNT) ? Counter_Names[counter] : "unknown";
+}
+
+
+void Bench_Counters_Reset(void)
+{
+#if defined(__linux__)
+    if (Leader_Fd >= 0)
+    {
+        (void)ioctl(Leader_Fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+}
+
+
+void Bench_Counters_Enable(void)
+{
+#if defined(__linux__)
+    if (Leader_Fd >= 0)
+    {
+        (void)ioctl(Leader_Fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+}
+
+
+void Bench_Counters_Disable(void)
+{
+#if defined(__linux__)
+    if (Leader_Fd >= 0)
+    {
+        (void)ioctl(Leader_Fd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+}
+
+
+bool Bench_Counters_Read(uint64_t values[BENCH_COUNTER_COUNT])
+{
+    bool success = false;
+
+    for (uint32_t i = 0; i < BENCH_COUNTER_COUNT; i++)
+    {
+        values[i] = 0;
+    }
+
+#if defined(__linux__)
+    struct Group_Read_t group;
+
+    if ((Leader_Fd >= 0) && (read(Leader_Fd, &group, sizeof(group)) > 0) && (group.time_running > 0))
+    {
+        /* Scale up if the group only ran for part of the time it was enabled (multiplexing). */
+        double scale = (double)group.time_enabled / (double)group.time_running;
+
+        for (uint64_t v = 0; (v < group.nr) && (v < BENCH_COUNTER_COUNT); v++)
+        {
+            for (uint32_t i = 0; i < BENCH_COUNTER_COUNT; i++)
+            {
+                if ((Counter_Fds[i] >= 0) && (Counter_Ids[i] == group.values[v].id))
+                {
+                    values[i] = (uint64_t)((double)group.values[v].value * scale);
+                }
+            }
+        }
+        success = true;
+    }
+#endif
+
+    return success;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file bench_counters.h
+ * @author agent
+ * @brief Optional Hardware Performance Counter capture for the Benchmark Harness. On Linux the counters are opened
+ * with perf_event_open() as a single group (so they are scheduled onto the PMU together) and only count user-space
+ * events of the calling thread. The Harness enables the group at the start of every measured region and disables it
+ * at the end, so counter values cover exactly the same code as the reported time.
+ *
+ * Counters are best-effort. Containers, VMs and kernels with a restrictive perf_event_paranoid setting often
+ * refuse some or all events. Any counter that cannot be opened is reported as unavailable and the Benchmarks run
+ * exactly as they would without counters.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#ifndef BENCH_COUNTERS_H_
+#define BENCH_COUNTERS_H_
+
+
+/* STD-C Libraries */
+#include <stdbool.h>
+#include <stdint.h>
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*--------------------------------------------------------- COUNTERS --------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Hardware Performance Counters the Harness can capture.
+ */
+typedef enum
+{
+    BENCH_COUNTER_CYCLES,
+    BENCH_COUNTER_INSTRUCTIONS,
+    BENCH_COUNTER_L1D_MISSES,           /* L1 Data Cache read misses. */
+    BENCH_COUNTER_BRANCH_MISSES,
+
+    /********************/
+    BENCH_COUNTER_COUNT
+} Bench_Counter;
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------------- PUBLIC FUNCTIONS -------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Opens every supported counter in a disabled state.
+ *
+ * @return True if at least one counter is available. False if none could be opened (i.e. non-Linux host,
+ * perf_event_paranoid too strict, or no PMU exposed to the container).
+ */
+bool Bench_Counters_Open(void);
+
+
+/**
+ * @brief Closes every open counter. Safe to call if Bench_Counters_Open() failed.
+ */
+void Bench_Counters_Close(void);
+
+
+/**
+ * @brief Returns true if @p counter was opened successfully.
+ */
+bool Bench_Counters_Available(Bench_Counter counter);
+
+
+/**
+ * @brief Returns a short name for @p counter. Used as the key in CSV and JSON results.
+ */
+const char * Bench_Counters_Name(Bench_Counter counter);
+
+
+/**
+ * @brief Zeros every counter. Called by the Harness before each sample.
+ */
+void Bench_Counters_Reset(void);
+
+
+/**
+ * @brief Starts counting. Called by the Harness at the start of a measured region.
+ */
+void Bench_Counters_Enable(void);
+
+
+/**
+ * @brief Stops counting. Called by the Harness at the end of a measured region.
+ */
+void Bench_Counters_Disable(void);
+
+
+/**
+ * @brief Reads the accumulated value of every counter. Values are scaled up if the kernel had to
+ * multiplex the group with other events. Unavailable counters read as 0.
+ *
+ * @param values Filled with one value per Bench_Counter.
+ *
+ * @return True if the counters were read successfully.
+ */
+bool Bench_Counters_Read(uint64_t values[BENCH_COUNTER_COUNT]);
+
+
+#endif /* BENCH_COUNTERS_H_ */
@@ -0,0 +1,76 @@
+/**
+ * @file bench_cycles.c
+ * @author agent
+ * @brief Cycle Counter used by the Benchmark Harness. See bench_cycles.h for more details.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+/* Translation Unit */
+#include "bench_cycles.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>  /* __rdtsc, _mm_lfence */
+    #define BENCH_CYCLES_RDTSC_
+#endif
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------- COUNTER STATE -----------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+typedef enum
+{
+    CYCLES_SOURCE_NONE,
+    CYCLES_SOURCE_RDTSC
+} Cycles_Source;
+
+static Cycles_Source Selected_Source = CYCLES_SOURCE_NONE;
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ PUBLIC FUNCTIONS ---------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+bool Bench_Cycles_Init(void)
+{
+#if defined(BENCH_CYCLES_RDTSC_)
+    Selected_Source = CYCLES_SOURCE_RDTSC;
+#endif
+
+    return (Selected_Source != CYCLES_SOURCE_NONE);
+}
+
+
+uint64_t Bench_Cycles_Read(void)
+{
+    uint64_t cycles = 0;
+
+#if defined(BENCH_CYCLES_RDTSC_)
+    /* lfence keeps earlier instructions from being reordered past the Time Stamp Counter read. */
+    _mm_lfence();
+    cycles = __rdtsc();
+#endif
+
+    return cycles;
+}
+
+
+const char * Bench_Cycles_Source(void)
+{
+    static const char * const names[] = { "none", "rdtsc" };
+    return names[Selected_Source];
+}
+
+
+const char * Bench_Cycles_Unit(void)
+{
+    static const char * const units[] = { "cycles", "tsc_ticks" };
+    return units[Selected_Source];
+}
@@ -0,0 +1,59 @@
+/**
+ * @file bench_cycles.h
+ * @author agent
+ * @brief Cycle Counter used by the Benchmark Harness for --timer=cycles and --timer=rdtsc. One interface, with the
+ * counter chosen when the Harness is compiled:
+ *
+ * x86          rdtsc. Counts Time Stamp Counter ticks at a constant reference rate, which is not the core clock when
+ *              the core is boosted or throttled. Results are therefore labelled tsc_ticks, not cycles.
+ * Others       No Cycle Counter. Bench_Cycles_Init() returns false and the Harness falls back to clock_gettime.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#ifndef BENCH_CYCLES_H_
+#define BENCH_CYCLES_H_
+
+
+/* STD-C Libraries */
+#include <stdbool.h>
+#include <stdint.h>
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------------- PUBLIC FUNCTIONS -------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Starts the Cycle Counter of this target. Safe to call more than once.
+ *
+ * @return True if a Cycle Counter is available. False if Bench_Cycles_Read() cannot be used.
+ */
+bool Bench_Cycles_Init(void);
+
+
+/**
+ * @brief Returns the current value of the Cycle Counter. Only valid after Bench_Cycles_Init() returned true.
+ */
+uint64_t Bench_Cycles_Read(void);
+
+
+/**
+ * @brief Returns the name of the Cycle Counter in use ("rdtsc" or "none"). Stored with the results.
+ */
+const char * Bench_Cycles_Source(void);
+
+
+/**
+ * @brief Returns the unit the Cycle Counter counts in ("tsc_ticks" for rdtsc). Results of --timer=cycles are reported
+ * per operation in this unit.
+ */
+const char * Bench_Cycles_Unit(void);
+
+
+#endif /* BENCH_CYCLES_H_ */
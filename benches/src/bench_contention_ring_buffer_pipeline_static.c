@@ -0,0 +1,492 @@
+/**
+ * @file bench_contention_ring_buffer_pipeline_static.c
+ * @author agent
+ * @brief Throughput Benchmarks of a multi-step pipeline with 1 to 4 Stages, each Stage in its own thread. Compares
+ * the Pipeline Ring Buffer (ring_buffer_pipeline_static.h), where every Stage works in place on the slots of one Ring
+ * Buffer and waits on the sequence of the Stage before it, against a chain of mutex-wrapped Static Ring Buffers
+ * (ring_buffer_static.h), where every Stage reads a packet from its own Ring Buffer, works on a copy and writes it to
+ * the Ring Buffer of the next Stage.
+ *
+ * The thread calling the Benchmark is the producer. One operation is one packet published by the producer and
+ * processed by every Stage, so the time per operation is the inverse of the pipeline's throughput. Waiting threads
+ * yield, so the numbers are meaningful only with a CPU per thread.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+/* STD-C Libraries */
+#include <pthread.h>
+#include <sched.h>      /* sched_yield */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>      /* snprintf */
+#include <stdlib.h>     /* EXIT_FAILURE */
+#include <string.h>     /* memset */
+
+/* Benchmark Harness */
+#include "bench.h"
+
+/* Modules Under Test */
+#include "ring_buffer_pipeline_static.h"
+#include "ring_buffer_static.h"
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ BENCHMARK PARAMETERS -----------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Most Stages measured. Limited by the Stages of one Pipeline Ring Buffer and by the Static Ring Buffer pool,
+ * which provides one Ring Buffer per Stage.
+ */
+#define BENCH_MAX_STAGES                                                    \
+    ((RING_BUFFER_PIPELINE_STATIC_MAX_STAGES < NUMBER_OF_STATIC_RING_BUFFERS) ? RING_BUFFER_PIPELINE_STATIC_MAX_STAGES : NUMBER_OF_STATIC_RING_BUFFERS)
+
+
+/**
+ * @brief Bytes of packet each Stage transforms.
+ */
+#define BENCH_PAYLOAD_SIZE                                                  24
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ BENCHMARK CONTEXT --------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief The element passed through the pipeline.
+ */
+typedef struct
+{
+    uint32_t sequence;
+    uint32_t checksum;
+    uint8_t payload[BENCH_PAYLOAD_SIZE];
+} RBP_Bench_Packet;
+
+
+/**
+ * @brief A Stage thread. processed is on its own cache line since the producer polls the one of the last Stage.
+ */
+typedef struct
+{
+    uint64_t processed __attribute__((aligned(RING_BUFFER_PIPELINE_STATIC_CACHE_LINE)));      /* __atomic */
+    pthread_t thread;
+    uint32_t stage;
+    struct RBP_Bench_Ctx_t * ctx;
+} RBP_Bench_Stage;
+
+
+/**
+ * @brief State shared by every Benchmark Case. Only one Case runs at a time so a single instance is reused.
+ */
+typedef struct RBP_Bench_Ctx_t
+{
+    RBP_Bench_Stage stages[BENCH_MAX_STAGES];
+    Ring_Buffer_Pipeline_Static_Handle pipeline;
+    Ring_Buffer_Static_Handle copies[BENCH_MAX_STAGES];
+    pthread_mutex_t locks[BENCH_MAX_STAGES];
+    uint32_t number_of_stages;
+    uint32_t number_of_threads;         /* Stage threads started by setup. */
+    uint32_t number_of_locks;           /* Mutexes initialized by setup. */
+    uint64_t published;                 /* Packets published by the producer since setup. */
+    uint32_t failures;                  /* Number of operations that unexpectedly returned false. */
+    int stop;                           /* __atomic. Set by teardown to stop the Stage threads. */
+} RBP_Bench_Ctx;
+
+static RBP_Bench_Ctx Ctx;
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*--------------------------------------------------------- STAGES ----------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief The work of one Stage on a packet: folds the payload into the checksum and changes every byte.
+ */
+static void Process(RBP_Bench_Packet * packet, uint32_t stage);
+static void Process(RBP_Bench_Packet * packet, uint32_t stage)
+{
+    uint32_t checksum = packet->checksum;
+
+    for (uint32_t i = 0; i < BENCH_PAYLOAD_SIZE; i++)
+    {
+        checksum = (checksum * 31u) + packet->payload[i];
+        packet->payload[i] = (uint8_t)(packet->payload[i] + stage + 1u);
+    }
+
+    packet->checksum = checksum;
+}
+
+
+/**
+ * @brief True once teardown asked the Stage threads to stop.
+ */
+static bool Stopping(RBP_Bench_Ctx * ctx);
+static bool Stopping(RBP_Bench_Ctx * ctx)
+{
+    return __atomic_load_n(&ctx->stop, __ATOMIC_ACQUIRE) != 0;
+}
+
+
+/**
+ * @brief A Stage of the Pipeline Ring Buffer. Works on the packet in its slot.
+ */
+static void * Stage_Pipeline(void * arg);
+static void * Stage_Pipeline(void * arg)
+{
+    RBP_Bench_Stage * self = (RBP_Bench_Stage *)arg;
+    RBP_Bench_Ctx * ctx = self->ctx;
+
+    while (!Stopping(ctx))
+    {
+        void * slot;
+
+        if (Ring_Buffer_Pipeline_Static_Acquire(&ctx->pipeline, self->stage, &slot))
+        {
+            Process((RBP_Bench_Packet *)slot, self->stage);
+            (void)Ring_Buffer_Pipeline_Static_Release(&ctx->pipeline, self->stage);
+            __atomic_store_n(&self->processed, self->processed + 1, __ATOMIC_RELEASE);
+        }
+        else
+        {
+            (void)sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+
+/**
+ * @brief Writes a packet to the mutex-wrapped Static Ring Buffer of a Stage. Waits while it is full.
+ */
+static bool Copy_Write(RBP_Bench_Ctx * ctx, uint32_t ring, const RBP_Bench_Packet * packet);
+static bool Copy_Write(RBP_Bench_Ctx * ctx, uint32_t ring, const RBP_Bench_Packet * packet)
+{
+    bool success = false;
+
+    while ((!success) && (!Stopping(ctx)))
+    {
+        (void)pthread_mutex_lock(&ctx->locks[ring]);
+        success = Ring_Buffer_Static_Write(&ctx->copies[ring], packet, sizeof(*packet));
+        (void)pthread_mutex_unlock(&ctx->locks[ring]);
+
+        if (!success)
+        {
+            (void)sched_yield();
+        }
+    }
+
+    return success;
+}
+
+
+/**
+ * @brief A Stage of the chain of Static Ring Buffers. Reads a packet from its own Ring Buffer, works on the copy and
+ * writes it to the Ring Buffer of the next Stage.
+ */
+static void * Stage_Copy(void * arg);
+static void * Stage_Copy(void * arg)
+{
+    RBP_Bench_Stage * self = (RBP_Bench_Stage *)arg;
+    RBP_Bench_Ctx * ctx = self->ctx;
+    const bool last = (self->stage + 1u == ctx->number_of_stages);
+
+    while (!Stopping(ctx))
+    {
+        RBP_Bench_Packet packet;
+        bool success;
+
+        (void)pthread_mutex_lock(&ctx->locks[self->stage]);
+        success = Ring_Buffer_Static_Read(&ctx->copies[self->stage], &packet, sizeof(packet));
+        (void)pthread_mutex_unlock(&ctx->locks[self->stage]);
+
+        if (success)
+        {
+            Process(&packet, self->stage);
+
+            if ((last) || (Copy_Write(ctx, self->stage + 1u, &packet)))
+            {
+                __atomic_store_n(&self->processed, self->processed + 1, __ATOMIC_RELEASE);
+            }
+        }
+        else
+        {
+            (void)sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ SETUP AND TEARDOWN -------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+static void Teardown(void * context);
+
+
+/**
+ * @brief Number of packets either kind of Ring Buffer holds.
+ */
+static uint32_t Capacity(void);
+static uint32_t Capacity(void)
+{
+    const size_t size = (RING_BUFFER_STATIC_SIZE < RING_BUFFER_PIPELINE_STATIC_SIZE) ? RING_BUFFER_STATIC_SIZE : RING_BUFFER_PIPELINE_STATIC_SIZE;
+
+    return (uint32_t)(size / sizeof(RBP_Bench_Packet));
+}
+
+
+/**
+ * @brief Resets the Context and starts one thread per Stage running @p stage_fn.
+ */
+static bool Start_Stages(RBP_Bench_Ctx * ctx, void * (*stage_fn)(void *));
+static bool Start_Stages(RBP_Bench_Ctx * ctx, void * (*stage_fn)(void *))
+{
+    bool success = true;
+
+    for (uint32_t s = 0; (success) && (s < ctx->number_of_stages); s++)
+    {
+        ctx->stages[s].processed = 0;
+        ctx->stages[s].stage = s;
+        ctx->stages[s].ctx = ctx;
+        success = (pthread_create(&ctx->stages[s].thread, NULL, stage_fn, &ctx->stages[s]) == 0);
+        ctx->number_of_threads += success;
+    }
+
+    return success;
+}
+
+
+/**
+ * @brief Clears what the previous Case left in the Context.
+ */
+static void Reset(RBP_Bench_Ctx * ctx);
+static void Reset(RBP_Bench_Ctx * ctx)
+{
+    ctx->number_of_threads = 0;
+    ctx->number_of_locks = 0;
+    ctx->published = 0;
+    ctx->failures = 0;
+    ctx->stop = 0;
+}
+
+
+/**
+ * @brief Constructs the Pipeline Ring Buffer with the Case's Stages and starts their threads.
+ */
+static bool Setup_Pipeline(void * context);
+static bool Setup_Pipeline(void * context)
+{
+    RBP_Bench_Ctx * ctx = (RBP_Bench_Ctx *)context;
+    bool success;
+
+    Reset(ctx);
+
+    success = (Ring_Buffer_Pipeline_Static_Ctor(&ctx->pipeline, sizeof(RBP_Bench_Packet), Capacity(), ctx->number_of_stages)) &&
+              (Start_Stages(ctx, Stage_Pipeline));
+
+    if (!success)
+    {
+        /* Bench_Run() only calls teardown after a successful setup. */
+        Teardown(ctx);
+    }
+
+    return success;
+}
+
+
+/**
+ * @brief Constructs one mutex-wrapped Static Ring Buffer per Stage and starts their threads.
+ */
+static bool Setup_Copy(void * context);
+static bool Setup_Copy(void * context)
+{
+    RBP_Bench_Ctx * ctx = (RBP_Bench_Ctx *)context;
+    bool success = true;
+
+    Reset(ctx);
+
+    for (uint32_t s = 0; (success) && (s < ctx->number_of_stages); s++)
+    {
+        success = Ring_Buffer_Static_Ctor(&ctx->copies[s], sizeof(RBP_Bench_Packet), Capacity()) &&
+                  (pthread_mutex_init(&ctx->locks[s], NULL) == 0);
+        ctx->number_of_locks += success;
+    }
+
+    success = (success) && (Start_Stages(ctx, Stage_Copy));
+
+    if (!success)
+    {
+        Teardown(ctx);
+    }
+
+    return success;
+}
+
+
+/**
+ * @brief Stops and joins the Stage threads, destroys whatever the Case constructed and reports any operation that
+ * failed while measuring.
+ */
+static void Teardown(void * context);
+static void Teardown(void * context)
+{
+    RBP_Bench_Ctx * ctx = (RBP_Bench_Ctx *)context;
+
+    __atomic_store_n(&ctx->stop, 1, __ATOMIC_RELEASE);
+
+    for (uint32_t s = 0; s < ctx->number_of_threads; s++)
+    {
+        (void)pthread_join(ctx->stages[s].thread, NULL);
+    }
+
+    (void)Ring_Buffer_Pipeline_Static_Destroy(&ctx->pipeline);
+
+    for (uint32_t s = 0; s < BENCH_MAX_STAGES; s++)
+    {
+        (void)Ring_Buffer_Static_Destroy(&ctx->copies[s]);
+    }
+
+    for (uint32_t s = 0; s < ctx->number_of_locks; s++)
+    {
+        (void)pthread_mutex_destroy(&ctx->locks[s]);
+    }
+
+    if (ctx->failures)
+    {
+        fprintf(stderr, "WARNING: %lu operations failed while measuring. Results are invalid.\n", (unsigned long)ctx->failures);
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------------------- BENCHMARKS -------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Fills in the next packet of the producer.
+ */
+static void Produce(RBP_Bench_Ctx * ctx, RBP_Bench_Packet * packet);
+static void Produce(RBP_Bench_Ctx * ctx, RBP_Bench_Packet * packet)
+{
+    packet->sequence = (uint32_t)ctx->published++;
+    packet->checksum = 0;
+    memset(packet->payload, 0xA5, sizeof(packet->payload));
+}
+
+
+/**
+ * @brief Waits until the last Stage processed every packet the producer published.
+ */
+static void Drain(RBP_Bench_Ctx * ctx);
+static void Drain(RBP_Bench_Ctx * ctx)
+{
+    const RBP_Bench_Stage * last = &ctx->stages[ctx->number_of_stages - 1u];
+
+    while (__atomic_load_n(&last->processed, __ATOMIC_ACQUIRE) < ctx->published)
+    {
+        (void)sched_yield();
+    }
+}
+
+
+/**
+ * @brief Claims a slot, fills in the packet in place and publishes it, then waits for the last Stage.
+ */
+static uint64_t Run_Pipeline(void * context, uint32_t iterations);
+static uint64_t Run_Pipeline(void * context, uint32_t iterations)
+{
+    RBP_Bench_Ctx * ctx = (RBP_Bench_Ctx *)context;
+
+    uint64_t start = Bench_Ticks();
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        void * slot;
+
+        while (!Ring_Buffer_Pipeline_Static_Claim(&ctx->pipeline, &slot))
+        {
+            (void)sched_yield();
+        }
+
+        Produce(ctx, (RBP_Bench_Packet *)slot);
+        ctx->failures += !Ring_Buffer_Pipeline_Static_Publish(&ctx->pipeline);
+    }
+
+    Drain(ctx);
+
+    return Bench_Elapsed(start);
+}
+
+
+/**
+ * @brief Fills in a packet and writes it to the Ring Buffer of the first Stage, then waits for the last Stage.
+ */
+static uint64_t Run_Copy(void * context, uint32_t iterations);
+static uint64_t Run_Copy(void * context, uint32_t iterations)
+{
+    RBP_Bench_Ctx * ctx = (RBP_Bench_Ctx *)context;
+    RBP_Bench_Packet packet;
+
+    uint64_t start = Bench_Ticks();
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        Produce(ctx, &packet);
+        ctx->failures += !Copy_Write(ctx, 0, &packet);
+    }
+
+    Drain(ctx);
+
+    return Bench_Elapsed(start);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------------ MAIN ---------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+int main(int argc, char ** argv)
+{
+    Bench_Config config;
+    Bench_Case bench_case;
+    bool success = true;
+
+    if (!Bench_Begin(&config, argc, argv))
+    {
+        return EXIT_FAILURE;
+    }
+
+    bench_case.ctx = (void *)&Ctx;
+    bench_case.teardown = Teardown;
+
+    for (uint32_t stages = 1; stages <= BENCH_MAX_STAGES; stages++)
+    {
+        Ctx.number_of_stages = stages;
+
+        snprintf(bench_case.name, sizeof(bench_case.name), "pipeline/stages=%lu", (unsigned long)stages);
+        bench_case.setup = Setup_Pipeline;
+        bench_case.run = Run_Pipeline;
+        success &= Bench_Run(&config, &bench_case);
+
+        snprintf(bench_case.name, sizeof(bench_case.name), "copy/stages=%lu", (unsigned long)stages);
+        bench_case.setup = Setup_Copy;
+        bench_case.run = Run_Copy;
+        success &= Bench_Run(&config, &bench_case);
+    }
+
+    (void)Bench_End(&config);
+
+    return (success) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
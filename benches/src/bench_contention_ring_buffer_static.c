@@ -0,0 +1,135 @@
+/**
+ * @file bench_contention_ring_buffer_static.c
+ * @author agent
+ * @brief Multi-threaded contention Benchmarks for the Static Ring Buffer module. The Static Ring Buffer is not
+ * thread-safe, so every operation is wrapped in a pthread mutex. This is the baseline concurrent queues in this
+ * repository are compared against.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+/* STD-C Libraries */
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>     /* malloc, free, EXIT_FAILURE */
+
+/* Benchmark Harness */
+#include "bench_contention.h"
+
+/* Module Under Test */
+#include "ring_buffer_static.h"
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------- MUTEX WRAPPER -----------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief A Static Ring Buffer of uint64_t elements guarded by a single mutex.
+ */
+typedef struct
+{
+    pthread_mutex_t lock;
+    Ring_Buffer_Static_Handle me;
+} Mutex_Ring_Buffer;
+
+
+static void * Mutex_Ring_Buffer_Create(uint32_t capacity);
+static void * Mutex_Ring_Buffer_Create(uint32_t capacity)
+{
+    Mutex_Ring_Buffer * queue = (Mutex_Ring_Buffer *)malloc(sizeof(*queue));
+
+    if ((queue) && (!Ring_Buffer_Static_Ctor(&queue->me, sizeof(uint64_t), capacity)))
+    {
+        free(queue);
+        queue = NULL;
+    }
+
+    if ((queue) && (pthread_mutex_init(&queue->lock, NULL) != 0))
+    {
+        (void)Ring_Buffer_Static_Destroy(&queue->me);
+        free(queue);
+        queue = NULL;
+    }
+
+    return (void *)queue;
+}
+
+
+static void Mutex_Ring_Buffer_Destroy(void * queue);
+static void Mutex_Ring_Buffer_Destroy(void * queue)
+{
+    Mutex_Ring_Buffer * q = (Mutex_Ring_Buffer *)queue;
+
+    (void)pthread_mutex_destroy(&q->lock);
+    (void)Ring_Buffer_Static_Destroy(&q->me);
+    free(q);
+}
+
+
+static bool Mutex_Ring_Buffer_Try_Push(void * queue, uint64_t value);
+static bool Mutex_Ring_Buffer_Try_Push(void * queue, uint64_t value)
+{
+    Mutex_Ring_Buffer * q = (Mutex_Ring_Buffer *)queue;
+    bool success;
+
+    (void)pthread_mutex_lock(&q->lock);
+    success = Ring_Buffer_Static_Write(&q->me, &value, sizeof(value));
+    (void)pthread_mutex_unlock(&q->lock);
+
+    return success;
+}
+
+
+static bool Mutex_Ring_Buffer_Try_Pop(void * queue, uint64_t * value);
+static bool Mutex_Ring_Buffer_Try_Pop(void * queue, uint64_t * value)
+{
+    Mutex_Ring_Buffer * q = (Mutex_Ring_Buffer *)queue;
+    bool success;
+
+    (void)pthread_mutex_lock(&q->lock);
+    success = Ring_Buffer_Static_Read(&q->me, value, sizeof(*value));
+    (void)pthread_mutex_unlock(&q->lock);
+
+    return success;
+}
+
+
+static const Bench_Queue_Ops Mutex_Ring_Buffer_Ops =
+{
+    "mutex_ring_buffer_static",
+    Mutex_Ring_Buffer_Create,
+    Mutex_Ring_Buffer_Destroy,
+    Mutex_Ring_Buffer_Try_Push,
+    Mutex_Ring_Buffer_Try_Pop,
+    0,
+    0
+};
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*--------------------------------------------------------- BENCHMARKS ------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+int main(int argc, char ** argv)
+{
+    Bench_Contention_Config config;
+    bool success;
+
+    if (!Bench_Contention_Begin(&config, argc, argv))
+    {
+        return EXIT_FAILURE;
+    }
+
+    success = Bench_Contention_Run(&config, &Mutex_Ring_Buffer_Ops);
+
+    (void)Bench_Contention_End(&config);
+    return (success) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,280 @@
+/**
+ * @file bench_ring_buffer_broadcast_static.c
+ * @author agent
+ * @brief Microbenchmarks of fanning one stream out to N Readers. Compares one Broadcast Ring Buffer with N Readers
+ * (ring_buffer_broadcast_static.h) against N separate Static Ring Buffers (ring_buffer_static.h), one per Reader.
+ * One operation delivers one element to all N Readers: a Write and N Reads for the Broadcast Ring Buffer, N Writes
+ * and N Reads for the separate Ring Buffers.
+ *
+ * Both are measured half full, so every operation writes and reads without hitting Full or Empty, and in a single
+ * thread, so the numbers are the instruction and copy cost of the fan-out without cache-line traffic between cores.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+/* STD-C Libraries */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>      /* snprintf */
+#include <stdlib.h>     /* EXIT_FAILURE */
+#include <string.h>     /* memset */
+
+/* Benchmark Harness */
+#include "bench.h"
+
+/* Modules Under Test */
+#include "ring_buffer_broadcast_static.h"
+#include "ring_buffer_static.h"
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ BENCHMARK PARAMETERS -----------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Element sizes (Bytes) each Benchmark is run with. The number of elements is always the maximum that fits in
+ * the smaller of RING_BUFFER_STATIC_SIZE and RING_BUFFER_BROADCAST_STATIC_SIZE.
+ */
+static const size_t Element_Sizes[] = {4, 16, 64};
+
+
+/**
+ * @brief Most Readers measured. Limited by the Readers of one Broadcast Ring Buffer and by the Static Ring Buffer pool.
+ */
+#define BENCH_MAX_READERS                                                   \
+    ((RING_BUFFER_BROADCAST_STATIC_MAX_READERS < NUMBER_OF_STATIC_RING_BUFFERS) ? RING_BUFFER_BROADCAST_STATIC_MAX_READERS : NUMBER_OF_STATIC_RING_BUFFERS)
+
+
+/**
+ * @brief Bytes of the larger buffer, so one data block fits either.
+ */
+#define BENCH_BUFFER_SIZE                                                   \
+    ((RING_BUFFER_STATIC_SIZE > RING_BUFFER_BROADCAST_STATIC_SIZE) ? RING_BUFFER_STATIC_SIZE : RING_BUFFER_BROADCAST_STATIC_SIZE)
+
+
+#define ARRAY_LENGTH(array)                                                 (sizeof(array) / sizeof((array)[0]))
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ BENCHMARK CONTEXT --------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief State shared by every Benchmark Case. Only one Case runs at a time so a single instance is reused.
+ */
+typedef struct
+{
+    Ring_Buffer_Broadcast_Static_Handle broadcast;
+    Ring_Buffer_Broadcast_Static_Reader readers[BENCH_MAX_READERS];
+    Ring_Buffer_Static_Handle separate[BENCH_MAX_READERS];
+    uint32_t number_of_readers;
+    size_t element_size;
+    uint32_t capacity;                  /* Number of elements. */
+    uint32_t failures;                  /* Number of operations that unexpectedly returned false. */
+    uint8_t data[BENCH_BUFFER_SIZE];
+} RBB_Bench_Ctx;
+
+static RBB_Bench_Ctx Ctx;
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ SETUP AND TEARDOWN -------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Number of elements of both kinds of Ring Buffer for the Case's element size.
+ */
+static uint32_t Capacity(const RBB_Bench_Ctx * ctx);
+static uint32_t Capacity(const RBB_Bench_Ctx * ctx)
+{
+    const size_t size = (RING_BUFFER_STATIC_SIZE < RING_BUFFER_BROADCAST_STATIC_SIZE) ? RING_BUFFER_STATIC_SIZE : RING_BUFFER_BROADCAST_STATIC_SIZE;
+
+    return (uint32_t)(size / ctx->element_size);
+}
+
+
+/**
+ * @brief Constructs the Broadcast Ring Buffer, registers the Case's Readers and fills it to half its capacity.
+ */
+static bool Setup_Broadcast(void * context);
+static bool Setup_Broadcast(void * context)
+{
+    RBB_Bench_Ctx * ctx = (RBB_Bench_Ctx *)context;
+    bool success;
+
+    ctx->capacity = Capacity(ctx);
+    ctx->failures = 0;
+    memset(ctx->data, 0xA5, sizeof(ctx->data));
+
+    success = Ring_Buffer_Broadcast_Static_Ctor(&ctx->broadcast, ctx->element_size, ctx->capacity);
+
+    for (uint32_t r = 0; (success) && (r < ctx->number_of_readers); r++)
+    {
+        success = Ring_Buffer_Broadcast_Static_Add_Reader(&ctx->broadcast, &ctx->readers[r]);
+    }
+
+    for (uint32_t i = 0; (success) && (i < ctx->capacity / 2); i++)
+    {
+        success = Ring_Buffer_Broadcast_Static_Write(&ctx->broadcast, ctx->data, ctx->element_size);
+    }
+
+    return success;
+}
+
+
+/**
+ * @brief Constructs one Static Ring Buffer per Reader and fills each to half its capacity.
+ */
+static bool Setup_Separate(void * context);
+static bool Setup_Separate(void * context)
+{
+    RBB_Bench_Ctx * ctx = (RBB_Bench_Ctx *)context;
+    bool success = true;
+
+    ctx->capacity = Capacity(ctx);
+    ctx->failures = 0;
+    memset(ctx->data, 0xA5, sizeof(ctx->data));
+
+    for (uint32_t r = 0; (success) && (r < ctx->number_of_readers); r++)
+    {
+        success = Ring_Buffer_Static_Ctor(&ctx->separate[r], ctx->element_size, ctx->capacity);
+
+        for (uint32_t i = 0; (success) && (i < ctx->capacity / 2); i++)
+        {
+            success = Ring_Buffer_Static_Write(&ctx->separate[r], ctx->data, ctx->element_size);
+        }
+    }
+
+    return success;
+}
+
+
+/**
+ * @brief Destroys whatever the Case constructed and reports any operation that failed while measuring, since that
+ * would mean the error path was measured instead of the intended operation.
+ */
+static void Teardown(void * context);
+static void Teardown(void * context)
+{
+    RBB_Bench_Ctx * ctx = (RBB_Bench_Ctx *)context;
+
+    (void)Ring_Buffer_Broadcast_Static_Destroy(&ctx->broadcast);
+
+    for (uint32_t r = 0; r < BENCH_MAX_READERS; r++)
+    {
+        (void)Ring_Buffer_Static_Destroy(&ctx->separate[r]);
+    }
+
+    if (ctx->failures)
+    {
+        fprintf(stderr, "WARNING: %lu operations failed while measuring. Results are invalid.\n", (unsigned long)ctx->failures);
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------------------- BENCHMARKS -------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief One Ring_Buffer_Broadcast_Static_Write() and one Ring_Buffer_Broadcast_Static_Read() per Reader.
+ */
+static uint64_t Run_Broadcast(void * context, uint32_t iterations);
+static uint64_t Run_Broadcast(void * context, uint32_t iterations)
+{
+    RBB_Bench_Ctx * ctx = (RBB_Bench_Ctx *)context;
+
+    uint64_t start = Bench_Ticks();
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        ctx->failures += !Ring_Buffer_Broadcast_Static_Write(&ctx->broadcast, ctx->data, ctx->element_size);
+
+        for (uint32_t r = 0; r < ctx->number_of_readers; r++)
+        {
+            ctx->failures += !Ring_Buffer_Broadcast_Static_Read(&ctx->broadcast, &ctx->readers[r], ctx->data, ctx->element_size);
+        }
+    }
+
+    return Bench_Elapsed(start);
+}
+
+
+/**
+ * @brief One Ring_Buffer_Static_Write() and one Ring_Buffer_Static_Read() on the Ring Buffer of every Reader.
+ */
+static uint64_t Run_Separate(void * context, uint32_t iterations);
+static uint64_t Run_Separate(void * context, uint32_t iterations)
+{
+    RBB_Bench_Ctx * ctx = (RBB_Bench_Ctx *)context;
+
+    uint64_t start = Bench_Ticks();
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        for (uint32_t r = 0; r < ctx->number_of_readers; r++)
+        {
+            ctx->failures += !Ring_Buffer_Static_Write(&ctx->separate[r], ctx->data, ctx->element_size);
+        }
+
+        for (uint32_t r = 0; r < ctx->number_of_readers; r++)
+        {
+            ctx->failures += !Ring_Buffer_Static_Read(&ctx->separate[r], ctx->data, ctx->element_size);
+        }
+    }
+
+    return Bench_Elapsed(start);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------------ MAIN ---------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+int main(int argc, char ** argv)
+{
+    Bench_Config config;
+    Bench_Case bench_case;
+    bool success = true;
+
+    if (!Bench_Begin(&config, argc, argv))
+    {
+        return EXIT_FAILURE;
+    }
+
+    bench_case.ctx = (void *)&Ctx;
+    bench_case.teardown = Teardown;
+
+    for (uint32_t e = 0; e < ARRAY_LENGTH(Element_Sizes); e++)
+    {
+        Ctx.element_size = Element_Sizes[e];
+
+        for (uint32_t readers = 1; readers <= BENCH_MAX_READERS; readers++)
+        {
+            Ctx.number_of_readers = readers;
+
+            snprintf(bench_case.name, sizeof(bench_case.name), "broadcast/element_size=%lu/readers=%lu",
+                     (unsigned long)Ctx.element_size, (unsigned long)readers);
+            bench_case.setup = Setup_Broadcast;
+            bench_case.run = Run_Broadcast;
+            success &= Bench_Run(&config, &bench_case);
+
+            snprintf(bench_case.name, sizeof(bench_case.name), "separate/element_size=%lu/readers=%lu",
+                     (unsigned long)Ctx.element_size, (unsigned long)readers);
+            bench_case.setup = Setup_Separate;
+            bench_case.run = Run_Separate;
+            success &= Bench_Run(&config, &bench_case);
+        }
+    }
+
+    (void)Bench_End(&config);
+
+    return (success) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,365 @@
+/**
+ * @file bench_ring_buffer_fir_static.c
+ * @author agent
+ * @brief Microbenchmarks of FIR filtering from a Ring Buffer of the last samples. Compares the mirrored history of the
+ * FIR Filter Ring Buffer (ring_buffer_fir_static.h) against the two usual ways of reading a history that wraps: copying
+ * the last samples into a linear buffer before each dot product, and a dot product of each of the two segments. One
+ * operation filters one sample. Samples are filtered in blocks of BENCH_BLOCK.
+ *
+ * Build the Class with ARCH_FLAGS=-mavx2 to measure its AVX2 path, and with FIR_SAMPLE=q31 or float for the other
+ * sample types:
+ * cd benches && make clean && make bench ARCH_FLAGS=-mavx2 FIR_SAMPLE=float
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+/* STD-C Libraries */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>      /* snprintf */
+#include <stdlib.h>     /* EXIT_FAILURE */
+#include <string.h>     /* memcpy, memset */
+
+/* Benchmark Harness */
+#include "bench.h"
+
+/* Module Under Test */
+#include "ring_buffer_fir_static.h"
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ BENCHMARK PARAMETERS -----------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Tap counts each Benchmark is run with.
+ */
+static const uint32_t Tap_Counts[] = {8, 32, RING_BUFFER_FIR_STATIC_MAX_TAPS};
+
+
+/**
+ * @brief Number of pre-generated samples the Benchmarks cycle through. A power of 2 and a multiple of BENCH_BLOCK.
+ */
+#define BENCH_SAMPLES                                                       1024u
+
+
+/**
+ * @brief Number of samples filtered per call, like one DMA transfer of an ADC.
+ */
+#define BENCH_BLOCK                                                         32u
+
+
+#define ARRAY_LENGTH(array)                                                 (sizeof(array) / sizeof((array)[0]))
+
+
+/**
+ * @brief The accumulator of the plain circular history, the same as the Class's.
+ */
+#if defined(RING_BUFFER_FIR_STATIC_SAMPLE_FLOAT)
+    typedef float Bench_Accumulator;
+#else
+    typedef int64_t Bench_Accumulator;
+#endif
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ BENCHMARK CONTEXT --------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief State shared by every Benchmark Case. Only one Case runs at a time so a single instance is reused.
+ */
+typedef struct
+{
+    Ring_Buffer_FIR_Static_Handle fir;
+    Ring_Buffer_FIR_Static_Sample coefficients[RING_BUFFER_FIR_STATIC_MAX_TAPS];
+    Ring_Buffer_FIR_Static_Sample reversed[RING_BUFFER_FIR_STATIC_MAX_TAPS];     /* Oldest first, like the history. */
+    Ring_Buffer_FIR_Static_Sample history[RING_BUFFER_FIR_STATIC_MAX_TAPS];      /* Plain circular history. */
+    Ring_Buffer_FIR_Static_Sample linear[RING_BUFFER_FIR_STATIC_MAX_TAPS];       /* Scratch of the linearize Case. */
+    Ring_Buffer_FIR_Static_Sample samples[BENCH_SAMPLES];                        /* Input, like an ADC's. */
+    Ring_Buffer_FIR_Static_Sample output[BENCH_BLOCK];
+    uint32_t taps;
+    uint32_t position;                  /* Index in history[] of the oldest sample. */
+    uint32_t next;                      /* Index in samples[] of the next block. */
+    uint32_t failures;                  /* Number of operations that unexpectedly returned false. */
+} RBF_Bench_Ctx;
+
+static RBF_Bench_Ctx Ctx;
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ SETUP AND TEARDOWN -------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Generates pseudo-random coefficients and input samples. Small enough for the Q31 guard bits.
+ */
+static void Generate_Samples(RBF_Bench_Ctx * ctx);
+static void Generate_Samples(RBF_Bench_Ctx * ctx)
+{
+    uint32_t state = 12345u;
+
+    for (uint32_t i = 0; i < (RING_BUFFER_FIR_STATIC_MAX_TAPS + BENCH_SAMPLES); i++)
+    {
+        Ring_Buffer_FIR_Static_Sample sample;
+
+        state = (state * 1103515245u) + 12345u;
+#if defined(RING_BUFFER_FIR_STATIC_SAMPLE_FLOAT)
+        sample = (float)((int32_t)(state >> 16) - 32768) / 65536.0f;
+#else
+        sample = (Ring_Buffer_FIR_Static_Sample)((int32_t)(state >> 16) - 32768);
+#endif
+
+        if (i < RING_BUFFER_FIR_STATIC_MAX_TAPS)
+        {
+            ctx->coefficients[i] = sample;
+        }
+        else
+        {
+            ctx->samples[i - RING_BUFFER_FIR_STATIC_MAX_TAPS] = sample;
+        }
+    }
+
+    for (uint32_t k = 0; k < ctx->taps; k++)
+    {
+        ctx->reversed[k] = ctx->coefficients[ctx->taps - 1u - k];
+    }
+
+    memset(ctx->history, 0, sizeof(ctx->history));
+    ctx->position = 0;
+    ctx->next = 0;
+    ctx->failures = 0;
+}
+
+
+/**
+ * @brief Constructs the FIR Filter Ring Buffer.
+ */
+static bool Setup_Mirrored(void * context);
+static bool Setup_Mirrored(void * context)
+{
+    RBF_Bench_Ctx * ctx = (RBF_Bench_Ctx *)context;
+
+    Generate_Samples(ctx);
+
+    return Ring_Buffer_FIR_Static_Ctor(&ctx->fir, ctx->coefficients, ctx->taps);
+}
+
+
+/**
+ * @brief Clears the plain circular history.
+ */
+static bool Setup_Circular(void * context);
+static bool Setup_Circular(void * context)
+{
+    Generate_Samples((RBF_Bench_Ctx *)context);
+
+    return true;
+}
+
+
+/**
+ * @brief Destroys whatever the Case constructed and reports any operation that failed while measuring, since that
+ * would mean the error path was measured instead of the intended operation.
+ */
+static void Teardown(void * context);
+static void Teardown(void * context)
+{
+    RBF_Bench_Ctx * ctx = (RBF_Bench_Ctx *)context;
+
+    (void)Ring_Buffer_FIR_Static_Destroy(&ctx->fir);
+
+    if (ctx->failures)
+    {
+        fprintf(stderr, "WARNING: %lu operations failed while measuring. Results are invalid.\n", (unsigned long)ctx->failures);
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ CIRCULAR HISTORY ---------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Dot product of @p count samples and coefficients.
+ */
+static Bench_Accumulator Dot(const Ring_Buffer_FIR_Static_Sample * samples, const Ring_Buffer_FIR_Static_Sample * coefficients, uint32_t count);
+static Bench_Accumulator Dot(const Ring_Buffer_FIR_Static_Sample * samples, const Ring_Buffer_FIR_Static_Sample * coefficients, uint32_t count)
+{
+    Bench_Accumulator acc = 0;
+
+    for (uint32_t k = 0; k < count; k++)
+    {
+        acc += (Bench_Accumulator)samples[k] * (Bench_Accumulator)coefficients[k];
+    }
+
+    return acc;
+}
+
+
+/**
+ * @brief Converts the accumulator back to a sample, the same as the Class.
+ */
+static Ring_Buffer_FIR_Static_Sample To_Sample(Bench_Accumulator acc);
+static Ring_Buffer_FIR_Static_Sample To_Sample(Bench_Accumulator acc)
+{
+#if defined(RING_BUFFER_FIR_STATIC_SAMPLE_FLOAT)
+    return acc;
+#elif defined(RING_BUFFER_FIR_STATIC_SAMPLE_Q31)
+    acc >>= 31;
+    return (Ring_Buffer_FIR_Static_Sample)((acc < INT32_MIN) ? INT32_MIN : ((acc > INT32_MAX) ? INT32_MAX : acc));
+#else
+    acc >>= 15;
+    return (Ring_Buffer_FIR_Static_Sample)((acc < INT16_MIN) ? INT16_MIN : ((acc > INT16_MAX) ? INT16_MAX : acc));
+#endif
+}
+
+
+/**
+ * @brief Writes @p sample over the oldest sample of the plain circular history. The oldest is then at position.
+ */
+static void Push_Circular(RBF_Bench_Ctx * ctx, Ring_Buffer_FIR_Static_Sample sample);
+static void Push_Circular(RBF_Bench_Ctx * ctx, Ring_Buffer_FIR_Static_Sample sample)
+{
+    ctx->history[ctx->position] = sample;
+    ctx->position = ((ctx->position + 1u) == ctx->taps) ? 0 : (ctx->position + 1u);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------------------- BENCHMARKS -------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Ring_Buffer_FIR_Static_Process() of one block every BENCH_BLOCK operations.
+ */
+static uint64_t Run_Mirrored(void * context, uint32_t iterations);
+static uint64_t Run_Mirrored(void * context, uint32_t iterations)
+{
+    RBF_Bench_Ctx * ctx = (RBF_Bench_Ctx *)context;
+    const uint32_t blocks = (iterations + BENCH_BLOCK - 1u) / BENCH_BLOCK;
+
+    uint64_t start = Bench_Ticks();
+    for (uint32_t i = 0; i < blocks; i++)
+    {
+        ctx->failures += !Ring_Buffer_FIR_Static_Process(&ctx->fir, &ctx->samples[ctx->next], ctx->output, BENCH_BLOCK);
+        ctx->next = (ctx->next + BENCH_BLOCK) & (BENCH_SAMPLES - 1u);
+        BENCH_CLOBBER_MEMORY();
+    }
+
+    return Bench_Elapsed(start);
+}
+
+
+/**
+ * @brief Copies the last taps samples of the circular history into a linear buffer, oldest first, before each dot
+ * product.
+ */
+static uint64_t Run_Linearize(void * context, uint32_t iterations);
+static uint64_t Run_Linearize(void * context, uint32_t iterations)
+{
+    RBF_Bench_Ctx * ctx = (RBF_Bench_Ctx *)context;
+    const uint32_t blocks = (iterations + BENCH_BLOCK - 1u) / BENCH_BLOCK;
+
+    uint64_t start = Bench_Ticks();
+    for (uint32_t i = 0; i < blocks; i++)
+    {
+        for (uint32_t n = 0; n < BENCH_BLOCK; n++)
+        {
+            Push_Circular(ctx, ctx->samples[ctx->next + n]);
+            memcpy(&ctx->linear[0], &ctx->history[ctx->position], (ctx->taps - ctx->position) * sizeof(ctx->linear[0]));
+            memcpy(&ctx->linear[ctx->taps - ctx->position], &ctx->history[0], ctx->position * sizeof(ctx->linear[0]));
+            ctx->output[n] = To_Sample(Dot(ctx->linear, ctx->reversed, ctx->taps));
+        }
+
+        ctx->next = (ctx->next + BENCH_BLOCK) & (BENCH_SAMPLES - 1u);
+        BENCH_CLOBBER_MEMORY();
+    }
+
+    return Bench_Elapsed(start);
+}
+
+
+/**
+ * @brief A dot product of each of the two segments of the circular history, the older one from position to the end
+ * and the newer one from the start.
+ */
+static uint64_t Run_Segments(void * context, uint32_t iterations);
+static uint64_t Run_Segments(void * context, uint32_t iterations)
+{
+    RBF_Bench_Ctx * ctx = (RBF_Bench_Ctx *)context;
+    const uint32_t blocks = (iterations + BENCH_BLOCK - 1u) / BENCH_BLOCK;
+
+    uint64_t start = Bench_Ticks();
+    for (uint32_t i = 0; i < blocks; i++)
+    {
+        for (uint32_t n = 0; n < BENCH_BLOCK; n++)
+        {
+            uint32_t older;
+
+            Push_Circular(ctx, ctx->samples[ctx->next + n]);
+            older = ctx->taps - ctx->position;
+            ctx->output[n] = To_Sample(Dot(&ctx->history[ctx->position], &ctx->reversed[0], older) +
+                                       Dot(&ctx->history[0], &ctx->reversed[older], ctx->position));
+        }
+
+        ctx->next = (ctx->next + BENCH_BLOCK) & (BENCH_SAMPLES - 1u);
+        BENCH_CLOBBER_MEMORY();
+    }
+
+    return Bench_Elapsed(start);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------------ MAIN ---------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+int main(int argc, char ** argv)
+{
+    Bench_Config config;
+    Bench_Case bench_case;
+    bool success = true;
+
+    if (!Bench_Begin(&config, argc, argv))
+    {
+        return EXIT_FAILURE;
+    }
+
+    bench_case.ctx = (void *)&Ctx;
+    bench_case.teardown = Teardown;
+
+    for (uint32_t t = 0; t < ARRAY_LENGTH(Tap_Counts); t++)
+    {
+        Ctx.taps = Tap_Counts[t];
+
+        snprintf(bench_case.name, sizeof(bench_case.name), "mirrored/taps=%lu", (unsigned long)Ctx.taps);
+        bench_case.setup = Setup_Mirrored;
+        bench_case.run = Run_Mirrored;
+        success &= Bench_Run(&config, &bench_case);
+
+        snprintf(bench_case.name, sizeof(bench_case.name), "linearize/taps=%lu", (unsigned long)Ctx.taps);
+        bench_case.setup = Setup_Circular;
+        bench_case.run = Run_Linearize;
+        success &= Bench_Run(&config, &bench_case);
+
+        snprintf(bench_case.name, sizeof(bench_case.name), "segments/taps=%lu", (unsigned long)Ctx.taps);
+        bench_case.setup = Setup_Circular;
+        bench_case.run = Run_Segments;
+        success &= Bench_Run(&config, &bench_case);
+    }
+
+    (void)Bench_End(&config);
+
+    return (success) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,374 @@
+/**
+ * @file bench_ring_buffer_static.c
+ * @author agent
+ * @brief Microbenchmarks for the Static Ring Buffer module. Measures ns/op of Write, Read, Write+Read pairs,
+ * Constructor+Destructor pairs and Clear across element sizes and fill levels.
+ *
+ * Fill level is the percentage of the Ring Buffer's capacity that is occupied when measurement starts.
+ * Write and Read are measured over the band between the fill level and full: Writes fill the band and are
+ * timed, the band is then drained untimed (and the reverse for Reads). Write+Read pairs keep the occupancy
+ * at the fill level for the entire measurement so no untimed work is needed.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+/* STD-C Libraries */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>      /* snprintf */
+#include <stdlib.h>     /* EXIT_FAILURE */
+#include <string.h>     /* memset */
+
+/* Benchmark Harness */
+#include "bench.h"
+
+/* Module Under Test */
+#include "ring_buffer_static.h"
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ BENCHMARK PARAMETERS -----------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Element sizes (Bytes) each Benchmark is run with. The number of elements is always the
+ * maximum that fits in RING_BUFFER_STATIC_SIZE.
+ */
+static const size_t Element_Sizes[] = {1, 4, 16, 64};
+
+
+/**
+ * @brief Fill levels (percent of capacity) each Benchmark is run with.
+ */
+static const uint32_t Fill_Percents[] = {0, 50, 90};
+
+
+#define ARRAY_LENGTH(array)                                                 (sizeof(array) / sizeof((array)[0]))
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ BENCHMARK CONTEXT --------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief State shared by every Ring Buffer Benchmark Case. Only one Case runs at a time so a
+ * single instance is reused.
+ */
+typedef struct
+{
+    Ring_Buffer_Static_Handle me;
+    size_t element_size;
+    uint32_t fill_percent;
+    uint32_t capacity;                  /* Number of elements. */
+    uint32_t fill;                      /* Number of elements resident when measurement starts. */
+    uint32_t failures;                  /* Number of operations that unexpectedly returned false. */
+    uint8_t data[RING_BUFFER_STATIC_SIZE];
+} RB_Bench_Ctx;
+
+static RB_Bench_Ctx Ctx;
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ HELPER FUNCTIONS ---------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Writes @p count elements without measuring them.
+ */
+static inline void Write_Untimed(RB_Bench_Ctx * ctx, uint32_t count);
+static inline void Write_Untimed(RB_Bench_Ctx * ctx, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        ctx->failures += !Ring_Buffer_Static_Write(&ctx->me, ctx->data, ctx->element_size);
+    }
+}
+
+
+/**
+ * @brief Reads @p count elements without measuring them.
+ */
+static inline void Read_Untimed(RB_Bench_Ctx * ctx, uint32_t count);
+static inline void Read_Untimed(RB_Bench_Ctx * ctx, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        ctx->failures += !Ring_Buffer_Static_Read(&ctx->me, ctx->data, ctx->element_size);
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ SETUP AND TEARDOWN -------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Constructs the Ring Buffer with the Case's element size and fills it to the Case's fill level.
+ * The fill level is capped at one element below full so Write always has room.
+ */
+static bool Setup_Constructed(void * context);
+static bool Setup_Constructed(void * context)
+{
+    RB_Bench_Ctx * ctx = (RB_Bench_Ctx *)context;
+
+    ctx->capacity = RING_BUFFER_STATIC_SIZE / ctx->element_size;
+    ctx->fill = (ctx->capacity * ctx->fill_percent) / 100;
+    if (ctx->fill >= ctx->capacity)
+    {
+        ctx->fill = ctx->capacity - 1;
+    }
+    ctx->failures = 0;
+    memset(ctx->data, 0xA5, sizeof(ctx->data));
+
+    bool success = Ring_Buffer_Static_Ctor(&ctx->me, ctx->element_size, ctx->capacity);
+    if (success)
+    {
+        Write_Untimed(ctx, ctx->fill);
+    }
+
+    return success && (ctx->failures == 0);
+}
+
+
+/**
+ * @brief Setup for Cases that construct the Ring Buffer themselves.
+ */
+static bool Setup_Unconstructed(void * context);
+static bool Setup_Unconstructed(void * context)
+{
+    RB_Bench_Ctx * ctx = (RB_Bench_Ctx *)context;
+
+    ctx->capacity = RING_BUFFER_STATIC_SIZE / ctx->element_size;
+    ctx->fill = 0;
+    ctx->failures = 0;
+
+    return true;
+}
+
+
+/**
+ * @brief Destroys the Ring Buffer and reports any operation that failed while measuring, since
+ * that would mean the error path was measured instead of the intended operation.
+ */
+static void Teardown(void * context);
+static void Teardown(void * context)
+{
+    RB_Bench_Ctx * ctx = (RB_Bench_Ctx *)context;
+
+    (void)Ring_Buffer_Static_Destroy(&ctx->me);
+
+    if (ctx->failures)
+    {
+        fprintf(stderr, "WARNING: %lu operations failed while measuring. Results are invalid.\n", (unsigned long)ctx->failures);
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------------------- BENCHMARKS -------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Ring_Buffer_Static_Write(). The band between the fill level and full is written (timed)
+ * then drained back to the fill level (untimed) as many times as needed.
+ */
+static uint64_t Run_Write(void * context, uint32_t iterations);
+static uint64_t Run_Write(void * context, uint32_t iterations)
+{
+    RB_Bench_Ctx * ctx = (RB_Bench_Ctx *)context;
+    uint32_t band = ctx->capacity - ctx->fill;
+    uint64_t ticks = 0;
+
+    while (iterations)
+    {
+        uint32_t n = (iterations < band) ? iterations : band;
+
+        uint64_t start = Bench_Ticks();
+        for (uint32_t i = 0; i < n; i++)
+        {
+            ctx->failures += !Ring_Buffer_Static_Write(&ctx->me, ctx->data, ctx->element_size);
+        }
+        ticks += Bench_Elapsed(start);
+
+        Read_Untimed(ctx, n);
+        iterations -= n;
+    }
+
+    return ticks;
+}
+
+
+/**
+ * @brief Ring_Buffer_Static_Read(). The band between the fill level and full is refilled (untimed)
+ * then read back down to the fill level (timed) as many times as needed.
+ */
+static uint64_t Run_Read(void * context, uint32_t iterations);
+static uint64_t Run_Read(void * context, uint32_t iterations)
+{
+    RB_Bench_Ctx * ctx = (RB_Bench_Ctx *)context;
+    uint32_t band = ctx->capacity - ctx->fill;
+    uint64_t ticks = 0;
+
+    while (iterations)
+    {
+        uint32_t n = (iterations < band) ? iterations : band;
+
+        Write_Untimed(ctx, n);
+
+        uint64_t start = Bench_Ticks();
+        for (uint32_t i = 0; i < n; i++)
+        {
+            ctx->failures += !Ring_Buffer_Static_Read(&ctx->me, ctx->data, ctx->element_size);
+        }
+        ticks += Bench_Elapsed(start);
+
+        iterations -= n;
+    }
+
+    return ticks;
+}
+
+
+/**
+ * @brief A Ring_Buffer_Static_Write() immediately followed by a Ring_Buffer_Static_Read(). Occupancy
+ * stays at the fill level so the whole loop is timed.
+ */
+static uint64_t Run_Write_Read(void * context, uint32_t iterations);
+static uint64_t Run_Write_Read(void * context, uint32_t iterations)
+{
+    RB_Bench_Ctx * ctx = (RB_Bench_Ctx *)context;
+
+    uint64_t start = Bench_Ticks();
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        ctx->failures += !Ring_Buffer_Static_Write(&ctx->me, ctx->data, ctx->element_size);
+        ctx->failures += !Ring_Buffer_Static_Read(&ctx->me, ctx->data, ctx->element_size);
+    }
+
+    return Bench_Elapsed(start);
+}
+
+
+/**
+ * @brief A Ring_Buffer_Static_Ctor() immediately followed by a Ring_Buffer_Static_Destroy().
+ */
+static uint64_t Run_Ctor_Destroy(void * context, uint32_t iterations);
+static uint64_t Run_Ctor_Destroy(void * context, uint32_t iterations)
+{
+    RB_Bench_Ctx * ctx = (RB_Bench_Ctx *)context;
+
+    uint64_t start = Bench_Ticks();
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        ctx->failures += !Ring_Buffer_Static_Ctor(&ctx->me, ctx->element_size, ctx->capacity);
+        ctx->failures += !Ring_Buffer_Static_Destroy(&ctx->me);
+    }
+
+    return Bench_Elapsed(start);
+}
+
+
+/**
+ * @brief Ring_Buffer_Static_Clear(). The Ring Buffer is refilled to the fill level (untimed) after
+ * every Clear. An empty Ring Buffer needs no refill so the whole loop is timed instead to avoid
+ * per-operation Timer overhead.
+ */
+static uint64_t Run_Clear(void * context, uint32_t iterations);
+static uint64_t Run_Clear(void * context, uint32_t iterations)
+{
+    RB_Bench_Ctx * ctx = (RB_Bench_Ctx *)context;
+    uint64_t ticks = 0;
+
+    if (ctx->fill == 0)
+    {
+        uint64_t start = Bench_Ticks();
+        for (uint32_t i = 0; i < iterations; i++)
+        {
+            ctx->failures += !Ring_Buffer_Static_Clear(&ctx->me);
+        }
+        ticks = Bench_Elapsed(start);
+    }
+    else
+    {
+        for (uint32_t i = 0; i < iterations; i++)
+        {
+            uint64_t start = Bench_Ticks();
+            ctx->failures += !Ring_Buffer_Static_Clear(&ctx->me);
+            ticks += Bench_Elapsed(start);
+
+            Write_Untimed(ctx, ctx->fill);
+        }
+    }
+
+    return ticks;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------------ MAIN ---------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+int main(int argc, char ** argv)
+{
+    Bench_Config config;
+    Bench_Case bench_case;
+    bool success = true;
+
+    if (!Bench_Begin(&config, argc, argv))
+    {
+        return EXIT_FAILURE;
+    }
+
+    bench_case.ctx = (void *)&Ctx;
+    bench_case.teardown = Teardown;
+
+    for (uint32_t e = 0; e < ARRAY_LENGTH(Element_Sizes); e++)
+    {
+        Ctx.element_size = Element_Sizes[e];
+
+        for (uint32_t f = 0; f < ARRAY_LENGTH(Fill_Percents); f++)
+        {
+            Ctx.fill_percent = Fill_Percents[f];
+            bench_case.setup = Setup_Constructed;
+
+            snprintf(bench_case.name, sizeof(bench_case.name), "write/element_size=%lu/fill=%lu",
+                     (unsigned long)Ctx.element_size, (unsigned long)Ctx.fill_percent);
+            bench_case.run = Run_Write;
+            success &= Bench_Run(&config, &bench_case);
+
+            snprintf(bench_case.name, sizeof(bench_case.name), "read/element_size=%lu/fill=%lu",
+                     (unsigned long)Ctx.element_size, (unsigned long)Ctx.fill_percent);
+            bench_case.run = Run_Read;
+            success &= Bench_Run(&config, &bench_case);
+
+            snprintf(bench_case.name, sizeof(bench_case.name), "write_read/element_size=%lu/fill=%lu",
+                     (unsigned long)Ctx.element_size, (unsigned long)Ctx.fill_percent);
+            bench_case.run = Run_Write_Read;
+            success &= Bench_Run(&config, &bench_case);
+
+            snprintf(bench_case.name, sizeof(bench_case.name), "clear/element_size=%lu/fill=%lu",
+                     (unsigned long)Ctx.element_size, (unsigned long)Ctx.fill_percent);
+            bench_case.run = Run_Clear;
+            success &= Bench_Run(&config, &bench_case);
+        }
+
+        snprintf(bench_case.name, sizeof(bench_case.name), "ctor_destroy/element_size=%lu", (unsigned long)Ctx.element_size);
+        bench_case.setup = Setup_Unconstructed;
+        bench_case.run = Run_Ctor_Destroy;
+        success &= Bench_Run(&config, &bench_case);
+    }
+
+    (void)Bench_End(&config);
+
+    return (success) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,287 @@
+/**
+ * @file bench_ring_buffer_window_static.c
+ * @author agent
+ * @brief Microbenchmarks of the statistics of a sliding window of samples. Compares the running sums and monotonic
+ * deques of the Window Ring Buffer (ring_buffer_window_static.h) against rescanning the whole window after every
+ * sample. One operation adds one sample and gets the mean, minimum, maximum and RMS of the window.
+ *
+ * Also measures Ring_Buffer_Window_Static_Recompute() on its own, the O(N) drift correction. Build the Class with
+ * ARCH_FLAGS=-mavx2 to measure its AVX2 path, and with WINDOW_SAMPLE=int32 or float for the other sample types:
+ * cd benches && make clean && make bench ARCH_FLAGS=-mavx2 WINDOW_SAMPLE=float
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+/* STD-C Libraries */
+#include <math.h>       /* sqrtf */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>      /* snprintf */
+#include <stdlib.h>     /* EXIT_FAILURE */
+#include <string.h>     /* memcpy */
+
+/* Benchmark Harness */
+#include "bench.h"
+
+/* Module Under Test */
+#include "ring_buffer_window_static.h"
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ BENCHMARK PARAMETERS -----------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Window lengths (samples) each Benchmark is run with.
+ */
+static const uint32_t Window_Lengths[] = {16, 64, RING_BUFFER_WINDOW_STATIC_MAX_LENGTH};
+
+
+/**
+ * @brief Number of pre-generated samples the Benchmarks cycle through. A power of 2.
+ */
+#define BENCH_SAMPLES                                                       1024u
+
+
+#define ARRAY_LENGTH(array)                                                 (sizeof(array) / sizeof((array)[0]))
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ BENCHMARK CONTEXT --------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief State shared by every Benchmark Case. Only one Case runs at a time so a single instance is reused.
+ */
+typedef struct
+{
+    Ring_Buffer_Window_Static_Handle window;
+    Ring_Buffer_Window_Static_Sample rescan[RING_BUFFER_WINDOW_STATIC_MAX_LENGTH];     /* The window of the rescan. */
+    Ring_Buffer_Window_Static_Sample samples[BENCH_SAMPLES];                            /* Input, like an ADC's. */
+    Ring_Buffer_Window_Static_Stats stats;
+    uint32_t window_length;
+    uint32_t rescan_tail;
+    uint32_t next;                      /* Index in samples[] of the next sample. */
+    uint32_t failures;                  /* Number of operations that unexpectedly returned false. */
+} RBW_Bench_Ctx;
+
+static RBW_Bench_Ctx Ctx;
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ SETUP AND TEARDOWN -------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Generates the input samples: a sawtooth with pseudo-random noise, from -2000 to 2000 so every sample type
+ * holds them.
+ */
+static void Generate_Samples(RBW_Bench_Ctx * ctx);
+static void Generate_Samples(RBW_Bench_Ctx * ctx)
+{
+    uint32_t state = 12345u;
+
+    for (uint32_t i = 0; i < BENCH_SAMPLES; i++)
+    {
+        state = (state * 1103515245u) + 12345u;
+        ctx->samples[i] = (Ring_Buffer_Window_Static_Sample)((int32_t)(i % 256u) * 8 - 1024 + (int32_t)((state >> 16) % 1001u) - 500);
+    }
+
+    ctx->next = 0;
+    ctx->failures = 0;
+}
+
+
+/**
+ * @brief Constructs the Window Ring Buffer and fills its window, so every operation removes a sample too.
+ */
+static bool Setup_Window(void * context);
+static bool Setup_Window(void * context)
+{
+    RBW_Bench_Ctx * ctx = (RBW_Bench_Ctx *)context;
+    bool success;
+
+    Generate_Samples(ctx);
+    success = Ring_Buffer_Window_Static_Ctor(&ctx->window, ctx->window_length);
+
+    for (uint32_t i = 0; (success) && (i < ctx->window_length); i++)
+    {
+        success = Ring_Buffer_Window_Static_Push(&ctx->window, ctx->samples[i]);
+    }
+
+    return success;
+}
+
+
+/**
+ * @brief Fills the window of the rescan.
+ */
+static bool Setup_Rescan(void * context);
+static bool Setup_Rescan(void * context)
+{
+    RBW_Bench_Ctx * ctx = (RBW_Bench_Ctx *)context;
+
+    Generate_Samples(ctx);
+    memcpy(ctx->rescan, ctx->samples, ctx->window_length * sizeof(ctx->rescan[0]));
+    ctx->rescan_tail = 0;
+
+    return true;
+}
+
+
+/**
+ * @brief Destroys whatever the Case constructed and reports any operation that failed while measuring, since that
+ * would mean the error path was measured instead of the intended operation.
+ */
+static void Teardown(void * context);
+static void Teardown(void * context)
+{
+    RBW_Bench_Ctx * ctx = (RBW_Bench_Ctx *)context;
+
+    (void)Ring_Buffer_Window_Static_Destroy(&ctx->window);
+
+    if (ctx->failures)
+    {
+        fprintf(stderr, "WARNING: %lu operations failed while measuring. Results are invalid.\n", (unsigned long)ctx->failures);
+    }
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------------------- BENCHMARKS -------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief One Ring_Buffer_Window_Static_Push() and one Ring_Buffer_Window_Static_Get_Stats().
+ */
+static uint64_t Run_Window(void * context, uint32_t iterations);
+static uint64_t Run_Window(void * context, uint32_t iterations)
+{
+    RBW_Bench_Ctx * ctx = (RBW_Bench_Ctx *)context;
+
+    uint64_t start = Bench_Ticks();
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        ctx->failures += !Ring_Buffer_Window_Static_Push(&ctx->window, ctx->samples[ctx->next]);
+        ctx->failures += !Ring_Buffer_Window_Static_Get_Stats(&ctx->window, &ctx->stats);
+        ctx->next = (ctx->next + 1u) & (BENCH_SAMPLES - 1u);
+        BENCH_CLOBBER_MEMORY();
+    }
+
+    return Bench_Elapsed(start);
+}
+
+
+/**
+ * @brief Overwrites the oldest sample and reads the whole window to compute the same statistics.
+ */
+static uint64_t Run_Rescan(void * context, uint32_t iterations);
+static uint64_t Run_Rescan(void * context, uint32_t iterations)
+{
+    RBW_Bench_Ctx * ctx = (RBW_Bench_Ctx *)context;
+
+    uint64_t start = Bench_Ticks();
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        Ring_Buffer_Window_Static_Sample min;
+        Ring_Buffer_Window_Static_Sample max;
+        float sum = 0.0f;
+        float sum_squares = 0.0f;
+
+        ctx->rescan[ctx->rescan_tail] = ctx->samples[ctx->next];
+        ctx->rescan_tail = ((ctx->rescan_tail + 1u) == ctx->window_length) ? 0 : (ctx->rescan_tail + 1u);
+        ctx->next = (ctx->next + 1u) & (BENCH_SAMPLES - 1u);
+
+        min = ctx->rescan[0];
+        max = ctx->rescan[0];
+        for (uint32_t s = 0; s < ctx->window_length; s++)
+        {
+            const Ring_Buffer_Window_Static_Sample sample = ctx->rescan[s];
+
+            min = (sample < min) ? sample : min;
+            max = (sample > max) ? sample : max;
+            sum += (float)sample;
+            sum_squares += (float)sample * (float)sample;
+        }
+
+        ctx->stats.min = min;
+        ctx->stats.max = max;
+        ctx->stats.mean = sum / (float)ctx->window_length;
+        ctx->stats.rms = sqrtf(sum_squares / (float)ctx->window_length);
+        BENCH_CLOBBER_MEMORY();
+    }
+
+    return Bench_Elapsed(start);
+}
+
+
+/**
+ * @brief One Ring_Buffer_Window_Static_Recompute() of the full window.
+ */
+static uint64_t Run_Recompute(void * context, uint32_t iterations);
+static uint64_t Run_Recompute(void * context, uint32_t iterations)
+{
+    RBW_Bench_Ctx * ctx = (RBW_Bench_Ctx *)context;
+
+    uint64_t start = Bench_Ticks();
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        ctx->failures += !Ring_Buffer_Window_Static_Recompute(&ctx->window);
+        BENCH_CLOBBER_MEMORY();
+    }
+
+    return Bench_Elapsed(start);
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------------ MAIN ---------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+int main(int argc, char ** argv)
+{
+    Bench_Config config;
+    Bench_Case bench_case;
+    bool success = true;
+
+    if (!Bench_Begin(&config, argc, argv))
+    {
+        return EXIT_FAILURE;
+    }
+
+    bench_case.ctx = (void *)&Ctx;
+    bench_case.teardown = Teardown;
+
+    for (uint32_t w = 0; w < ARRAY_LENGTH(Window_Lengths); w++)
+    {
+        Ctx.window_length = Window_Lengths[w];
+
+        snprintf(bench_case.name, sizeof(bench_case.name), "window/length=%lu", (unsigned long)Ctx.window_length);
+        bench_case.setup = Setup_Window;
+        bench_case.run = Run_Window;
+        success &= Bench_Run(&config, &bench_case);
+
+        snprintf(bench_case.name, sizeof(bench_case.name), "rescan/length=%lu", (unsigned long)Ctx.window_length);
+        bench_case.setup = Setup_Rescan;
+        bench_case.run = Run_Rescan;
+        success &= Bench_Run(&config, &bench_case);
+
+        snprintf(bench_case.name, sizeof(bench_case.name), "recompute/length=%lu", (unsigned long)Ctx.window_length);
+        bench_case.setup = Setup_Window;
+        bench_case.run = Run_Recompute;
+        success &= Bench_Run(&config, &bench_case);
+    }
+
+    (void)Bench_End(&config);
+
+    return (success) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
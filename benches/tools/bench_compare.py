@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+"""Compare two benchmark result files produced by the benchmark harnesses (benches/harness/bench.h and
+benches/harness/bench_contention.h).
+
+Usage:
+    bench_compare.py BASELINE CANDIDATE [--threshold PERCENT] [--alpha ALPHA]
+                     [--bootstrap N] [--confidence LEVEL] [--seed SEED]
+
+Both files may be JSON (--format=json) or CSV (--format=csv). For every benchmark present in both
+files the comparator reports:
+
+    speedup     baseline median / candidate median. > 1 means the candidate is faster.
+    CI          bootstrap confidence interval of the speedup (resampling both sample sets).
+    p           two-sided Mann-Whitney U p-value (normal approximation with tie correction).
+
+A benchmark is a regression when the difference is statistically significant (p < alpha), the
+candidate is slower than the baseline by more than the threshold, and the entire confidence interval
+lies below 1 (the slowdown is not explained by resampling noise). The script exits with status 1
+if any regression is found, 2 on usage or input errors, and 0 otherwise.
+"""
+
+import argparse
+import csv
+import json
+import math
+import random
+import sys
+from collections import OrderedDict
+
+
+def load_results(path):
+    """Return the unit of the samples (i.e. "ns" or "tsc_ticks") and an OrderedDict of benchmark name -> list of samples."""
+    results = OrderedDict()
+
+    with open(path, newline="") as handle:
+        text = handle.read()
+
+    if text.lstrip().startswith("{"):
+        data = json.loads(text)
+        unit = data.get("unit", "ns")
+        for bench in data["benchmarks"]:
+            results[bench["name"]] = [float(s) for s in bench["samples"]]
+    else:
+        rows = csv.DictReader(text.splitlines())
+        # The first <unit>_per_op column holds the samples. Hardware Performance Counter columns come after it.
+        column = next((name for name in (rows.fieldnames or []) if name.endswith("_per_op")), "ns_per_op")
+        unit = column[:-len("_per_op")]
+        for row in rows:
+            results.setdefault(row["benchmark"], []).append(float(row[column]))
+
+    return unit, results
+
+
+def median(values):
+    ordered = sorted(values)
+    n = len(ordered)
+    mid = n // 2
+    return ordered[mid] if n % 2 else (ordered[mid - 1] + ordered[mid]) / 2.0
+
+
+def mann_whitney_p(a, b):
+    """Two-sided Mann-Whitney U test p-value using the normal approximation with tie correction."""
+    n1, n2 = len(a), len(b)
+    pooled = sorted([(v, 0) for v in a] + [(v, 1) for v in b])
+
+    # Assign average ranks to tied values.
+    ranks = [0.0] * len(pooled)
+    tie_term = 0.0
+    i = 0
+    while i < len(pooled):
+        j = i
+        while j + 1 < len(pooled) and pooled[j + 1][0] == pooled[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2.0 + 1.0
+        ties = j - i + 1
+        tie_term += ties ** 3 - ties
+        i = j + 1
+
+    rank_sum_a = sum(r for r, (_, group) in zip(ranks, pooled) if group == 0)
+    u = rank_sum_a - n1 * (n1 + 1) / 2.0
+    mean_u = n1 * n2 / 2.0
+    n = n1 + n2
+    var_u = (n1 * n2 / 12.0) * ((n + 1) - tie_term / (n * (n - 1))) if n > 1 else 0.0
+
+    if var_u <= 0.0:
+        return 1.0
+
+    # Continuity correction.
+    z = (abs(u - mean_u) - 0.5) / math.sqrt(var_u)
+    return max(0.0, min(1.0, math.erfc(max(z, 0.0) / math.sqrt(2.0))))
+
+
+def bootstrap_speedup_ci(a, b, resamples, confidence, rng):
+    """Percentile bootstrap confidence interval of median(a) / median(b)."""
+    ratios = []
+    for _ in range(resamples):
+        ra = [a[rng.randrange(len(a))] for _ in a]
+        rb = [b[rng.randrange(len(b))] for _ in b]
+        mb = median(rb)
+        if mb > 0.0:
+            ratios.append(median(ra) / mb)
+
+    if not ratios:
+        return (float("nan"), float("nan"))
+
+    ratios.sort()
+    tail = (1.0 - confidence) / 2.0
+    lo = ratios[int(math.floor(tail * (len(ratios) - 1)))]
+    hi = ratios[int(math.ceil((1.0 - tail) * (len(ratios) - 1)))]
+    return (lo, hi)
+
+
+def parse_args(argv):
+    parser = argparse.ArgumentParser(description="Compare two benchmark result files.")
+    parser.add_argument("baseline", help="Result file of the baseline (i.e. main).")
+    parser.add_argument("candidate", help="Result file of the candidate change.")
+    parser.add_argument("--threshold", type=float, default=5.0,
+                        help="Slowdown in percent that counts as a regression (default 5).")
+    parser.add_argument("--alpha", type=float, default=0.05,
+                        help="Significance level of the Mann-Whitney U test (default 0.05).")
+    parser.add_argument("--bootstrap", type=int, default=2000,
+                        help="Number of bootstrap resamples (default 2000).")
+    parser.add_argument("--confidence", type=float, default=0.95,
+                        help="Confidence level of the speedup interval (default 0.95).")
+    parser.add_argument("--seed", type=int, default=1,
+                        help="Bootstrap random seed so reports are reproducible (default 1).")
+    return parser.parse_args(argv)
+
+
+def main(argv):
+    args = parse_args(argv)
+
+    try:
+        unit, baseline = load_results(args.baseline)
+        candidate_unit, candidate = load_results(args.candidate)
+    except (OSError, ValueError, KeyError) as error:
+        print("Unable to load results: %s" % error, file=sys.stderr)
+        return 2
+
+    if unit != candidate_unit:
+        print("Unable to compare %s/op with %s/op results" % (unit, candidate_unit), file=sys.stderr)
+        return 2
+
+    rng = random.Random(args.seed)
+    regressions = []
+    names = [name for name in baseline if name in candidate]
+
+    print("%-48s %10s %10s %8s %19s %8s  %s" %
+          ("benchmark (median %s/op)" % unit, "baseline", "candidate", "speedup", "%d%% CI" % round(args.confidence * 100),
+           "p", "verdict"))
+
+    for name in names:
+        a, b = baseline[name], candidate[name]
+        if len(a) < 2 or len(b) < 2:
+            print("%-48s skipped: at least 2 samples are needed in each file" % name)
+            continue
+
+        base_median, cand_median = median(a), median(b)
+        speedup = base_median / cand_median if cand_median > 0.0 else float("inf")
+        lo, hi = bootstrap_speedup_ci(a, b, args.bootstrap, args.confidence, rng)
+        p = mann_whitney_p(a, b)
+
+        verdict = ""
+        if p < args.alpha:
+            slowdown_percent = (cand_median / base_median - 1.0) * 100.0 if base_median > 0.0 else 0.0
+            if slowdown_percent > args.threshold and hi < 1.0:
+                verdict = "REGRESSION"
+                regressions.append(name)
+            elif speedup > 1.0:
+                verdict = "faster"
+            else:
+                verdict = "slower"
+
+        print("%-48s %10.2f %10.2f %7.3fx [%7.3fx, %7.3fx] %8.4f  %s" %
+              (name, base_median, cand_median, speedup, lo, hi, p, verdict))
+
+    for name in baseline:
+        if name not in candidate:
+            print("%-48s missing from candidate" % name)
+    for name in candidate:
+        if name not in baseline:
+            print("%-48s missing from baseline" % name)
+
+    if regressions:
+        print("\n%d significant regression(s) above %.1f%%:" % (len(regressions), args.threshold))
+        for name in regressions:
+            print("  " + name)
+        return 1
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,127 @@
+/**
+ * @file class_pool.h
+ * @author agent
+ * @brief The pre-allocated Pool every Static Class reserves its Objects from. A Pool is an array of Objects and an
+ * array of whether each Object is in use, both sized at compile-time. The Handle returned by the Constructor is the
+ * index in these arrays of the reserved Object.
+ *
+ * In Unit Tests (APPLICATION_UNIT_TEST_) both arrays are stored in the middle of a Unit Test Memory Region and are
+ * surrounded by known values, so tests/support/test_guard.h can verify no out-of-bounds memory access occurs. I.e.
+ *
+ * Unit Test: Test_<P>_Instances_Memory_Region[] = [Known Pad Bytes, <P>_Instances[], Known Pad Bytes]
+ * Normal Application: <P>_Instances[]
+ *
+ * A Class with the Pool prefix RBX declares the Unit Test Memory Regions in its Header File with
+ * CLASS_POOL_TEST_DECLARE(RBX), defines the Pool in its Source File with
+ * CLASS_POOL_DEFINE(static, RBX, struct Ring_Buffer_X_t, NUMBER_OF_STATIC_X_RING_BUFFERS) and defines
+ * RBX_Is_Valid_Handle() with
+ * CLASS_POOL_DEFINE_IS_VALID_HANDLE(RBX, Ring_Buffer_X_Static_Handle, NUMBER_OF_STATIC_X_RING_BUFFERS).
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#ifndef CLASS_POOL_H_
+#define CLASS_POOL_H_
+
+
+/* STD-C Libraries */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*--------------------------------------------------- POOL DEFINITION -------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Defines the Pool of a Class: prefix##_Instances[] holding count Objects of type and
+ * prefix##_Instances_In_Use[]. linkage is static unless other Translation Units need to reach the Pool. In Unit Tests
+ * it also defines the Unit Test Memory Regions declared by CLASS_POOL_TEST_DECLARE(). The Memory Region of the Objects
+ * is aligned like type, so the Objects in the middle are aligned like the normal Pool.
+ */
+#if defined(APPLICATION_UNIT_TEST_)
+
+    #define CLASS_POOL_DEFINE(linkage, prefix, type, count)                                                                    \
+        uint8_t Test_##prefix##_Instances_Memory_Region[(CLASS_POOL_MEMORY_EXTENSION_BYTES) + ((count) * sizeof(type)) +     \
+                                                        (CLASS_POOL_MEMORY_EXTENSION_BYTES)]                                 \
+                                                        __attribute__((aligned(__alignof__(type))));                         \
+        uint8_t Test_##prefix##_Instances_In_Use_Memory_Region[(CLASS_POOL_IN_USE_MEMORY_EXTENSION_BYTES) +                  \
+                                                               ((count) * sizeof(bool)) +                                    \
+                                                               (CLASS_POOL_IN_USE_MEMORY_EXTENSION_BYTES)];                  \
+        const size_t Test_##prefix##_Instances_Mem_Size         = sizeof(Test_##prefix##_Instances_Memory_Region);           \
+        const size_t Test_##prefix##_Instances_In_Use_Mem_Size  = sizeof(Test_##prefix##_Instances_In_Use_Memory_Region);    \
+        typedef char prefix##_Pool_Memory_Extension_Keeps_Alignment[                                                         \
+            (((CLASS_POOL_MEMORY_EXTENSION_BYTES) % __alignof__(type)) == 0) ? 1 : -1];                                      \
+        linkage type * const prefix##_Instances =                                                                            \
+            (type *)&Test_##prefix##_Instances_Memory_Region[CLASS_POOL_MEMORY_EXTENSION_BYTES];                            \
+        linkage bool * const prefix##_Instances_In_Use =                                                                     \
+            (bool *)&Test_##prefix##_Instances_In_Use_Memory_Region[CLASS_POOL_IN_USE_MEMORY_EXTENSION_BYTES]
+
+#else /* Normal Application */
+
+    #define CLASS_POOL_DEFINE(linkage, prefix, type, count)                                                                    \
+        linkage type prefix##_Instances[(count)];                                                                            \
+        linkage bool prefix##_Instances_In_Use[(count)]
+
+#endif
+
+
+/**
+ * @brief Defines prefix##_Is_Valid_Handle(), which returns if the supplied Handle (object) is valid. Valid means that
+ * the Handle was initialized successfully using the Constructor. No methods should execute for an invalid Handle.
+ * Note that the evaluation order DOES matter to avoid dereferencing NULL pointer or accessing out-of-bounds memory.
+ */
+#define CLASS_POOL_DEFINE_IS_VALID_HANDLE(prefix, handle_type, count)                                                          \
+    static inline bool prefix##_Is_Valid_Handle(const handle_type * me);                                                     \
+    static inline bool prefix##_Is_Valid_Handle(const handle_type * me)                                                      \
+    {                                                                                                                        \
+        return ((me) && (*me < (count)) && (prefix##_Instances_In_Use[(*me)]) && (prefix##_Instances[(*me)].handle == me));  \
+    }
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------ ONLY FOR UNIT TESTS. DO NOT USE IN APPLICATION ---------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+#if defined(APPLICATION_UNIT_TEST_)
+
+    /**
+     * @brief The number of Bytes to pre and postpend every Test_<P>_Instances_Memory_Region[] by. For example if this
+     * is 1024, then Test_<P>_Instances_Memory_Region[] would be:
+     * [1024 Bytes Known Values, <P>_Instances[] Objects, 1024 Bytes Known Values]
+     * Must be a multiple of the alignment of every Object, i.e. a cache line. May be overridden at compile-time, i.e.
+     * to make room for guard pages.
+     */
+    #ifndef CLASS_POOL_MEMORY_EXTENSION_BYTES
+        #define CLASS_POOL_MEMORY_EXTENSION_BYTES                                       1024
+    #endif
+
+
+    /**
+     * @brief The number of Bytes to pre and postpend every Test_<P>_Instances_In_Use_Memory_Region[] by. For example
+     * if this is 50, then Test_<P>_Instances_In_Use_Memory_Region[] would be:
+     * [50 Bytes Known Values, <P>_Instances_In_Use[], 50 Bytes Known Values]
+     */
+    #define CLASS_POOL_IN_USE_MEMORY_EXTENSION_BYTES                                    50
+
+
+    /**
+     * @brief Declares the Unit Test Memory Regions of a Class and their sizes in Bytes. Only the Memory Regions are
+     * declared since their size depends on the Object type, which stays encapsulated in the Source File.
+     */
+    #define CLASS_POOL_TEST_DECLARE(prefix)                                                                                    \
+        extern uint8_t Test_##prefix##_Instances_Memory_Region[];                                                            \
+        extern const size_t Test_##prefix##_Instances_Mem_Size;                                                              \
+        extern uint8_t Test_##prefix##_Instances_In_Use_Memory_Region[];                                                     \
+        extern const size_t Test_##prefix##_Instances_In_Use_Mem_Size
+
+#endif /* APPLICATION_UNIT_TEST_ */
+
+
+#endif /* CLASS_POOL_H_ */
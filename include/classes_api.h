@@ -0,0 +1,31 @@
+/**
+ * @file classes_api.h
+ * @author agent
+ * @brief Marks the Public Functions of the Classes. The release profile of the Class library (lib/profile.mk) is
+ * compiled with -fvisibility=hidden so only the functions marked CLASSES_API are exported when the library is linked
+ * into a shared object. Everything else stays private to the library, which lets the compiler and the link-time
+ * optimizer treat it as internal.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#ifndef CLASSES_API_H_
+#define CLASSES_API_H_
+
+
+/**
+ * @brief Placed in front of the declaration of every Public Function. Expands to nothing on compilers without
+ * symbol visibility.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+    #define CLASSES_API                                                     __attribute__((visibility("default")))
+#else
+    #define CLASSES_API
+#endif
+
+
+#endif /* CLASSES_API_H_ */
@@ -0,0 +1,264 @@
+/**
+ * @file ring_buffer_broadcast_static.h
+ * @author agent
+ * @brief Broadcast Ring Buffer with one producer and several Readers that is passed BY VALUE without the use of
+ * Dynamic Memory Allocation. Every element written is delivered to every Reader, so one Write replaces a Write to a
+ * separate Ring Buffer per Reader. Each Reader has its own cursor and reads at its own pace. Readers never modify
+ * anything another Reader uses, and the producer only overwrites an element once the slowest Reader has read it.
+ *
+ * Like the Static Ring Buffer (ring_buffer_static.h), a pool of Broadcast Ring Buffers is initialized at compile-time.
+ * The Constructor reserves one and the returned Handle is its index in the pool. Readers are registered on a
+ * constructed Broadcast Ring Buffer and get a Reader Handle, the index of their cursor. DO NOT EDIT THE VALUE OF
+ * EITHER HANDLE DIRECTLY.
+ *
+ * Thread safety: Write and Is_Full may run in one producer thread (or interrupt) while Read, Get_Number_Of_Elements
+ * and Is_Empty run concurrently in the Reader threads, each Reader in one thread at a time. No lock is taken. The
+ * producer's position and every cursor are on their own cache line, so Readers polling do not slow down each other
+ * or the producer. The Constructor, Destructor, Add_Reader and Remove_Reader are NOT thread-safe: call them while
+ * no other method of the same Broadcast Ring Buffer runs.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#ifndef RING_BUFFER_BROADCAST_STATIC_H_
+#define RING_BUFFER_BROADCAST_STATIC_H_
+
+
+/* STD-C Libraries */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Public Function visibility */
+#include "classes_api.h"
+
+/* Pool and Unit Test Memory Regions */
+#include "class_pool.h"
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------ MAXIMUM SIZES (MAXIMUM MEMORY ALLOCATED FOR BROADCAST RING BUFFER CLASS) -------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief The number of Broadcast Ring Buffer Objects that are initialized at compile-time.
+ *
+ * @note This would normally be in the Source File. However it is included in the Header File to make it visible for
+ * Unit Tests.
+ */
+#define NUMBER_OF_STATIC_BROADCAST_RING_BUFFERS                             2
+
+
+/**
+ * @brief The maximum size (number of bytes) of each Broadcast Ring Buffer Object's buffer. Same meaning as
+ * RING_BUFFER_STATIC_SIZE.
+ */
+#define RING_BUFFER_BROADCAST_STATIC_SIZE                                   200
+
+
+/**
+ * @brief The maximum number of Readers registered on one Broadcast Ring Buffer at a time. Each Reader reserves one
+ * cache line of every Broadcast Ring Buffer Object.
+ */
+#define RING_BUFFER_BROADCAST_STATIC_MAX_READERS                            4
+
+
+/**
+ * @brief Alignment, in bytes, of the producer's position and of every Reader cursor, so that no two of them share a
+ * cache line. 64 suits x86 and most Cortex-A cores. May be overridden at compile-time, i.e. 32 for a Cortex-M7 or 4
+ * for a Cortex-M without a data cache, where the padding only costs RAM. Must be a power of two and must be defined
+ * the same way for the Class library and the Application.
+ */
+#ifndef RING_BUFFER_BROADCAST_STATIC_CACHE_LINE
+    #define RING_BUFFER_BROADCAST_STATIC_CACHE_LINE                         64
+#endif
+
+
+/**
+ * @brief Checks at compile-time whether the requested Broadcast Ring Buffer is too large. Same as
+ * RING_BUFFER_SIZE_STATIC_ASSERT.
+ *
+ * @param element_size Number of bytes of each element.
+ * @param len Number of elements the requested buffer will hold.
+ */
+#define RING_BUFFER_BROADCAST_SIZE_STATIC_ASSERT(element_size, len)         (void)sizeof(char[ (1 - 2*!!( ((element_size) * (len)) > (RING_BUFFER_BROADCAST_STATIC_SIZE) ) ) ])
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*---------------------------- BROADCAST RING BUFFER CLASS HANDLES. USED AS THE CLASS OBJECTS -------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Broadcast Ring Buffer Object Handle which is similar to a Class Instance.
+ *
+ * @warning Do NOT edit this Handle directly. See Ring_Buffer_Static_Handle.
+ */
+typedef uint32_t Ring_Buffer_Broadcast_Static_Handle;
+
+
+/**
+ * @brief Reader Handle. Identifies one Reader of one Broadcast Ring Buffer and is supplied along with the Broadcast
+ * Ring Buffer Handle.
+ *
+ * @warning Do NOT edit this Handle directly. Its address is recorded by Add_Reader, so it must stay at the same place
+ * in memory until Remove_Reader is called.
+ */
+typedef uint32_t Ring_Buffer_Broadcast_Static_Reader;
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------------- PUBLIC FUNCTIONS -------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Broadcast Ring Buffer Constructor. The Broadcast Ring Buffer has no Readers yet.
+ *
+ * @param me Broadcast Ring Buffer Handle to initialize. Note that the Constructor will change the value pointed
+ * to by this Handle.
+ * @param element_size_0 Number of bytes of each element. This must be greater than 0.
+ * @param number_of_elements_0 Maximum number of elements the buffer can hold. This must be greater than 0.
+ *
+ * @return True if successful. False if unsuccessful. An unsuccessful attempt will occur if invalid arguments were
+ * supplied, the requested buffer was larger than RING_BUFFER_BROADCAST_STATIC_SIZE or no Broadcast Ring Buffer of
+ * the pool is free.
+ */
+CLASSES_API bool Ring_Buffer_Broadcast_Static_Ctor(Ring_Buffer_Broadcast_Static_Handle * me, size_t element_size_0, uint32_t number_of_elements_0);
+
+
+/**
+ * @brief Broadcast Ring Buffer Handle Destructor. Frees the Broadcast Ring Buffer that was allocated to the Handle.
+ * Every Reader Handle of it becomes invalid.
+ *
+ * @param me Broadcast Ring Buffer Handle. Constructor must have been successfully called on this Handle to
+ * use it in this function.
+ *
+ * @return True if successful. False if the supplied Handle is not valid.
+ */
+CLASSES_API bool Ring_Buffer_Broadcast_Static_Destroy(const Ring_Buffer_Broadcast_Static_Handle * me);
+
+
+/**
+ * @brief Registers a Reader. The Reader starts at the producer's current position: it reads every element written
+ * from now on, and none written before.
+ *
+ * @param me Broadcast Ring Buffer Handle. Constructor must have been successfully called on this Handle to
+ * use it in this function.
+ * @param reader Reader Handle to initialize. Note that this function will change the value pointed to by it.
+ *
+ * @return True if successful. False if unsuccessful. An unsuccessful attempt will occur if an invalid Handle or a
+ * NULL @ref reader is supplied, @ref reader is already registered on this Broadcast Ring Buffer or
+ * RING_BUFFER_BROADCAST_STATIC_MAX_READERS Readers are registered already.
+ */
+CLASSES_API bool Ring_Buffer_Broadcast_Static_Add_Reader(const Ring_Buffer_Broadcast_Static_Handle * me, Ring_Buffer_Broadcast_Static_Reader * reader);
+
+
+/**
+ * @brief Unregisters a Reader. The elements it has not read no longer hold back the producer.
+ *
+ * @param me Broadcast Ring Buffer Handle. Constructor must have been successfully called on this Handle to
+ * use it in this function.
+ * @param reader Reader Handle. Add_Reader must have been successfully called on this Handle.
+ *
+ * @return True if successful. False if either Handle is not valid.
+ */
+CLASSES_API bool Ring_Buffer_Broadcast_Static_Remove_Reader(const Ring_Buffer_Broadcast_Static_Handle * me, const Ring_Buffer_Broadcast_Static_Reader * reader);
+
+
+/**
+ * @brief Writes data BY VALUE to the Broadcast Ring Buffer, where every registered Reader can read it. Producer only.
+ *
+ * @attention The @ref data memory block must be equal to the number of bytes specified in @ref data_size
+ * otherwise behavior is undefined.
+ *
+ * @param me Broadcast Ring Buffer Handle. Constructor must have been successfully called on this Handle to
+ * use it in this function.
+ * @param data The starting memory block of data to write to the Buffer.
+ * @param data_size Number of Bytes being written. This must equal @ref element_size_0 specified in the Constructor.
+ *
+ * @return True if the Write was successful. False if unsuccessful. An unsuccessful write will occur if the slowest
+ * Reader has not read the oldest element yet (Full), an invalid Handle is supplied, a NULL data pointer is supplied,
+ * or the specified data size is not equal to @ref element_size_0. With no Readers registered the Write succeeds and
+ * the element is not delivered to anyone.
+ */
+CLASSES_API bool Ring_Buffer_Broadcast_Static_Write(const Ring_Buffer_Broadcast_Static_Handle * me, const void * data, size_t data_size);
+
+
+/**
+ * @brief Reads the next element of one Reader and advances its cursor. Other Readers are not affected.
+ *
+ * @attention The @ref data memory block must be equal to the number of bytes specified in @ref data_size
+ * otherwise behavior is undefined.
+ *
+ * @param me Broadcast Ring Buffer Handle. Constructor must have been successfully called on this Handle to
+ * use it in this function.
+ * @param reader Reader Handle. Add_Reader must have been successfully called on this Handle.
+ * @param data The starting memory block to store data in.
+ * @param data_size Number of Bytes being read. This must equal @ref element_size_0 specified in the Constructor.
+ *
+ * @return True if the Read was successful. False if unsuccessful. An unsuccessful read will occur if the Reader
+ * has read every element written (Empty), an invalid Handle is supplied, a NULL data pointer is supplied, or the
+ * specified data size is not equal to @ref element_size_0.
+ */
+CLASSES_API bool Ring_Buffer_Broadcast_Static_Read(const Ring_Buffer_Broadcast_Static_Handle * me, const Ring_Buffer_Broadcast_Static_Reader * reader, void * data, size_t data_size);
+
+
+/**
+ * @brief Returns the number of elements the Reader has not read yet.
+ *
+ * @param me Broadcast Ring Buffer Handle. Constructor must have been successfully called on this Handle to
+ * use it in this function.
+ * @param reader Reader Handle. Add_Reader must have been successfully called on this Handle.
+ *
+ * @return 0 if the Reader is Empty or an invalid Handle was supplied. Otherwise the number of elements.
+ */
+CLASSES_API uint32_t Ring_Buffer_Broadcast_Static_Get_Number_Of_Elements(const Ring_Buffer_Broadcast_Static_Handle * me, const Ring_Buffer_Broadcast_Static_Reader * reader);
+
+
+/**
+ * @brief Returns if the Reader has read every element written. Reads of this Reader cannot be performed if Empty.
+ *
+ * @param me Broadcast Ring Buffer Handle. Constructor must have been successfully called on this Handle to
+ * use it in this function.
+ * @param reader Reader Handle. Add_Reader must have been successfully called on this Handle.
+ *
+ * @return True if Empty. False if not Empty or an invalid Handle was supplied.
+ */
+CLASSES_API bool Ring_Buffer_Broadcast_Static_Is_Empty(const Ring_Buffer_Broadcast_Static_Handle * me, const Ring_Buffer_Broadcast_Static_Reader * reader);
+
+
+/**
+ * @brief Returns if the slowest Reader has not read the oldest element yet. Writes cannot be performed if Full.
+ * Producer only.
+ *
+ * @param me Broadcast Ring Buffer Handle. Constructor must have been successfully called on this Handle to
+ * use it in this function.
+ *
+ * @return True if Full or an invalid Handle was supplied. False otherwise.
+ */
+CLASSES_API bool Ring_Buffer_Broadcast_Static_Is_Full(const Ring_Buffer_Broadcast_Static_Handle * me);
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------ ONLY FOR UNIT TESTS. DO NOT USE IN APPLICATION ---------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+#if defined(APPLICATION_UNIT_TEST_)
+
+    /**
+     * @brief The Unit Test Memory Regions used to verify no out-of-bounds memory access occurs, and their sizes.
+     * Test_RBB_Instances_Memory_Region[] stores every pre-allocated Broadcast Ring Buffer Object in the middle and
+     * Test_RBB_Instances_In_Use_Memory_Region[] whether each one is in use. See class_pool.h.
+     */
+    CLASS_POOL_TEST_DECLARE(RBB);
+
+#endif /* APPLICATION_UNIT_TEST_ */
+
+
+#endif /* RING_BUFFER_BROADCAST_STATIC_H_ */
@@ -0,0 +1,176 @@
+/**
+ * @file ring_buffer_fir_static.h
+ * @author agent
+ * @brief FIR Filter Ring Buffer without the use of Dynamic Memory Allocation. Keeps the last number_of_taps_0 samples
+ * in a Ring Buffer and convolves them with the coefficients as samples stream through it:
+ *
+ *     output[n] = coefficients[0] * input[n] + coefficients[1] * input[n - 1] + ... + coefficients[T - 1] * input[n - T + 1]
+ *
+ * The Ring Buffer is mirrored: every sample is stored twice, number_of_taps_0 samples apart, so the last
+ * number_of_taps_0 samples are always contiguous and the multiply-accumulate never wraps or copies the history into a
+ * linear buffer first. It uses AVX2 or NEON when the Class is compiled for them (i.e. ARCH_FLAGS=-mavx2).
+ *
+ * The sample and coefficient type is selected at compile-time, for the library and the Application alike:
+ * - Q15 (int16_t, default). Products are accumulated in 64 bits and the result is shifted right by 15 and saturated.
+ * - Q31 (int32_t), selected with RING_BUFFER_FIR_STATIC_SAMPLE_Q31. Products are accumulated in 64 bits (2.62) and
+ *   the result is shifted right by 31 and saturated. Like CMSIS-DSP's arm_fir_q31 there is only one guard bit, so the
+ *   input must be scaled down by log2(number_of_taps_0) bits to rule out overflow.
+ * - float, selected with RING_BUFFER_FIR_STATIC_SAMPLE_FLOAT.
+ *
+ * Like the Static Ring Buffer (ring_buffer_static.h), a pool of FIR Filter Ring Buffers is initialized at
+ * compile-time. The Constructor reserves one and the returned Handle is its index in the pool. DO NOT EDIT THE VALUE
+ * OF THIS HANDLE DIRECTLY. The FIR Filter Ring Buffer is NOT thread-safe.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#ifndef RING_BUFFER_FIR_STATIC_H_
+#define RING_BUFFER_FIR_STATIC_H_
+
+
+/* STD-C Libraries */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Public Function visibility */
+#include "classes_api.h"
+
+/* Pool and Unit Test Memory Regions */
+#include "class_pool.h"
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------ MAXIMUM SIZES (MAXIMUM MEMORY ALLOCATED FOR FIR FILTER RING BUFFER CLASS) ------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief The number of FIR Filter Ring Buffer Objects that are initialized at compile-time.
+ *
+ * @note This would normally be in the Source File. However it is included in the Header File to make it visible for
+ * Unit Tests.
+ */
+#define NUMBER_OF_STATIC_FIR_RING_BUFFERS                                   2
+
+
+/**
+ * @brief The maximum number of taps (coefficients) of each FIR Filter Ring Buffer Object. Each tap reserves one
+ * coefficient and two samples.
+ */
+#define RING_BUFFER_FIR_STATIC_MAX_TAPS                                     64
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*---------------------------------------------------------- SAMPLE TYPE ----------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+#if defined(RING_BUFFER_FIR_STATIC_SAMPLE_Q31) && defined(RING_BUFFER_FIR_STATIC_SAMPLE_FLOAT)
+    #error "Define at most one of RING_BUFFER_FIR_STATIC_SAMPLE_Q31 and RING_BUFFER_FIR_STATIC_SAMPLE_FLOAT"
+#endif
+
+/**
+ * @brief The type of every sample and coefficient of every FIR Filter Ring Buffer. Q15 unless selected otherwise
+ * (see above).
+ */
+#if defined(RING_BUFFER_FIR_STATIC_SAMPLE_Q31)
+    typedef int32_t Ring_Buffer_FIR_Static_Sample;
+#elif defined(RING_BUFFER_FIR_STATIC_SAMPLE_FLOAT)
+    typedef float Ring_Buffer_FIR_Static_Sample;
+#else
+    typedef int16_t Ring_Buffer_FIR_Static_Sample;
+#endif
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------- FIR FILTER RING BUFFER CLASS HANDLE. USED AS THE CLASS OBJECT ----------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief FIR Filter Ring Buffer Object Handle which is similar to a Class Instance.
+ *
+ * @warning Do NOT edit this Handle directly. See Ring_Buffer_Static_Handle.
+ */
+typedef uint32_t Ring_Buffer_FIR_Static_Handle;
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------------- PUBLIC FUNCTIONS -------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief FIR Filter Ring Buffer Constructor. The history starts as all zeros.
+ *
+ * @param me FIR Filter Ring Buffer Handle to initialize. Note that the Constructor will change the value pointed
+ * to by this Handle.
+ * @param coefficients_0 The coefficients, coefficients_0[0] multiplying the newest sample. Copied BY VALUE.
+ * @param number_of_taps_0 Number of coefficients. From 1 to RING_BUFFER_FIR_STATIC_MAX_TAPS.
+ *
+ * @return True if successful. False if unsuccessful. An unsuccessful attempt will occur if invalid arguments were
+ * supplied or no FIR Filter Ring Buffer of the pool is free.
+ */
+CLASSES_API bool Ring_Buffer_FIR_Static_Ctor(Ring_Buffer_FIR_Static_Handle * me, const Ring_Buffer_FIR_Static_Sample * coefficients_0, uint32_t number_of_taps_0);
+
+
+/**
+ * @brief FIR Filter Ring Buffer Handle Destructor. Frees the FIR Filter Ring Buffer that was allocated to the Handle.
+ *
+ * @param me FIR Filter Ring Buffer Handle. Constructor must have been successfully called on this Handle to
+ * use it in this function.
+ *
+ * @return True if successful. False if the supplied Handle is not valid.
+ */
+CLASSES_API bool Ring_Buffer_FIR_Static_Destroy(const Ring_Buffer_FIR_Static_Handle * me);
+
+
+/**
+ * @brief Sets every sample of the history to zero, as after the Constructor. The coefficients are kept.
+ *
+ * @param me FIR Filter Ring Buffer Handle. Constructor must have been successfully called on this Handle to
+ * use it in this function.
+ *
+ * @return True if successful. False if the supplied Handle is not valid.
+ */
+CLASSES_API bool Ring_Buffer_FIR_Static_Clear(const Ring_Buffer_FIR_Static_Handle * me);
+
+
+/**
+ * @brief Streams samples through the filter. Each input sample enters the history and the filtered sample is written
+ * to the output. Blocks of any size may follow each other: the history carries over.
+ *
+ * @param me FIR Filter Ring Buffer Handle. Constructor must have been successfully called on this Handle to
+ * use it in this function.
+ * @param input The samples to filter, oldest first.
+ * @param output Where the filtered samples are written. May be @ref input to filter in place, otherwise it must not
+ * overlap it.
+ * @param count Number of samples. 0 does nothing.
+ *
+ * @return True if successful. False if an invalid Handle or a NULL pointer is supplied.
+ */
+CLASSES_API bool Ring_Buffer_FIR_Static_Process(const Ring_Buffer_FIR_Static_Handle * me, const Ring_Buffer_FIR_Static_Sample * input, Ring_Buffer_FIR_Static_Sample * output, uint32_t count);
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------ ONLY FOR UNIT TESTS. DO NOT USE IN APPLICATION ---------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+#if defined(APPLICATION_UNIT_TEST_)
+
+    /**
+     * @brief The Unit Test Memory Regions used to verify no out-of-bounds memory access occurs, and their sizes.
+     * Test_RBF_Instances_Memory_Region[] stores every pre-allocated FIR Filter Ring Buffer Object in the middle and
+     * Test_RBF_Instances_In_Use_Memory_Region[] whether each one is in use. See class_pool.h.
+     */
+    CLASS_POOL_TEST_DECLARE(RBF);
+
+#endif /* APPLICATION_UNIT_TEST_ */
+
+
+#endif /* RING_BUFFER_FIR_STATIC_H_ */
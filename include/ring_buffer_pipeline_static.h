@@ -0,0 +1,252 @@
+/**
+ * @file ring_buffer_pipeline_static.h
+ * @author agent
+ * @brief Pipeline Ring Buffer without the use of Dynamic Memory Allocation. Elements pass through a fixed number of
+ * Stages (i.e. decode, validate, dispatch) that all work IN PLACE on the slots of one Ring Buffer instead of copying
+ * every element into a Ring Buffer per Stage. The producer claims a slot, fills it and publishes it. Stage 0 then
+ * acquires it, works on it and releases it to Stage 1, and so on. Once the last Stage releases a slot the producer
+ * may reuse it.
+ *
+ * Each Stage has a sequence: the position up to which it has released elements. A Stage waits on the sequence of
+ * the Stage before it (the producer's, for Stage 0) and the producer waits on the sequence of the last Stage. These
+ * are the sequence barriers of a disruptor. Elements always pass through the Stages in the order they were published.
+ *
+ * Like the Static Ring Buffer (ring_buffer_static.h), a pool of Pipeline Ring Buffers is initialized at compile-time.
+ * The Constructor reserves one and the returned Handle is its index in the pool. DO NOT EDIT THE VALUE OF THIS
+ * HANDLE DIRECTLY.
+ *
+ * Thread safety: the producer (Claim, Publish, Write and Is_Full) and every Stage (Acquire, Release and
+ * Get_Number_Of_Elements of that Stage) may each run in their own thread (or interrupt) concurrently. No lock is
+ * taken. Each sequence is on its own cache line. One Stage must not be used by two threads at the same time. The
+ * Constructor and Destructor are NOT thread-safe.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#ifndef RING_BUFFER_PIPELINE_STATIC_H_
+#define RING_BUFFER_PIPELINE_STATIC_H_
+
+
+/* STD-C Libraries */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Public Function visibility */
+#include "classes_api.h"
+
+/* Pool and Unit Test Memory Regions */
+#include "class_pool.h"
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------- MAXIMUM SIZES (MAXIMUM MEMORY ALLOCATED FOR PIPELINE RING BUFFER CLASS) -------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief The number of Pipeline Ring Buffer Objects that are initialized at compile-time.
+ *
+ * @note This would normally be in the Source File. However it is included in the Header File to make it visible for
+ * Unit Tests.
+ */
+#define NUMBER_OF_STATIC_PIPELINE_RING_BUFFERS                              2
+
+
+/**
+ * @brief The maximum size (number of bytes) of each Pipeline Ring Buffer Object's buffer. Same meaning as
+ * RING_BUFFER_STATIC_SIZE.
+ */
+#define RING_BUFFER_PIPELINE_STATIC_SIZE                                    200
+
+
+/**
+ * @brief The maximum number of Stages of one Pipeline Ring Buffer. Each Stage reserves one cache line of every
+ * Pipeline Ring Buffer Object.
+ */
+#define RING_BUFFER_PIPELINE_STATIC_MAX_STAGES                              4
+
+
+/**
+ * @brief Alignment, in bytes, of the buffer, of the producer's sequence and of every Stage sequence, so that no two
+ * sequences share a cache line. Same meaning as RING_BUFFER_BROADCAST_STATIC_CACHE_LINE.
+ */
+#ifndef RING_BUFFER_PIPELINE_STATIC_CACHE_LINE
+    #define RING_BUFFER_PIPELINE_STATIC_CACHE_LINE                          64
+#endif
+
+
+/**
+ * @brief Checks at compile-time whether the requested Pipeline Ring Buffer is too large. Same as
+ * RING_BUFFER_SIZE_STATIC_ASSERT.
+ *
+ * @param element_size Number of bytes of each element.
+ * @param len Number of elements the requested buffer will hold.
+ */
+#define RING_BUFFER_PIPELINE_SIZE_STATIC_ASSERT(element_size, len)          (void)sizeof(char[ (1 - 2*!!( ((element_size) * (len)) > (RING_BUFFER_PIPELINE_STATIC_SIZE) ) ) ])
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*---------------------------- PIPELINE RING BUFFER CLASS HANDLE. USED AS THE CLASS OBJECT ----------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Pipeline Ring Buffer Object Handle which is similar to a Class Instance.
+ *
+ * @warning Do NOT edit this Handle directly. See Ring_Buffer_Static_Handle.
+ */
+typedef uint32_t Ring_Buffer_Pipeline_Static_Handle;
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------------- PUBLIC FUNCTIONS -------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Pipeline Ring Buffer Constructor.
+ *
+ * @param me Pipeline Ring Buffer Handle to initialize. Note that the Constructor will change the value pointed
+ * to by this Handle.
+ * @param element_size_0 Number of bytes of each element. This must be greater than 0. Slot i starts
+ * i * @ref element_size_0 bytes after a RING_BUFFER_PIPELINE_STATIC_CACHE_LINE aligned address, so a struct type
+ * whose size is a multiple of its alignment can be used in place.
+ * @param number_of_elements_0 Maximum number of elements in the Pipeline at once. This must be greater than 0.
+ * @param number_of_stages_0 Number of Stages each element passes through. From 1 to
+ * RING_BUFFER_PIPELINE_STATIC_MAX_STAGES.
+ *
+ * @return True if successful. False if unsuccessful. An unsuccessful attempt will occur if invalid arguments were
+ * supplied, the requested buffer was larger than RING_BUFFER_PIPELINE_STATIC_SIZE or no Pipeline Ring Buffer of the
+ * pool is free.
+ */
+CLASSES_API bool Ring_Buffer_Pipeline_Static_Ctor(Ring_Buffer_Pipeline_Static_Handle * me, size_t element_size_0, uint32_t number_of_elements_0, uint32_t number_of_stages_0);
+
+
+/**
+ * @brief Pipeline Ring Buffer Handle Destructor. Frees the Pipeline Ring Buffer that was allocated to the Handle.
+ *
+ * @param me Pipeline Ring Buffer Handle. Constructor must have been successfully called on this Handle to
+ * use it in this function.
+ *
+ * @return True if successful. False if the supplied Handle is not valid.
+ */
+CLASSES_API bool Ring_Buffer_Pipeline_Static_Destroy(const Ring_Buffer_Pipeline_Static_Handle * me);
+
+
+/**
+ * @brief Claims the next free slot for the producer to fill in place. Claiming again before Publish returns the
+ * same slot. Producer only.
+ *
+ * @param me Pipeline Ring Buffer Handle. Constructor must have been successfully called on this Handle to
+ * use it in this function.
+ * @param slot Set to the first byte of the slot, element_size_0 bytes long. It belongs to the producer until Publish.
+ *
+ * @return True if successful. False if unsuccessful. An unsuccessful claim will occur if the last Stage has not
+ * released the oldest element yet (Full), an invalid Handle is supplied or @ref slot is NULL.
+ */
+CLASSES_API bool Ring_Buffer_Pipeline_Static_Claim(const Ring_Buffer_Pipeline_Static_Handle * me, void ** slot);
+
+
+/**
+ * @brief Publishes the claimed slot to Stage 0. The producer must not touch it afterwards. Producer only.
+ *
+ * @param me Pipeline Ring Buffer Handle. Constructor must have been successfully called on this Handle to
+ * use it in this function.
+ *
+ * @return True if successful. False if no slot is claimed or an invalid Handle is supplied.
+ */
+CLASSES_API bool Ring_Buffer_Pipeline_Static_Publish(const Ring_Buffer_Pipeline_Static_Handle * me);
+
+
+/**
+ * @brief Copies data BY VALUE into the next free slot and publishes it, i.e. Claim, memcpy and Publish. Producer only.
+ *
+ * @param me Pipeline Ring Buffer Handle. Constructor must have been successfully called on this Handle to
+ * use it in this function.
+ * @param data The starting memory block of data to write.
+ * @param data_size Number of Bytes being written. This must equal @ref element_size_0 specified in the Constructor.
+ *
+ * @return True if the Write was successful. False if unsuccessful. An unsuccessful write will occur if the Pipeline
+ * is Full, a slot is claimed and not published yet, an invalid Handle is supplied, a NULL data pointer is supplied,
+ * or the specified data size is not equal to @ref element_size_0.
+ */
+CLASSES_API bool Ring_Buffer_Pipeline_Static_Write(const Ring_Buffer_Pipeline_Static_Handle * me, const void * data, size_t data_size);
+
+
+/**
+ * @brief Acquires the next element the previous Stage (the producer, for Stage 0) has released, to work on in place.
+ * Acquiring again before Release returns the same slot.
+ *
+ * @param me Pipeline Ring Buffer Handle. Constructor must have been successfully called on this Handle to
+ * use it in this function.
+ * @param stage Stage number. From 0 to number_of_stages_0 - 1.
+ * @param slot Set to the first byte of the slot, element_size_0 bytes long. It belongs to @ref stage until Release.
+ *
+ * @return True if successful. False if unsuccessful. An unsuccessful acquire will occur if the previous Stage has
+ * released nothing new (Empty), an invalid Handle or @ref stage is supplied or @ref slot is NULL.
+ */
+CLASSES_API bool Ring_Buffer_Pipeline_Static_Acquire(const Ring_Buffer_Pipeline_Static_Handle * me, uint32_t stage, void ** slot);
+
+
+/**
+ * @brief Releases the acquired element to the next Stage. Releasing it from the last Stage frees the slot for the
+ * producer. @ref stage must not touch it afterwards.
+ *
+ * @param me Pipeline Ring Buffer Handle. Constructor must have been successfully called on this Handle to
+ * use it in this function.
+ * @param stage Stage number. From 0 to number_of_stages_0 - 1.
+ *
+ * @return True if successful. False if @ref stage has not acquired an element or an invalid Handle or @ref stage is
+ * supplied.
+ */
+CLASSES_API bool Ring_Buffer_Pipeline_Static_Release(const Ring_Buffer_Pipeline_Static_Handle * me, uint32_t stage);
+
+
+/**
+ * @brief Returns the number of elements waiting for a Stage: released by the previous Stage and not yet released by
+ * this one, including an element this Stage has acquired. A Stage can process this many in a batch without looking
+ * at the previous Stage's sequence again.
+ *
+ * @param me Pipeline Ring Buffer Handle. Constructor must have been successfully called on this Handle to
+ * use it in this function.
+ * @param stage Stage number. From 0 to number_of_stages_0 - 1.
+ *
+ * @return 0 if nothing is waiting or an invalid Handle or @ref stage was supplied. Otherwise the number of elements.
+ */
+CLASSES_API uint32_t Ring_Buffer_Pipeline_Static_Get_Number_Of_Elements(const Ring_Buffer_Pipeline_Static_Handle * me, uint32_t stage);
+
+
+/**
+ * @brief Returns if the last Stage has not released the oldest element yet. Claims cannot be performed if Full.
+ * Producer only.
+ *
+ * @param me Pipeline Ring Buffer Handle. Constructor must have been successfully called on this Handle to
+ * use it in this function.
+ *
+ * @return True if Full or an invalid Handle was supplied. False otherwise.
+ */
+CLASSES_API bool Ring_Buffer_Pipeline_Static_Is_Full(const Ring_Buffer_Pipeline_Static_Handle * me);
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------ ONLY FOR UNIT TESTS. DO NOT USE IN APPLICATION ---------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+#if defined(APPLICATION_UNIT_TEST_)
+
+    /**
+     * @brief The Unit Test Memory Regions used to verify no out-of-bounds memory access occurs, and their sizes.
+     * Test_RBP_Instances_Memory_Region[] stores every pre-allocated Pipeline Ring Buffer Object in the middle and
+     * Test_RBP_Instances_In_Use_Memory_Region[] whether each one is in use. See class_pool.h.
+     */
+    CLASS_POOL_TEST_DECLARE(RBP);
+
+#endif /* APPLICATION_UNIT_TEST_ */
+
+
+#endif /* RING_BUFFER_PIPELINE_STATIC_H_ */
@@ -27,6 +27,15 @@
 #include <stddef.h>
 #include <stdint.h>
 
+/* Public Function visibility */
+#include "classes_api.h"
+
+/* Pool and Unit Test Memory Regions */
+#include "class_pool.h"
+
+/* RING_BUFFER_STATIC_FD_IO */
+#include "ring_buffer_static_config.h"
+
 
 
 /*---------------------------------------------------------------------------------------------------------------------------*/
@@ -86,6 +95,26 @@ typedef uint32_t Ring_Buffer_Static_Handle;
 
 
 
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------- INLINE BUILD CONFIGURATION ----------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Define RING_BUFFER_STATIC_INLINE (i.e. -DRING_BUFFER_STATIC_INLINE) to compile Write, Read,
+ * Get_Number_Of_Elements, Is_Empty and Is_Full into the Caller as static inline functions instead of calling
+ * ring_buffer_static.c. This removes the call overhead from call-heavy loops without link-time optimization.
+ *
+ * @warning This exposes the Ring Buffer type and Pool to every file including this Header, so it is not the default.
+ * It must be defined the same way for the Class library and every file of the Application including this Header.
+ */
+#if defined(RING_BUFFER_STATIC_INLINE)
+    #define RING_BUFFER_STATIC_HOT_API                                      static inline
+#else
+    #define RING_BUFFER_STATIC_HOT_API                                      CLASSES_API
+#endif
+
+
+
 /*---------------------------------------------------------------------------------------------------------------------------*/
 /*-------------------------------------------------- PUBLIC FUNCTIONS -------------------------------------------------------*/
 /*---------------------------------------------------------------------------------------------------------------------------*/
@@ -109,7 +138,7 @@ typedef uint32_t Ring_Buffer_Static_Handle;
  * were supplied or the requested buffer was too large to store. To avoid Dynamic Memory Allocation each Ring
  * Buffer has a fixed size. The requested storage cannot be greater than this fixed size.
  */
-bool Ring_Buffer_Static_Ctor(Ring_Buffer_Static_Handle * me, size_t element_size_0, uint32_t number_of_elements_0);
+CLASSES_API bool Ring_Buffer_Static_Ctor(Ring_Buffer_Static_Handle * me, size_t element_size_0, uint32_t number_of_elements_0);
 
 
 /**
@@ -121,7 +150,7 @@ bool Ring_Buffer_Static_Ctor(Ring_Buffer_Static_Handle * me, size_t element_size
  * @return True if successful. False if unsuccessful. An unsuccessful attempt will occur if the
  * supplied Handle is not valid.
  */
-bool Ring_Buffer_Static_Destroy(const Ring_Buffer_Static_Handle * me);
+CLASSES_API bool Ring_Buffer_Static_Destroy(const Ring_Buffer_Static_Handle * me);
 
 
 /**
@@ -135,7 +164,7 @@ bool Ring_Buffer_Static_Destroy(const Ring_Buffer_Static_Handle * me);
  * @return True if successful. False if unsuccessful. An unsuccessful attempt will occur if the
  * supplied Handle is not valid.
  */
-bool Ring_Buffer_Static_Clear(const Ring_Buffer_Static_Handle * me);
+CLASSES_API bool Ring_Buffer_Static_Clear(const Ring_Buffer_Static_Handle * me);
 
 
 /**
@@ -155,7 +184,7 @@ bool Ring_Buffer_Static_Clear(const Ring_Buffer_Static_Handle * me);
  * the Buffer is Full, an invalid Handle is supplied, a NULL data pointer is supplied, or the specified 
  * data size is not equal to @ref element_size_0 specified when the Constructor was called.
  */
-bool Ring_Buffer_Static_Write(const Ring_Buffer_Static_Handle * me, const void * data, size_t data_size);
+RING_BUFFER_STATIC_HOT_API bool Ring_Buffer_Static_Write(const Ring_Buffer_Static_Handle * me, const void * data, size_t data_size);
 
 
 /**
@@ -174,7 +203,7 @@ bool Ring_Buffer_Static_Write(const Ring_Buffer_Static_Handle * me, const void *
  * the Buffer is Empty, an invalid Handle is supplied, a NULL data pointer is supplied, or the specified 
  * data size is not equal to @ref element_size_0 specified when the Constructor was called.
  */
-bool Ring_Buffer_Static_Read(const Ring_Buffer_Static_Handle * me, void * data, size_t data_size);
+RING_BUFFER_STATIC_HOT_API bool Ring_Buffer_Static_Read(const Ring_Buffer_Static_Handle * me, void * data, size_t data_size);
 
 
 /**
@@ -187,7 +216,7 @@ bool Ring_Buffer_Static_Read(const Ring_Buffer_Static_Handle * me, void * data,
  * @return Returns 0 if the Ring Buffer is currently empty or an invalid Handle was supplied.
  * Otherwise returns the number of elements.
  */
-uint32_t Ring_Buffer_Static_Get_Number_Of_Elements(const Ring_Buffer_Static_Handle * me);
+RING_BUFFER_STATIC_HOT_API uint32_t Ring_Buffer_Static_Get_Number_Of_Elements(const Ring_Buffer_Static_Handle * me);
 
 
 /**
@@ -199,7 +228,7 @@ uint32_t Ring_Buffer_Static_Get_Number_Of_Elements(const Ring_Buffer_Static_Hand
  * 
  * @return True if Empty. False if not Empty or an invalid Handle was supplied.
  */
-bool Ring_Buffer_Static_Is_Empty(const Ring_Buffer_Static_Handle * me);
+RING_BUFFER_STATIC_HOT_API bool Ring_Buffer_Static_Is_Empty(const Ring_Buffer_Static_Handle * me);
 
 
 /**
@@ -210,68 +239,82 @@ bool Ring_Buffer_Static_Is_Empty(const Ring_Buffer_Static_Handle * me);
  * 
  * @return True if Full or an invalid Handle was supplied. False otherwise.
  */
-bool Ring_Buffer_Static_Is_Full(const Ring_Buffer_Static_Handle * me);
+RING_BUFFER_STATIC_HOT_API bool Ring_Buffer_Static_Is_Full(const Ring_Buffer_Static_Handle * me);
 
 
 
 /*---------------------------------------------------------------------------------------------------------------------------*/
-/*------------------------------------------ ONLY FOR UNIT TESTS. DO NOT USE IN APPLICATION ---------------------------------*/
+/*--------------------------------------------- FILE DESCRIPTOR I/O. POSIX SYSTEMS ONLY -------------------------------------*/
 /*---------------------------------------------------------------------------------------------------------------------------*/
-#if defined(APPLICATION_UNIT_TEST_)
-
-    /**
-     * @brief The Unit Test Memory Region used to verify no out-of-bounds memory access occurs.
-     * This stores all pre-allocated Ring Buffer Objects in the middle and is surrounded by 
-     * RB_INSTANCES_MEMORY_EXTENSION_BYTES of known values. For example if 
-     * RB_INSTANCES_MEMORY_EXTENSION_BYTES is 1000, then Test_RB_Instances_Memory_Region[] would be: 
-     * [1000 Bytes Known Values, RB_Instances[] Objects, 1000 Bytes Known Values]
-     * 
-     * @note Only a pointer is declared since the size of this array must be defined in the 
-     * Source File to keep the Ring Buffer type encapsulated and keep the Source Code consistent.
-     * I.e. Only one Ring Buffer type is defined so if it ever changes these values would 
-     * automatically update with no intervention required and the type will remain encapsulated.
-     */
-    extern uint8_t Test_RB_Instances_Memory_Region[];
 
+/**
+ * @brief The File Descriptor methods move bytes between a file descriptor (socket, pipe, serial port...) and the Ring
+ * Buffer with a single readv() or writev() call, straight into or out of the Buffer, instead of going through a
+ * temporary buffer and a Write or Read per byte. They are compiled on POSIX systems unless
+ * RING_BUFFER_STATIC_NO_FD_IO is defined.
+ *
+ * @attention Only for byte stream Ring Buffers, i.e. element_size_0 of 1. readv() and writev() may stop in the middle
+ * of an element and a partially transferred element cannot be undone.
+ */
+#if defined(RING_BUFFER_STATIC_FD_IO)
 
-    /**
-     * @brief The number of Bytes to pre and postpend Test_RB_Instances_Memory_Region[] by.
-     * For example if this is 1000, then Test_RB_Instances_Memory_Region[] would be: 
-     * [1000 Bytes Known Values, RB_Instances[] Objects, 1000 Bytes Known Values]
-     */
-    #define RB_INSTANCES_MEMORY_EXTENSION_BYTES                                         1000
+/**
+ * @brief Reads as many bytes from @ref fd as the Ring Buffer has free space for, with one readv() call over the (at
+ * most two) free regions of the Buffer, and increments HEAD by the number of bytes read.
+ * 
+ * @param me Ring Buffer Handle. Constructor must have been successfully called on this Handle with an
+ * element_size_0 of 1 to use it in this function.
+ * @param fd File descriptor to read from. Blocking or non-blocking.
+ * @param bytes_read Set to the number of bytes read. 0 means end of file.
+ * 
+ * @return True if readv() succeeded. False if unsuccessful. An unsuccessful read will occur if the Buffer is Full,
+ * an invalid Handle is supplied, a NULL @ref bytes_read is supplied, the elements are not single bytes, or readv()
+ * failed. In the last case errno is left as readv() set it (i.e. EAGAIN) and the Ring Buffer is unchanged.
+ */
+CLASSES_API bool Ring_Buffer_Static_Fill_From_Fd(const Ring_Buffer_Static_Handle * me, int fd, size_t * bytes_read);
 
 
-    /**
-     * @brief Number of Bytes Test_RB_Instances_Memory_Region[] is.  
-     */
-    extern const size_t Test_RB_Instances_Mem_Size;
+/**
+ * @brief Writes as many bytes of the Ring Buffer to @ref fd as it accepts, with one writev() call over the (at most
+ * two) used regions of the Buffer, increments TAIL by the number of bytes written and updates empty status.
+ * 
+ * @param me Ring Buffer Handle. Constructor must have been successfully called on this Handle with an
+ * element_size_0 of 1 to use it in this function.
+ * @param fd File descriptor to write to. Blocking or non-blocking.
+ * @param bytes_written Set to the number of bytes written. May be less than the number stored.
+ * 
+ * @return True if writev() succeeded. False if unsuccessful. An unsuccessful write will occur if the Buffer is Empty,
+ * an invalid Handle is supplied, a NULL @ref bytes_written is supplied, the elements are not single bytes, or
+ * writev() failed. In the last case errno is left as writev() set it (i.e. EAGAIN) and the Ring Buffer is unchanged.
+ */
+CLASSES_API bool Ring_Buffer_Static_Drain_To_Fd(const Ring_Buffer_Static_Handle * me, int fd, size_t * bytes_written);
 
+#endif /* RING_BUFFER_STATIC_FD_IO */
 
-    /**
-     * @brief The Unit Test Memory Region used to verify no out-of-bounds memory access occurs.
-     * This stores the statuses of whether each Ring Buffer Object is free or in use. These 
-     * statuses are stored in the middle and are surrounded by RB_INSTANCES_IN_USE_MEMORY_EXTENSION_BYTES 
-     * of known values. For example if RB_INSTANCES_IN_USE_MEMORY_EXTENSION_BYTES is 50, then 
-     * Test_RB_Instances_In_Use_Memory_Region[] would be: 
-     * [50 Bytes Known Values, RB_Instances_In_Use[], 50 Bytes Known Values]
-     */
-    extern uint8_t Test_RB_Instances_In_Use_Memory_Region[];
 
-    /**
-     * @brief The number of Bytes to pre and postpend Test_RB_Instances_In_Use_Memory_Region[] by.
-     * For example if this is 50, then Test_RB_Instances_In_Use_Memory_Region[] would be: 
-     * [50 Bytes Known Values, RB_Instances_In_Use[], 50 Bytes Known Values]
-     */
-    #define RB_INSTANCES_IN_USE_MEMORY_EXTENSION_BYTES                                  50
 
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------ ONLY FOR UNIT TESTS. DO NOT USE IN APPLICATION ---------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+#if defined(APPLICATION_UNIT_TEST_)
 
     /**
-     * @brief Number of Bytes Test_RB_Instances_In_Use_Memory_Region[] is.  
+     * @brief The Unit Test Memory Regions used to verify no out-of-bounds memory access occurs, and their sizes.
+     * Test_RB_Instances_Memory_Region[] stores every pre-allocated Ring Buffer Object in the middle and
+     * Test_RB_Instances_In_Use_Memory_Region[] whether each one is in use. See class_pool.h.
      */
-    extern const size_t Test_RB_Instances_In_Use_Mem_Size;
+    CLASS_POOL_TEST_DECLARE(RB);
 
 #endif /* APPLICATION_UNIT_TEST_ */
 
 
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------- INLINE HOT-PATH FUNCTIONS (RING_BUFFER_STATIC_INLINE) ------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+#if defined(RING_BUFFER_STATIC_INLINE)
+    #include "ring_buffer_static_inline.h"
+#endif
+
+
 #endif /* RING_BUFFER_STATIC_H_ */
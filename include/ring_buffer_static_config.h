@@ -0,0 +1,30 @@
+/**
+ * @file ring_buffer_static_config.h
+ * @author agent
+ * @brief Build configuration of the Static Ring Buffer that is decided by the preprocessor alone. It includes no
+ * system header, so ring_buffer_static.c can include it first and request the POSIX interfaces the configuration
+ * needs before any system header is seen.
+ *
+ * DO NOT INCLUDE THIS FILE DIRECTLY. Include ring_buffer_static.h.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#ifndef RING_BUFFER_STATIC_CONFIG_H_
+#define RING_BUFFER_STATIC_CONFIG_H_
+
+
+/**
+ * @brief Defined when the File Descriptor methods (see ring_buffer_static.h) are compiled: on POSIX systems unless
+ * RING_BUFFER_STATIC_NO_FD_IO is defined.
+ */
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(RING_BUFFER_STATIC_NO_FD_IO)
+    #define RING_BUFFER_STATIC_FD_IO
+#endif
+
+
+#endif /* RING_BUFFER_STATIC_CONFIG_H_ */
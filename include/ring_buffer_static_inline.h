@@ -0,0 +1,202 @@
+/**
+ * @file ring_buffer_static_inline.h
+ * @author agent
+ * @brief Implementation of the hot-path Ring Buffer methods: Write, Read, Get_Number_Of_Elements, Is_Empty and
+ * Is_Full. By default this is only included by ring_buffer_static.c and the methods are normal out-of-line functions.
+ * When RING_BUFFER_STATIC_INLINE is defined ring_buffer_static.h includes it as well, so the methods are compiled
+ * into the Caller as static inline functions.
+ *
+ * DO NOT INCLUDE THIS FILE DIRECTLY. Include ring_buffer_static.h. Nothing here is part of the Public Interface.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#ifndef RING_BUFFER_STATIC_INLINE_H_
+#define RING_BUFFER_STATIC_INLINE_H_
+
+
+/* Ring Buffer Handle and Public Function declarations */
+#include "ring_buffer_static.h"
+
+/* STD-C Libraries. */
+#include <string.h>     /* size_t, memcpy */
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*--------------------------- RING BUFFER CLASS DEFINITION. ONLY VISIBLE TO THE APPLICATION WHEN ----------------------------*/
+/*------------------------------------------ RING_BUFFER_STATIC_INLINE IS DEFINED. ------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief The Ring Buffer Object. The Application must still only use the Handle, even when this is visible.
+ */
+struct Ring_Buffer_t
+{
+    Ring_Buffer_Static_Handle * handle;         /* Handle using the Ring Buffer. Address comparison ensures multiple Handles can't use the same Ring Buffer. */
+    uint8_t buffer[RING_BUFFER_STATIC_SIZE];
+    volatile size_t head;
+    volatile size_t tail;
+    size_t element_size;                        /* Number of Bytes */
+    size_t capacity;                            /* Number of Bytes */
+    bool is_empty;
+};
+
+
+/**
+ * @brief Linkage of the Pool. The Pool is defined in ring_buffer_static.c. It keeps internal linkage unless the
+ * inline methods compiled into other Translation Units need to reach it.
+ */
+#if defined(RING_BUFFER_STATIC_INLINE)
+    #define RB_POOL_LINKAGE                                                 extern CLASSES_API
+#else
+    #define RB_POOL_LINKAGE                                                 static
+#endif
+
+
+/**
+ * @brief The pre-allocated Pool of Ring Buffers and whether each one is in use. See ring_buffer_static.c.
+ * Unit Tests store them in the middle of the Unit Test Memory Regions, so they are pointers instead of arrays.
+ */
+#if defined(APPLICATION_UNIT_TEST_)
+    RB_POOL_LINKAGE struct Ring_Buffer_t * const RB_Instances;
+    RB_POOL_LINKAGE bool * const RB_Instances_In_Use;
+#else
+    RB_POOL_LINKAGE struct Ring_Buffer_t RB_Instances[NUMBER_OF_STATIC_RING_BUFFERS];
+    RB_POOL_LINKAGE bool RB_Instances_In_Use[NUMBER_OF_STATIC_RING_BUFFERS];
+#endif
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ HELPER FUNCTIONS ---------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Returns if the supplied Ring Buffer Handle (object) is valid. Valid means that the
+ * Ring Buffer Handle was initialized successfully using the Constructor.
+ *
+ * @param me Ring Buffer Handle to check.
+ *
+ * @return True if the Handle is valid. False if the Handle is invalid. No Ring Buffer methods should
+ * execute for an invalid Handle.
+ */
+CLASS_POOL_DEFINE_IS_VALID_HANDLE(RB, Ring_Buffer_Static_Handle, NUMBER_OF_STATIC_RING_BUFFERS)
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*--------------------------------------------------- HOT-PATH PUBLIC FUNCTIONS ---------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+RING_BUFFER_STATIC_HOT_API bool Ring_Buffer_Static_Write(const Ring_Buffer_Static_Handle * me, const void * data, size_t data_size)
+{
+    bool success = false;
+
+    /**
+     * data_size is checked to ensure Ring Buffer consists of the same types. Also note
+     * that Is_Full also calls RB_Is_Valid_Handle() since this is a Public Method. If further
+     * optimization is needed then the body of Is_Full can be copied into this function.
+     */
+    if (RB_Is_Valid_Handle(me) && (!Ring_Buffer_Static_Is_Full(me)) && (data) && (data_size == RB_Instances[(*me)].element_size))
+    {
+        /* Copy data directly from memory so it is passed BY VALUE. */
+        memcpy((void *)(RB_Instances[(*me)].buffer + RB_Instances[(*me)].head), data, data_size);
+        RB_Instances[(*me)].head = (RB_Instances[(*me)].head + data_size) % RB_Instances[(*me)].capacity;
+        RB_Instances[(*me)].is_empty = false;
+        success = true;
+    }
+
+    return success;
+}
+
+
+RING_BUFFER_STATIC_HOT_API bool Ring_Buffer_Static_Read(const Ring_Buffer_Static_Handle * me, void * data, size_t data_size)
+{
+    bool success = false;
+
+    /**
+     * data_size is checked to ensure Ring Buffer consists of the same types. Also note
+     * that Is_Empty also calls RB_Is_Valid_Handle() since this is a Public Method. If further
+     * optimization is needed then the body of Is_Empty can be copied into this function.
+     */
+    if (RB_Is_Valid_Handle(me) && !Ring_Buffer_Static_Is_Empty(me) && (data) && (data_size == RB_Instances[(*me)].element_size))
+    {
+        /* Copy data directly from memory so it is passed BY VALUE. */
+        memcpy(data, (const void *)(RB_Instances[(*me)].buffer + RB_Instances[(*me)].tail), data_size);
+        RB_Instances[(*me)].tail = (RB_Instances[(*me)].tail + data_size) % (RB_Instances[(*me)].capacity);
+
+        if (RB_Instances[(*me)].head == RB_Instances[(*me)].tail)
+        {
+            RB_Instances[(*me)].is_empty = true;
+        }
+
+        success = true;
+    }
+
+    return success;
+}
+
+
+RING_BUFFER_STATIC_HOT_API uint32_t Ring_Buffer_Static_Get_Number_Of_Elements(const Ring_Buffer_Static_Handle * me)
+{
+    uint32_t num_of_elements = 0;
+
+    if (RB_Is_Valid_Handle(me))
+    {
+        /**
+         * Note that Is_Full and Is_Empty also call RB_Is_Valid_Handle() since these are Public
+         * Methods. If further optimization is needed then the body of Is_Full and Is_Empty
+         * can be copied into this function.
+         */
+        if (Ring_Buffer_Static_Is_Full(me))
+        {
+            num_of_elements = RB_Instances[(*me)].capacity / RB_Instances[(*me)].element_size;
+        }
+        else if (Ring_Buffer_Static_Is_Empty(me))
+        {
+            num_of_elements = 0;
+        }
+        else
+        {
+            /* Head may have wrapped around behind tail. Adding capacity first keeps the subtraction from underflowing. */
+            num_of_elements = ((RB_Instances[(*me)].head + RB_Instances[(*me)].capacity - RB_Instances[(*me)].tail) %
+                               RB_Instances[(*me)].capacity) / RB_Instances[(*me)].element_size;
+        }
+    }
+
+    return num_of_elements;
+}
+
+
+RING_BUFFER_STATIC_HOT_API bool Ring_Buffer_Static_Is_Empty(const Ring_Buffer_Static_Handle * me)
+{
+    bool empty = false;
+
+    if (RB_Is_Valid_Handle(me))
+    {
+        empty = RB_Instances[(*me)].is_empty;
+    }
+
+    return empty;
+}
+
+
+RING_BUFFER_STATIC_HOT_API bool Ring_Buffer_Static_Is_Full(const Ring_Buffer_Static_Handle * me)
+{
+    bool full = true;
+
+    if (RB_Is_Valid_Handle(me))
+    {
+        full = (RB_Instances[(*me)].head == RB_Instances[(*me)].tail) && !(RB_Instances[(*me)].is_empty);
+    }
+
+    return full;
+}
+
+
+#endif /* RING_BUFFER_STATIC_INLINE_H_ */
@@ -0,0 +1,230 @@
+/**
+ * @file ring_buffer_window_static.h
+ * @author agent
+ * @brief Window Ring Buffer without the use of Dynamic Memory Allocation. Keeps the last window_length_0 samples
+ * (i.e. of an ADC) and their mean, minimum, maximum and RMS. Rescanning the whole window on every sample is O(N). This
+ * Class instead updates running sums and two monotonic deques as each sample is pushed, so the statistics cost O(1)
+ * per sample (amortized for the minimum and maximum).
+ *
+ * The running sums of the floating-point sample types drift as rounding errors of added and removed samples pile up.
+ * Ring_Buffer_Window_Static_Recompute() sums the whole window again. It uses AVX2 or NEON when the Class is compiled
+ * for them (i.e. ARCH_FLAGS=-mavx2), and Push calls it every RING_BUFFER_WINDOW_STATIC_RECOMPUTE_PERIOD samples.
+ *
+ * The sample type is selected at compile-time, for the library and the Application alike:
+ * RING_BUFFER_WINDOW_STATIC_SAMPLE_INT32 selects int32_t, RING_BUFFER_WINDOW_STATIC_SAMPLE_FLOAT selects float and
+ * neither selects int16_t. NaN samples are not supported.
+ *
+ * Like the Static Ring Buffer (ring_buffer_static.h), a pool of Window Ring Buffers is initialized at compile-time.
+ * The Constructor reserves one and the returned Handle is its index in the pool. DO NOT EDIT THE VALUE OF THIS
+ * HANDLE DIRECTLY. The Window Ring Buffer is NOT thread-safe.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#ifndef RING_BUFFER_WINDOW_STATIC_H_
+#define RING_BUFFER_WINDOW_STATIC_H_
+
+
+/* STD-C Libraries */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Public Function visibility */
+#include "classes_api.h"
+
+/* Pool and Unit Test Memory Regions */
+#include "class_pool.h"
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*--------------------------- MAXIMUM SIZES (MAXIMUM MEMORY ALLOCATED FOR WINDOW RING BUFFER CLASS) -------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief The number of Window Ring Buffer Objects that are initialized at compile-time.
+ *
+ * @note This would normally be in the Source File. However it is included in the Header File to make it visible for
+ * Unit Tests.
+ */
+#define NUMBER_OF_STATIC_WINDOW_RING_BUFFERS                                2
+
+
+/**
+ * @brief The maximum number of samples in the window of each Window Ring Buffer Object. Each sample reserves the
+ * sample itself and one uint32_t in each of the two monotonic deques.
+ */
+#define RING_BUFFER_WINDOW_STATIC_MAX_LENGTH                                128
+
+
+/**
+ * @brief Number of Pushes after which Push recomputes the running sums with Ring_Buffer_Window_Static_Recompute().
+ * 0 never does. The sums of int16_t samples are exact integers and never drift, so it defaults to 0 for them.
+ */
+#ifndef RING_BUFFER_WINDOW_STATIC_RECOMPUTE_PERIOD
+    #if defined(RING_BUFFER_WINDOW_STATIC_SAMPLE_INT32) || defined(RING_BUFFER_WINDOW_STATIC_SAMPLE_FLOAT)
+        #define RING_BUFFER_WINDOW_STATIC_RECOMPUTE_PERIOD                  4096
+    #else
+        #define RING_BUFFER_WINDOW_STATIC_RECOMPUTE_PERIOD                  0
+    #endif
+#endif
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*---------------------------------------------------------- SAMPLE TYPE ----------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+#if defined(RING_BUFFER_WINDOW_STATIC_SAMPLE_INT32) && defined(RING_BUFFER_WINDOW_STATIC_SAMPLE_FLOAT)
+    #error "Define at most one of RING_BUFFER_WINDOW_STATIC_SAMPLE_INT32 and RING_BUFFER_WINDOW_STATIC_SAMPLE_FLOAT"
+#endif
+
+/**
+ * @brief The type of every sample of every Window Ring Buffer. int16_t unless selected otherwise (see above).
+ */
+#if defined(RING_BUFFER_WINDOW_STATIC_SAMPLE_INT32)
+    typedef int32_t Ring_Buffer_Window_Static_Sample;
+#elif defined(RING_BUFFER_WINDOW_STATIC_SAMPLE_FLOAT)
+    typedef float Ring_Buffer_Window_Static_Sample;
+#else
+    typedef int16_t Ring_Buffer_Window_Static_Sample;
+#endif
+
+
+/**
+ * @brief The statistics of the samples in the window.
+ */
+typedef struct
+{
+    Ring_Buffer_Window_Static_Sample min;
+    Ring_Buffer_Window_Static_Sample max;
+    float mean;
+    float rms;                                  /* Square root of the mean of the squared samples. */
+} Ring_Buffer_Window_Static_Stats;
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*----------------------------- WINDOW RING BUFFER CLASS HANDLE. USED AS THE CLASS OBJECT -----------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Window Ring Buffer Object Handle which is similar to a Class Instance.
+ *
+ * @warning Do NOT edit this Handle directly. See Ring_Buffer_Static_Handle.
+ */
+typedef uint32_t Ring_Buffer_Window_Static_Handle;
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------------- PUBLIC FUNCTIONS -------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Window Ring Buffer Constructor. The window starts empty.
+ *
+ * @param me Window Ring Buffer Handle to initialize. Note that the Constructor will change the value pointed
+ * to by this Handle.
+ * @param window_length_0 Number of most recent samples the statistics are computed over. From 1 to
+ * RING_BUFFER_WINDOW_STATIC_MAX_LENGTH.
+ *
+ * @return True if successful. False if unsuccessful. An unsuccessful attempt will occur if an invalid argument was
+ * supplied or no Window Ring Buffer of the pool is free.
+ */
+CLASSES_API bool Ring_Buffer_Window_Static_Ctor(Ring_Buffer_Window_Static_Handle * me, uint32_t window_length_0);
+
+
+/**
+ * @brief Window Ring Buffer Handle Destructor. Frees the Window Ring Buffer that was allocated to the Handle.
+ *
+ * @param me Window Ring Buffer Handle. Constructor must have been successfully called on this Handle to
+ * use it in this function.
+ *
+ * @return True if successful. False if the supplied Handle is not valid.
+ */
+CLASSES_API bool Ring_Buffer_Window_Static_Destroy(const Ring_Buffer_Window_Static_Handle * me);
+
+
+/**
+ * @brief Removes every sample from the window.
+ *
+ * @param me Window Ring Buffer Handle. Constructor must have been successfully called on this Handle to
+ * use it in this function.
+ *
+ * @return True if successful. False if the supplied Handle is not valid.
+ */
+CLASSES_API bool Ring_Buffer_Window_Static_Clear(const Ring_Buffer_Window_Static_Handle * me);
+
+
+/**
+ * @brief Adds a sample to the window. Once the window holds window_length_0 samples, the oldest one is removed.
+ *
+ * @param me Window Ring Buffer Handle. Constructor must have been successfully called on this Handle to
+ * use it in this function.
+ * @param sample The new sample. Must not be NaN.
+ *
+ * @return True if successful. False if the supplied Handle is not valid.
+ */
+CLASSES_API bool Ring_Buffer_Window_Static_Push(const Ring_Buffer_Window_Static_Handle * me, Ring_Buffer_Window_Static_Sample sample);
+
+
+/**
+ * @brief Returns the statistics of the samples in the window without reading them.
+ *
+ * @param me Window Ring Buffer Handle. Constructor must have been successfully called on this Handle to
+ * use it in this function.
+ * @param stats Set to the statistics of the window.
+ *
+ * @return True if successful. False if the window is empty, an invalid Handle is supplied or @ref stats is NULL.
+ */
+CLASSES_API bool Ring_Buffer_Window_Static_Get_Stats(const Ring_Buffer_Window_Static_Handle * me, Ring_Buffer_Window_Static_Stats * stats);
+
+
+/**
+ * @brief Returns the number of samples in the window: the number pushed since the Constructor or Clear, up to
+ * window_length_0.
+ *
+ * @param me Window Ring Buffer Handle. Constructor must have been successfully called on this Handle to
+ * use it in this function.
+ *
+ * @return 0 if empty or an invalid Handle was supplied. Otherwise the number of samples.
+ */
+CLASSES_API uint32_t Ring_Buffer_Window_Static_Get_Number_Of_Samples(const Ring_Buffer_Window_Static_Handle * me);
+
+
+/**
+ * @brief Recomputes the running sum and sum of squares from the samples in the window, removing the rounding errors
+ * the running sums of floating-point samples accumulated. O(N), with AVX2 or NEON when the Class is compiled for
+ * them.
+ *
+ * @param me Window Ring Buffer Handle. Constructor must have been successfully called on this Handle to
+ * use it in this function.
+ *
+ * @return True if successful. False if the supplied Handle is not valid.
+ */
+CLASSES_API bool Ring_Buffer_Window_Static_Recompute(const Ring_Buffer_Window_Static_Handle * me);
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------ ONLY FOR UNIT TESTS. DO NOT USE IN APPLICATION ---------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+#if defined(APPLICATION_UNIT_TEST_)
+
+    /**
+     * @brief The Unit Test Memory Regions used to verify no out-of-bounds memory access occurs, and their sizes.
+     * Test_RBW_Instances_Memory_Region[] stores every pre-allocated Window Ring Buffer Object in the middle and
+     * Test_RBW_Instances_In_Use_Memory_Region[] whether each one is in use. See class_pool.h.
+     */
+    CLASS_POOL_TEST_DECLARE(RBW);
+
+#endif /* APPLICATION_UNIT_TEST_ */
+
+
+#endif /* RING_BUFFER_WINDOW_STATIC_H_ */
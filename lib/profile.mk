@@ -0,0 +1,67 @@
+# Build Profiles of the Class library. Included by lib/Makefile, tests/Makefile and benches/Makefile so the library
+# and every executable linking it agree on how a profile is compiled and linked. Set PROFILE before including this.
+#
+# release   -O2, link-time optimization and -fvisibility=hidden (see include/classes_api.h). The objects are fat LTO
+#           objects, so the library still links into executables built without -flto, just without cross-module
+#           optimization.
+# debug     -O0 -g. The Classes compiled the way the Unit Tests always built them.
+# pgo-generate
+#           release, instrumented to record branch and call counts into a .gcda file next to each object when an
+#           executable linking the library exits.
+# pgo-use   release, optimized with the counts recorded by pgo-generate. benches/Makefile `make pgo` runs both.
+# asan      -O1 -g with AddressSanitizer and UndefinedBehaviorSanitizer. Any report aborts the process.
+# tsan      -O1 -g with ThreadSanitizer, for the multithreaded Unit Tests and contention Benchmarks.
+#
+# PROFILE_OPT      Default optimization level of the Classes. OPT=... on the command line still overrides it.
+# PROFILE_CFLAGS   Additional flags the Classes are compiled with.
+# PROFILE_LDFLAGS  Flags every executable linking the library is linked with.
+# PROFILE_SANITIZE Sanitizer flags. The executables linking the library compile their own code with these as well, so
+#                  the Unit Tests, Unity and the Benchmark harness are instrumented too.
+# PROFILE_DIR      Name of the directory the profile is built in. Both pgo profiles share one, because the compiler
+#                  looks for the recorded counts under the name of the object file they were recorded for.
+
+PROFILE?=release
+
+RELEASE_CFLAGS:=-flto=auto -ffat-lto-objects -fvisibility=hidden
+RELEASE_LDFLAGS:=-flto=auto -O2
+# Frame pointers give the sanitizer reports complete stack traces.
+ASAN_FLAGS:=-fsanitize=address,undefined -fno-sanitize-recover=all -fno-omit-frame-pointer
+TSAN_FLAGS:=-fsanitize=thread -fno-omit-frame-pointer
+PROFILE_SANITIZE:=
+
+ifeq ($(PROFILE),release)
+PROFILE_OPT:=-O2
+PROFILE_CFLAGS:=$(RELEASE_CFLAGS)
+PROFILE_LDFLAGS:=$(RELEASE_LDFLAGS)
+else ifeq ($(PROFILE),debug)
+PROFILE_OPT:=-O0 -g
+PROFILE_CFLAGS:=
+PROFILE_LDFLAGS:=
+else ifeq ($(PROFILE),pgo-generate)
+PROFILE_OPT:=-O2
+# Atomic counters keep the counts of the threaded Benchmarks exact.
+PROFILE_CFLAGS:=$(RELEASE_CFLAGS) -fprofile-generate -fprofile-update=atomic
+PROFILE_LDFLAGS:=$(RELEASE_LDFLAGS) -fprofile-generate
+else ifeq ($(PROFILE),pgo-use)
+PROFILE_OPT:=-O2
+# -Wmissing-profile (on by default) warns when no training run recorded counts for an object.
+PROFILE_CFLAGS:=$(RELEASE_CFLAGS) -fprofile-use -fprofile-correction
+PROFILE_LDFLAGS:=$(RELEASE_LDFLAGS)
+else ifeq ($(PROFILE),asan)
+PROFILE_OPT:=-O1 -g
+PROFILE_SANITIZE:=$(ASAN_FLAGS)
+PROFILE_CFLAGS:=$(PROFILE_SANITIZE)
+PROFILE_LDFLAGS:=$(PROFILE_SANITIZE)
+else ifeq ($(PROFILE),tsan)
+PROFILE_OPT:=-O1 -g
+PROFILE_SANITIZE:=$(TSAN_FLAGS)
+PROFILE_CFLAGS:=$(PROFILE_SANITIZE)
+PROFILE_LDFLAGS:=$(PROFILE_SANITIZE)
+else
+$(error Unknown PROFILE "$(PROFILE)". Use PROFILE=release, debug, pgo-generate, pgo-use, asan or tsan)
+endif
+
+PROFILE_DIR:=$(patsubst pgo-%,pgo,$(PROFILE))
+
+# Name of the Class library every profile produces.
+CLASSES_LIB_NAME:=libclasses.a
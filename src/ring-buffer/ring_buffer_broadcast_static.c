@@ -0,0 +1,355 @@
+/**
+ * @file ring_buffer_broadcast_static.c
+ * @author agent
+ * @brief Broadcast Ring Buffer with one producer and several Readers, without the use of Dynamic Memory Allocation.
+ * See ring_buffer_broadcast_static.h.
+ *
+ * Positions (the producer's HEAD and every Reader cursor) count elements from 0 up to twice the number of elements
+ * and then wrap to 0. The element at position p is stored in slot p, or p - number_of_elements in the second half.
+ * Counting twice around tells Full (HEAD one lap ahead of a cursor) from Empty (HEAD equal to the cursor) without an
+ * is_empty flag shared by the producer and the Readers, and works for any number of elements. Each position has a
+ * single writer: HEAD is only written by the producer and each cursor only by its Reader. They are published with
+ * the __atomic builtins: a release store after the element is copied, an acquire load before it is used.
+ *
+ * The producer remembers the cursor of the slowest Reader it last saw (the gate). Readers only move forward, so
+ * while HEAD is less than one lap ahead of the gate there is room, and the cursors only have to be scanned again
+ * when the Broadcast Ring Buffer looks Full.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+/* Translation Unit */
+#include "ring_buffer_broadcast_static.h"
+
+/* STD-C Libraries. */
+#include <string.h>     /* size_t, memcpy, memset */
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------- BROADCAST RING BUFFER CLASS DEFINITION ----------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief The position the producer writes next and the cursor of the slowest Reader it last saw. Only touched by
+ * the producer except for head, which the Readers load. On its own cache line.
+ */
+struct Broadcast_Producer_t
+{
+    uint32_t head;                              /* __atomic. Position of the next Write. */
+    uint32_t gate;                              /* Producer only. Cursor of the slowest Reader at the last scan. */
+} __attribute__((aligned(RING_BUFFER_BROADCAST_STATIC_CACHE_LINE)));
+
+
+/**
+ * @brief One Reader. Only its own Reader writes cursor, so Readers never write to a cache line another Reader
+ * reads. The producer loads it to find the slowest Reader.
+ */
+struct Broadcast_Reader_t
+{
+    uint32_t cursor;                                        /* __atomic. Position of this Reader's next Read. */
+    Ring_Buffer_Broadcast_Static_Reader * handle;           /* Reader Handle registered here. NULL if the cursor is free. */
+} __attribute__((aligned(RING_BUFFER_BROADCAST_STATIC_CACHE_LINE)));
+
+
+/**
+ * @brief The Broadcast Ring Buffer Object.
+ */
+struct Ring_Buffer_Broadcast_t
+{
+    struct Broadcast_Producer_t producer;
+    struct Broadcast_Reader_t readers[RING_BUFFER_BROADCAST_STATIC_MAX_READERS];
+    Ring_Buffer_Broadcast_Static_Handle * handle;           /* Handle using the Broadcast Ring Buffer. See struct Ring_Buffer_t. */
+    size_t element_size;                                    /* Number of Bytes */
+    uint32_t number_of_elements;
+    uint8_t buffer[RING_BUFFER_BROADCAST_STATIC_SIZE];
+} __attribute__((aligned(RING_BUFFER_BROADCAST_STATIC_CACHE_LINE)));
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*--------------------------------- AVAILABLE BROADCAST RING BUFFERS FOR USE IN THE APPLICATION -----------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief The pre-allocated Pool of Broadcast Ring Buffers available to the Application and whether each one is in use. The
+ * Handle is the index in this Pool of the reserved Object. See class_pool.h.
+ */
+CLASS_POOL_DEFINE(static, RBB, struct Ring_Buffer_Broadcast_t, NUMBER_OF_STATIC_BROADCAST_RING_BUFFERS);
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ HELPER FUNCTIONS ---------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Returns if the supplied Broadcast Ring Buffer Handle is valid, i.e. the Constructor was successfully called
+ * on it.
+ */
+CLASS_POOL_DEFINE_IS_VALID_HANDLE(RBB, Ring_Buffer_Broadcast_Static_Handle, NUMBER_OF_STATIC_BROADCAST_RING_BUFFERS)
+
+
+/**
+ * @brief Returns if both Handles are valid and the Reader is registered on this Broadcast Ring Buffer.
+ */
+static inline bool RBB_Is_Valid_Reader(const Ring_Buffer_Broadcast_Static_Handle * me, const Ring_Buffer_Broadcast_Static_Reader * reader);
+static inline bool RBB_Is_Valid_Reader(const Ring_Buffer_Broadcast_Static_Handle * me, const Ring_Buffer_Broadcast_Static_Reader * reader)
+{
+    return (RBB_Is_Valid_Handle(me) && (reader) && (*reader < RING_BUFFER_BROADCAST_STATIC_MAX_READERS) &&
+            (RBB_Instances[(*me)].readers[(*reader)].handle == reader));
+}
+
+
+/**
+ * @brief Number of elements from position @p from up to position @p to. Positions wrap at twice the number of elements.
+ */
+static inline uint32_t RBB_Distance(const struct Ring_Buffer_Broadcast_t * rbb, uint32_t from, uint32_t to);
+static inline uint32_t RBB_Distance(const struct Ring_Buffer_Broadcast_t * rbb, uint32_t from, uint32_t to)
+{
+    return (to >= from) ? (to - from) : (to + (2u * rbb->number_of_elements) - from);
+}
+
+
+/**
+ * @brief The position after @p position.
+ */
+static inline uint32_t RBB_Next(const struct Ring_Buffer_Broadcast_t * rbb, uint32_t position);
+static inline uint32_t RBB_Next(const struct Ring_Buffer_Broadcast_t * rbb, uint32_t position)
+{
+    return ((position + 1u) == (2u * rbb->number_of_elements)) ? 0 : (position + 1u);
+}
+
+
+/**
+ * @brief The first byte of the slot storing the element at @p position.
+ */
+static inline uint8_t * RBB_Slot(struct Ring_Buffer_Broadcast_t * rbb, uint32_t position);
+static inline uint8_t * RBB_Slot(struct Ring_Buffer_Broadcast_t * rbb, uint32_t position)
+{
+    const uint32_t slot = (position < rbb->number_of_elements) ? position : (position - rbb->number_of_elements);
+
+    return &rbb->buffer[slot * rbb->element_size];
+}
+
+
+/**
+ * @brief Returns if the producer can write at @p head. Only scans the cursors when the last gate says Full, and then
+ * moves the gate to the slowest Reader. With no Readers the gate is HEAD itself.
+ */
+static bool RBB_Has_Room(struct Ring_Buffer_Broadcast_t * rbb, uint32_t head);
+static bool RBB_Has_Room(struct Ring_Buffer_Broadcast_t * rbb, uint32_t head)
+{
+    bool room = (RBB_Distance(rbb, rbb->producer.gate, head) < rbb->number_of_elements);
+
+    if (!room)
+    {
+        uint32_t gate = head;
+        uint32_t lag = 0;
+
+        for (uint32_t i = 0; i < RING_BUFFER_BROADCAST_STATIC_MAX_READERS; i++)
+        {
+            if (rbb->readers[i].handle)
+            {
+                /* Acquire: the Reader's copy out of the slot is complete before the slot is overwritten. */
+                const uint32_t cursor = __atomic_load_n(&rbb->readers[i].cursor, __ATOMIC_ACQUIRE);
+                const uint32_t distance = RBB_Distance(rbb, cursor, head);
+
+                if (distance >= lag)
+                {
+                    lag = distance;
+                    gate = cursor;
+                }
+            }
+        }
+
+        rbb->producer.gate = gate;
+        room = (lag < rbb->number_of_elements);
+    }
+
+    return room;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ PUBLIC FUNCTIONS ---------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+bool Ring_Buffer_Broadcast_Static_Ctor(Ring_Buffer_Broadcast_Static_Handle * me, size_t element_size_0, uint32_t number_of_elements_0)
+{
+    bool success = false;
+
+    if (RBB_Is_Valid_Handle(me))
+    {
+        /* Constructor already called on Handle. Return false. */
+    }
+    else
+    {
+        if ((me) && (element_size_0) && (number_of_elements_0) && (element_size_0 * number_of_elements_0 <= RING_BUFFER_BROADCAST_STATIC_SIZE))
+        {
+            for (uint32_t i = 0; i < NUMBER_OF_STATIC_BROADCAST_RING_BUFFERS; i++)
+            {
+                if (!RBB_Instances_In_Use[i])
+                {
+                    memset((void *)&RBB_Instances[i], 0, sizeof(RBB_Instances[i]));
+                    *me = i;
+                    RBB_Instances[i].handle = me;
+                    RBB_Instances[i].element_size = element_size_0;
+                    RBB_Instances[i].number_of_elements = number_of_elements_0;
+                    RBB_Instances_In_Use[i] = true;
+                    success = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    return success;
+}
+
+
+bool Ring_Buffer_Broadcast_Static_Destroy(const Ring_Buffer_Broadcast_Static_Handle * me)
+{
+    bool success = false;
+
+    if (RBB_Is_Valid_Handle(me))
+    {
+        /* Also unregisters every Reader and clears the contents. */
+        memset((void *)&RBB_Instances[(*me)], 0, sizeof(RBB_Instances[(*me)]));
+        RBB_Instances_In_Use[(*me)] = false;
+        success = true;
+    }
+
+    return success;
+}
+
+
+bool Ring_Buffer_Broadcast_Static_Add_Reader(const Ring_Buffer_Broadcast_Static_Handle * me, Ring_Buffer_Broadcast_Static_Reader * reader)
+{
+    bool success = false;
+
+    if (RBB_Is_Valid_Reader(me, reader))
+    {
+        /* Reader already registered. Return false. */
+    }
+    else if (RBB_Is_Valid_Handle(me) && (reader))
+    {
+        struct Ring_Buffer_Broadcast_t * const rbb = &RBB_Instances[(*me)];
+
+        for (uint32_t i = 0; i < RING_BUFFER_BROADCAST_STATIC_MAX_READERS; i++)
+        {
+            if (!rbb->readers[i].handle)
+            {
+                /* Starting at HEAD keeps the gate valid: HEAD is never behind the slowest Reader. */
+                *reader = i;
+                rbb->readers[i].handle = reader;
+                rbb->readers[i].cursor = rbb->producer.head;
+                success = true;
+                break;
+            }
+        }
+    }
+
+    return success;
+}
+
+
+bool Ring_Buffer_Broadcast_Static_Remove_Reader(const Ring_Buffer_Broadcast_Static_Handle * me, const Ring_Buffer_Broadcast_Static_Reader * reader)
+{
+    bool success = false;
+
+    if (RBB_Is_Valid_Reader(me, reader))
+    {
+        RBB_Instances[(*me)].readers[(*reader)].handle = (Ring_Buffer_Broadcast_Static_Reader *)0;
+        RBB_Instances[(*me)].readers[(*reader)].cursor = 0;
+        success = true;
+    }
+
+    return success;
+}
+
+
+bool Ring_Buffer_Broadcast_Static_Write(const Ring_Buffer_Broadcast_Static_Handle * me, const void * data, size_t data_size)
+{
+    bool success = false;
+
+    if (RBB_Is_Valid_Handle(me) && (data) && (data_size == RBB_Instances[(*me)].element_size))
+    {
+        struct Ring_Buffer_Broadcast_t * const rbb = &RBB_Instances[(*me)];
+        const uint32_t head = __atomic_load_n(&rbb->producer.head, __ATOMIC_RELAXED);
+
+        if (RBB_Has_Room(rbb, head))
+        {
+            /* Copy data directly from memory so it is passed BY VALUE. Release publishes the copy with HEAD. */
+            memcpy((void *)RBB_Slot(rbb, head), data, data_size);
+            __atomic_store_n(&rbb->producer.head, RBB_Next(rbb, head), __ATOMIC_RELEASE);
+            success = true;
+        }
+    }
+
+    return success;
+}
+
+
+bool Ring_Buffer_Broadcast_Static_Read(const Ring_Buffer_Broadcast_Static_Handle * me, const Ring_Buffer_Broadcast_Static_Reader * reader, void * data, size_t data_size)
+{
+    bool success = false;
+
+    if (RBB_Is_Valid_Reader(me, reader) && (data) && (data_size == RBB_Instances[(*me)].element_size))
+    {
+        struct Ring_Buffer_Broadcast_t * const rbb = &RBB_Instances[(*me)];
+        const uint32_t cursor = __atomic_load_n(&rbb->readers[(*reader)].cursor, __ATOMIC_RELAXED);
+
+        /* Acquire: the producer's copy into the slot is complete before it is read. */
+        if (cursor != __atomic_load_n(&rbb->producer.head, __ATOMIC_ACQUIRE))
+        {
+            /* Release: the copy out of the slot is complete before the producer may reuse it. */
+            memcpy(data, (const void *)RBB_Slot(rbb, cursor), data_size);
+            __atomic_store_n(&rbb->readers[(*reader)].cursor, RBB_Next(rbb, cursor), __ATOMIC_RELEASE);
+            success = true;
+        }
+    }
+
+    return success;
+}
+
+
+uint32_t Ring_Buffer_Broadcast_Static_Get_Number_Of_Elements(const Ring_Buffer_Broadcast_Static_Handle * me, const Ring_Buffer_Broadcast_Static_Reader * reader)
+{
+    uint32_t num_of_elements = 0;
+
+    if (RBB_Is_Valid_Reader(me, reader))
+    {
+        const struct Ring_Buffer_Broadcast_t * const rbb = &RBB_Instances[(*me)];
+
+        num_of_elements = RBB_Distance(rbb, __atomic_load_n(&rbb->readers[(*reader)].cursor, __ATOMIC_RELAXED),
+                                       __atomic_load_n(&rbb->producer.head, __ATOMIC_ACQUIRE));
+    }
+
+    return num_of_elements;
+}
+
+
+bool Ring_Buffer_Broadcast_Static_Is_Empty(const Ring_Buffer_Broadcast_Static_Handle * me, const Ring_Buffer_Broadcast_Static_Reader * reader)
+{
+    return (RBB_Is_Valid_Reader(me, reader) && (Ring_Buffer_Broadcast_Static_Get_Number_Of_Elements(me, reader) == 0));
+}
+
+
+bool Ring_Buffer_Broadcast_Static_Is_Full(const Ring_Buffer_Broadcast_Static_Handle * me)
+{
+    bool full = true;
+
+    if (RBB_Is_Valid_Handle(me))
+    {
+        struct Ring_Buffer_Broadcast_t * const rbb = &RBB_Instances[(*me)];
+
+        full = !RBB_Has_Room(rbb, __atomic_load_n(&rbb->producer.head, __ATOMIC_RELAXED));
+    }
+
+    return full;
+}
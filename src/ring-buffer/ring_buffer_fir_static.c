@@ -0,0 +1,357 @@
+/**
+ * @file ring_buffer_fir_static.c
+ * @author agent
+ * @brief FIR Filter Ring Buffer convolving a mirrored Ring Buffer of samples with its coefficients, without the use of
+ * Dynamic Memory Allocation. See ring_buffer_fir_static.h.
+ *
+ * history[] holds 2 * T samples for T taps. A sample written to slot i is also written to slot i + T, so
+ * history[i] == history[i + T] for every slot. After a sample is written to slot p, the last T samples are
+ * history[p + 1] to history[p + T] oldest first, one contiguous block wherever p is. Compared with a plain Ring
+ * Buffer, that is one extra store per sample instead of splitting the multiply-accumulate in two segments or
+ * linearizing the history first.
+ *
+ * The coefficients are stored reversed, so the oldest sample of the block is multiplied by the last coefficient and
+ * the multiply-accumulate is a dot product of two arrays, which AVX2 and NEON vectorize.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+/* Translation Unit */
+#include "ring_buffer_fir_static.h"
+
+/* STD-C Libraries. */
+#include <string.h>     /* size_t, memset */
+
+/* Vectorized multiply-accumulate. RING_BUFFER_FIR_STATIC_NO_SIMD keeps the scalar loop, i.e. to compare both. */
+#if !defined(RING_BUFFER_FIR_STATIC_NO_SIMD) && defined(__AVX2__)
+    #define RBF_AVX2
+    #include <immintrin.h>
+#elif !defined(RING_BUFFER_FIR_STATIC_NO_SIMD) && defined(__ARM_NEON) && defined(__aarch64__)
+    #define RBF_NEON
+    #include <arm_neon.h>
+#endif
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*----------------------------------------- FIR FILTER RING BUFFER CLASS DEFINITION -----------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief The multiply-accumulate result: 64-bit integers for Q15 and Q31 (see ring_buffer_fir_static.h), float for
+ * float.
+ */
+#if defined(RING_BUFFER_FIR_STATIC_SAMPLE_FLOAT)
+    typedef float RBF_Accumulator;
+#else
+    typedef int64_t RBF_Accumulator;
+#endif
+
+
+/**
+ * @brief The FIR Filter Ring Buffer Object.
+ */
+struct Ring_Buffer_FIR_t
+{
+    Ring_Buffer_FIR_Static_Sample coefficients[RING_BUFFER_FIR_STATIC_MAX_TAPS];   /* Reversed: the last multiplies the newest sample. */
+    Ring_Buffer_FIR_Static_Sample history[2 * RING_BUFFER_FIR_STATIC_MAX_TAPS];    /* Mirrored. See the top of this file. */
+    Ring_Buffer_FIR_Static_Handle * handle;     /* Handle using the FIR Filter Ring Buffer. See struct Ring_Buffer_t. */
+    uint32_t number_of_taps;
+    uint32_t position;                          /* Slot the next sample is written to. */
+};
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------- AVAILABLE FIR FILTER RING BUFFERS FOR USE IN THE APPLICATION ------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief The pre-allocated Pool of FIR Filter Ring Buffers available to the Application and whether each one is in use. The
+ * Handle is the index in this Pool of the reserved Object. See class_pool.h.
+ */
+CLASS_POOL_DEFINE(static, RBF, struct Ring_Buffer_FIR_t, NUMBER_OF_STATIC_FIR_RING_BUFFERS);
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ HELPER FUNCTIONS ---------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Returns if the supplied FIR Filter Ring Buffer Handle is valid, i.e. the Constructor was successfully called
+ * on it.
+ */
+CLASS_POOL_DEFINE_IS_VALID_HANDLE(RBF, Ring_Buffer_FIR_Static_Handle, NUMBER_OF_STATIC_FIR_RING_BUFFERS)
+
+
+/**
+ * @brief Dot product of @p taps samples and coefficients, with AVX2 or NEON when available. The remaining taps that
+ * do not fill a vector are done by the scalar loop.
+ */
+static RBF_Accumulator RBF_Dot(const Ring_Buffer_FIR_Static_Sample * samples, const Ring_Buffer_FIR_Static_Sample * coefficients, uint32_t taps);
+static RBF_Accumulator RBF_Dot(const Ring_Buffer_FIR_Static_Sample * samples, const Ring_Buffer_FIR_Static_Sample * coefficients, uint32_t taps)
+{
+    RBF_Accumulator acc = 0;
+    uint32_t i = 0;
+
+#if defined(RBF_AVX2) && defined(RING_BUFFER_FIR_STATIC_SAMPLE_Q31)
+    __m256i acc_4 = _mm256_setzero_si256();
+    int64_t lanes[4];
+
+    for (; (i + 8u) <= taps; i += 8u)
+    {
+        const __m256i x = _mm256_loadu_si256((const __m256i *)&samples[i]);
+        const __m256i h = _mm256_loadu_si256((const __m256i *)&coefficients[i]);
+        /* _mm256_mul_epi32 multiplies the even int32_t of every 64-bit lane. Shift the odd ones down for the rest. */
+        const __m256i even = _mm256_mul_epi32(x, h);
+        const __m256i odd = _mm256_mul_epi32(_mm256_srli_epi64(x, 32), _mm256_srli_epi64(h, 32));
+
+        acc_4 = _mm256_add_epi64(acc_4, _mm256_add_epi64(even, odd));
+    }
+
+    _mm256_storeu_si256((__m256i *)lanes, acc_4);
+    acc = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+
+#elif defined(RBF_AVX2) && defined(RING_BUFFER_FIR_STATIC_SAMPLE_FLOAT)
+    __m256 acc_8 = _mm256_setzero_ps();
+    float lanes[8];
+
+    for (; (i + 8u) <= taps; i += 8u)
+    {
+        const __m256 x = _mm256_loadu_ps(&samples[i]);
+        const __m256 h = _mm256_loadu_ps(&coefficients[i]);
+
+    #if defined(__FMA__)
+        acc_8 = _mm256_fmadd_ps(x, h, acc_8);
+    #else
+        acc_8 = _mm256_add_ps(acc_8, _mm256_mul_ps(x, h));
+    #endif
+    }
+
+    _mm256_storeu_ps(lanes, acc_8);
+    acc = ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3])) + ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+
+#elif defined(RBF_AVX2)
+    const __m256i overflow = _mm256_set1_epi32(INT32_MIN);
+    const __m256i carry = _mm256_set1_epi64x(INT64_C(1) << 32);
+    __m256i acc_4 = _mm256_setzero_si256();
+    int64_t lanes[4];
+
+    for (; (i + 16u) <= taps; i += 16u)
+    {
+        const __m256i x = _mm256_loadu_si256((const __m256i *)&samples[i]);
+        const __m256i h = _mm256_loadu_si256((const __m256i *)&coefficients[i]);
+        const __m256i pairs = _mm256_madd_epi16(x, h);
+        /**
+         * A pair of -32768 * -32768 sums to 2^31 and wraps to INT32_MIN, which no other pair reaches (the lowest is
+         * 2 * -32768 * 32767). Add the 2^32 it lost back after widening.
+         */
+        const __m256i wrapped = _mm256_cmpeq_epi32(pairs, overflow);
+        const __m256i lo = _mm256_add_epi64(_mm256_cvtepi32_epi64(_mm256_castsi256_si128(pairs)),
+                                            _mm256_and_si256(_mm256_cvtepi32_epi64(_mm256_castsi256_si128(wrapped)), carry));
+        const __m256i hi = _mm256_add_epi64(_mm256_cvtepi32_epi64(_mm256_extracti128_si256(pairs, 1)),
+                                            _mm256_and_si256(_mm256_cvtepi32_epi64(_mm256_extracti128_si256(wrapped, 1)), carry));
+
+        acc_4 = _mm256_add_epi64(acc_4, _mm256_add_epi64(lo, hi));
+    }
+
+    _mm256_storeu_si256((__m256i *)lanes, acc_4);
+    acc = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+
+#elif defined(RBF_NEON) && defined(RING_BUFFER_FIR_STATIC_SAMPLE_Q31)
+    int64x2_t acc_2 = vdupq_n_s64(0);
+
+    for (; (i + 4u) <= taps; i += 4u)
+    {
+        const int32x4_t x = vld1q_s32(&samples[i]);
+        const int32x4_t h = vld1q_s32(&coefficients[i]);
+
+        acc_2 = vmlal_s32(acc_2, vget_low_s32(x), vget_low_s32(h));
+        acc_2 = vmlal_high_s32(acc_2, x, h);
+    }
+
+    acc = vaddvq_s64(acc_2);
+
+#elif defined(RBF_NEON) && defined(RING_BUFFER_FIR_STATIC_SAMPLE_FLOAT)
+    float32x4_t acc_4 = vdupq_n_f32(0.0f);
+
+    for (; (i + 4u) <= taps; i += 4u)
+    {
+        acc_4 = vfmaq_f32(acc_4, vld1q_f32(&samples[i]), vld1q_f32(&coefficients[i]));
+    }
+
+    acc = vaddvq_f32(acc_4);
+
+#elif defined(RBF_NEON)
+    int64x2_t acc_2 = vdupq_n_s64(0);
+
+    for (; (i + 8u) <= taps; i += 8u)
+    {
+        const int16x8_t x = vld1q_s16(&samples[i]);
+        const int16x8_t h = vld1q_s16(&coefficients[i]);
+
+        acc_2 = vpadalq_s32(acc_2, vmull_s16(vget_low_s16(x), vget_low_s16(h)));
+        acc_2 = vpadalq_s32(acc_2, vmull_high_s16(x, h));
+    }
+
+    acc = vaddvq_s64(acc_2);
+#endif
+
+    for (; i < taps; i++)
+    {
+        acc += (RBF_Accumulator)samples[i] * (RBF_Accumulator)coefficients[i];
+    }
+
+    return acc;
+}
+
+
+/**
+ * @brief Converts the multiply-accumulate result to a sample: shifted back to Q15 or Q31 and saturated.
+ */
+static inline Ring_Buffer_FIR_Static_Sample RBF_To_Sample(RBF_Accumulator acc);
+static inline Ring_Buffer_FIR_Static_Sample RBF_To_Sample(RBF_Accumulator acc)
+{
+#if defined(RING_BUFFER_FIR_STATIC_SAMPLE_FLOAT)
+    return acc;
+#else
+    #if defined(RING_BUFFER_FIR_STATIC_SAMPLE_Q31)
+        const int64_t shifted = acc >> 31;
+        const int64_t lowest = INT32_MIN;
+        const int64_t highest = INT32_MAX;
+    #else
+        const int64_t shifted = acc >> 15;
+        const int64_t lowest = INT16_MIN;
+        const int64_t highest = INT16_MAX;
+    #endif
+
+    return (Ring_Buffer_FIR_Static_Sample)((shifted < lowest) ? lowest : ((shifted > highest) ? highest : shifted));
+#endif
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ PUBLIC FUNCTIONS ---------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+bool Ring_Buffer_FIR_Static_Ctor(Ring_Buffer_FIR_Static_Handle * me, const Ring_Buffer_FIR_Static_Sample * coefficients_0, uint32_t number_of_taps_0)
+{
+    bool success = false;
+
+    if (RBF_Is_Valid_Handle(me))
+    {
+        /* Constructor already called on Handle. Return false. */
+    }
+    else
+    {
+        if ((me) && (coefficients_0) && (number_of_taps_0) && (number_of_taps_0 <= RING_BUFFER_FIR_STATIC_MAX_TAPS))
+        {
+            for (uint32_t i = 0; i < NUMBER_OF_STATIC_FIR_RING_BUFFERS; i++)
+            {
+                if (!RBF_Instances_In_Use[i])
+                {
+                    memset((void *)&RBF_Instances[i], 0, sizeof(RBF_Instances[i]));
+                    *me = i;
+                    RBF_Instances[i].handle = me;
+                    RBF_Instances[i].number_of_taps = number_of_taps_0;
+
+                    for (uint32_t t = 0; t < number_of_taps_0; t++)
+                    {
+                        RBF_Instances[i].coefficients[t] = coefficients_0[number_of_taps_0 - 1u - t];
+                    }
+
+                    RBF_Instances_In_Use[i] = true;
+                    success = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    return success;
+}
+
+
+bool Ring_Buffer_FIR_Static_Destroy(const Ring_Buffer_FIR_Static_Handle * me)
+{
+    bool success = false;
+
+    if (RBF_Is_Valid_Handle(me))
+    {
+        memset((void *)&RBF_Instances[(*me)], 0, sizeof(RBF_Instances[(*me)]));
+        RBF_Instances_In_Use[(*me)] = false;
+        success = true;
+    }
+
+    return success;
+}
+
+
+bool Ring_Buffer_FIR_Static_Clear(const Ring_Buffer_FIR_Static_Handle * me)
+{
+    bool success = false;
+
+    if (RBF_Is_Valid_Handle(me))
+    {
+        struct Ring_Buffer_FIR_t * const rbf = &RBF_Instances[(*me)];
+
+        memset((void *)rbf->history, 0, sizeof(rbf->history));
+        rbf->position = 0;
+        success = true;
+    }
+
+    return success;
+}
+
+
+bool Ring_Buffer_FIR_Static_Process(const Ring_Buffer_FIR_Static_Handle * me, const Ring_Buffer_FIR_Static_Sample * input, Ring_Buffer_FIR_Static_Sample * output, uint32_t count)
+{
+    bool success = false;
+
+    if (RBF_Is_Valid_Handle(me) && (input) && (output))
+    {
+        struct Ring_Buffer_FIR_t * const rbf = &RBF_Instances[(*me)];
+        const uint32_t taps = rbf->number_of_taps;
+        uint32_t position = rbf->position;
+
+        for (uint32_t n = 0; n < count; )
+        {
+            /**
+             * Samples are handled in runs up to the end of the history. The whole run is written to the upper copy
+             * before it is filtered, so a multiply-accumulate does not load the sample stored just before it (a store
+             * forwarding stall on every sample). The lower copy is written afterwards: until then it still holds the
+             * older samples the run's windows start with. The run is read before output[] is written, so output may be
+             * input.
+             */
+            const uint32_t run = ((count - n) < (taps - position)) ? (count - n) : (taps - position);
+
+            for (uint32_t i = 0; i < run; i++)
+            {
+                rbf->history[position + taps + i] = input[n + i];
+            }
+
+            for (uint32_t i = 0; i < run; i++)
+            {
+                output[n + i] = RBF_To_Sample(RBF_Dot(&rbf->history[position + i + 1u], rbf->coefficients, taps));
+            }
+
+            for (uint32_t i = 0; i < run; i++)
+            {
+                rbf->history[position + i] = rbf->history[position + taps + i];
+            }
+
+            n += run;
+            position = ((position + run) == taps) ? 0 : (position + run);
+        }
+
+        rbf->position = position;
+        success = true;
+    }
+
+    return success;
+}
@@ -0,0 +1,357 @@
+/**
+ * @file ring_buffer_pipeline_static.c
+ * @author agent
+ * @brief Pipeline Ring Buffer whose Stages work in place on the slots of one Ring Buffer, without the use of Dynamic
+ * Memory Allocation. See ring_buffer_pipeline_static.h.
+ *
+ * Positions count elements from 0 up to twice the number of elements and then wrap to 0, like the Broadcast Ring
+ * Buffer (ring_buffer_broadcast_static.c). The producer's sequence is HEAD, and the sequence of every Stage is the
+ * position of the next element it acquires. Sequences never overtake the one they wait on, so in order they are:
+ * HEAD, Stage 0, Stage 1, ... last Stage, and HEAD is at most one lap ahead of the last Stage. Each sequence has a
+ * single writer and is published with a release store after the slot was written, and loaded with an acquire load
+ * before the slot is used.
+ *
+ * Every waiter caches the last value it loaded of the sequence it waits on (the producer's gate, each Stage's
+ * available). Sequences only move forward, so the cached value stays a safe bound and the shared sequence only has
+ * to be loaded again when the cached one says Full or Empty. Batches of elements then pass with one load.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+/* Translation Unit */
+#include "ring_buffer_pipeline_static.h"
+
+/* STD-C Libraries. */
+#include <string.h>     /* size_t, memcpy, memset */
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------- PIPELINE RING BUFFER CLASS DEFINITION -----------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief The producer's sequence and what only the producer uses. On its own cache line.
+ */
+struct Pipeline_Producer_t
+{
+    uint32_t head;                              /* __atomic. Position of the next element published. */
+    uint32_t gate;                              /* Producer only. Last Stage's sequence at the last load. */
+    bool claimed;                               /* Producer only. The slot at head is claimed. */
+} __attribute__((aligned(RING_BUFFER_PIPELINE_STATIC_CACHE_LINE)));
+
+
+/**
+ * @brief One Stage's sequence and what only that Stage uses. On its own cache line.
+ */
+struct Pipeline_Stage_t
+{
+    uint32_t sequence;                          /* __atomic. Position of the next element this Stage acquires. */
+    uint32_t available;                         /* This Stage only. Previous Stage's sequence at the last load. */
+    bool acquired;                              /* This Stage only. The slot at sequence is acquired. */
+} __attribute__((aligned(RING_BUFFER_PIPELINE_STATIC_CACHE_LINE)));
+
+
+/**
+ * @brief The Pipeline Ring Buffer Object. The buffer comes first so slot 0 is cache line aligned.
+ */
+struct Ring_Buffer_Pipeline_t
+{
+    uint8_t buffer[RING_BUFFER_PIPELINE_STATIC_SIZE];
+    struct Pipeline_Producer_t producer;
+    struct Pipeline_Stage_t stages[RING_BUFFER_PIPELINE_STATIC_MAX_STAGES];
+    Ring_Buffer_Pipeline_Static_Handle * handle;            /* Handle using the Pipeline Ring Buffer. See struct Ring_Buffer_t. */
+    size_t element_size;                                    /* Number of Bytes */
+    uint32_t number_of_elements;
+    uint32_t number_of_stages;
+} __attribute__((aligned(RING_BUFFER_PIPELINE_STATIC_CACHE_LINE)));
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*--------------------------------- AVAILABLE PIPELINE RING BUFFERS FOR USE IN THE APPLICATION ------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief The pre-allocated Pool of Pipeline Ring Buffers available to the Application and whether each one is in use. The
+ * Handle is the index in this Pool of the reserved Object. See class_pool.h.
+ */
+CLASS_POOL_DEFINE(static, RBP, struct Ring_Buffer_Pipeline_t, NUMBER_OF_STATIC_PIPELINE_RING_BUFFERS);
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ HELPER FUNCTIONS ---------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Returns if the supplied Pipeline Ring Buffer Handle is valid, i.e. the Constructor was successfully called
+ * on it.
+ */
+CLASS_POOL_DEFINE_IS_VALID_HANDLE(RBP, Ring_Buffer_Pipeline_Static_Handle, NUMBER_OF_STATIC_PIPELINE_RING_BUFFERS)
+
+
+/**
+ * @brief Returns if the Handle is valid and @p stage is one of its Stages.
+ */
+static inline bool RBP_Is_Valid_Stage(const Ring_Buffer_Pipeline_Static_Handle * me, uint32_t stage);
+static inline bool RBP_Is_Valid_Stage(const Ring_Buffer_Pipeline_Static_Handle * me, uint32_t stage)
+{
+    return (RBP_Is_Valid_Handle(me) && (stage < RBP_Instances[(*me)].number_of_stages));
+}
+
+
+/**
+ * @brief Number of elements from position @p from up to position @p to. Positions wrap at twice the number of elements.
+ */
+static inline uint32_t RBP_Distance(const struct Ring_Buffer_Pipeline_t * rbp, uint32_t from, uint32_t to);
+static inline uint32_t RBP_Distance(const struct Ring_Buffer_Pipeline_t * rbp, uint32_t from, uint32_t to)
+{
+    return (to >= from) ? (to - from) : (to + (2u * rbp->number_of_elements) - from);
+}
+
+
+/**
+ * @brief The position after @p position.
+ */
+static inline uint32_t RBP_Next(const struct Ring_Buffer_Pipeline_t * rbp, uint32_t position);
+static inline uint32_t RBP_Next(const struct Ring_Buffer_Pipeline_t * rbp, uint32_t position)
+{
+    return ((position + 1u) == (2u * rbp->number_of_elements)) ? 0 : (position + 1u);
+}
+
+
+/**
+ * @brief The first byte of the slot storing the element at @p position.
+ */
+static inline uint8_t * RBP_Slot(struct Ring_Buffer_Pipeline_t * rbp, uint32_t position);
+static inline uint8_t * RBP_Slot(struct Ring_Buffer_Pipeline_t * rbp, uint32_t position)
+{
+    const uint32_t slot = (position < rbp->number_of_elements) ? position : (position - rbp->number_of_elements);
+
+    return &rbp->buffer[slot * rbp->element_size];
+}
+
+
+/**
+ * @brief The sequence @p stage waits on: the previous Stage's, or HEAD for Stage 0.
+ */
+static inline uint32_t * RBP_Barrier(struct Ring_Buffer_Pipeline_t * rbp, uint32_t stage);
+static inline uint32_t * RBP_Barrier(struct Ring_Buffer_Pipeline_t * rbp, uint32_t stage)
+{
+    return (stage) ? &rbp->stages[stage - 1u].sequence : &rbp->producer.head;
+}
+
+
+/**
+ * @brief Returns if the producer can claim the slot at HEAD. Only loads the last Stage's sequence when the gate says
+ * Full.
+ */
+static bool RBP_Has_Room(struct Ring_Buffer_Pipeline_t * rbp, uint32_t head);
+static bool RBP_Has_Room(struct Ring_Buffer_Pipeline_t * rbp, uint32_t head)
+{
+    bool room = (RBP_Distance(rbp, rbp->producer.gate, head) < rbp->number_of_elements);
+
+    if (!room)
+    {
+        /* Acquire: the last Stage is done with the slot before it is overwritten. */
+        rbp->producer.gate = __atomic_load_n(&rbp->stages[rbp->number_of_stages - 1u].sequence, __ATOMIC_ACQUIRE);
+        room = (RBP_Distance(rbp, rbp->producer.gate, head) < rbp->number_of_elements);
+    }
+
+    return room;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ PUBLIC FUNCTIONS ---------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+bool Ring_Buffer_Pipeline_Static_Ctor(Ring_Buffer_Pipeline_Static_Handle * me, size_t element_size_0, uint32_t number_of_elements_0, uint32_t number_of_stages_0)
+{
+    bool success = false;
+
+    if (RBP_Is_Valid_Handle(me))
+    {
+        /* Constructor already called on Handle. Return false. */
+    }
+    else
+    {
+        if ((me) && (element_size_0) && (number_of_elements_0) && (element_size_0 * number_of_elements_0 <= RING_BUFFER_PIPELINE_STATIC_SIZE) &&
+            (number_of_stages_0) && (number_of_stages_0 <= RING_BUFFER_PIPELINE_STATIC_MAX_STAGES))
+        {
+            for (uint32_t i = 0; i < NUMBER_OF_STATIC_PIPELINE_RING_BUFFERS; i++)
+            {
+                if (!RBP_Instances_In_Use[i])
+                {
+                    memset((void *)&RBP_Instances[i], 0, sizeof(RBP_Instances[i]));
+                    *me = i;
+                    RBP_Instances[i].handle = me;
+                    RBP_Instances[i].element_size = element_size_0;
+                    RBP_Instances[i].number_of_elements = number_of_elements_0;
+                    RBP_Instances[i].number_of_stages = number_of_stages_0;
+                    RBP_Instances_In_Use[i] = true;
+                    success = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    return success;
+}
+
+
+bool Ring_Buffer_Pipeline_Static_Destroy(const Ring_Buffer_Pipeline_Static_Handle * me)
+{
+    bool success = false;
+
+    if (RBP_Is_Valid_Handle(me))
+    {
+        memset((void *)&RBP_Instances[(*me)], 0, sizeof(RBP_Instances[(*me)]));
+        RBP_Instances_In_Use[(*me)] = false;
+        success = true;
+    }
+
+    return success;
+}
+
+
+bool Ring_Buffer_Pipeline_Static_Claim(const Ring_Buffer_Pipeline_Static_Handle * me, void ** slot)
+{
+    bool success = false;
+
+    if (RBP_Is_Valid_Handle(me) && (slot))
+    {
+        struct Ring_Buffer_Pipeline_t * const rbp = &RBP_Instances[(*me)];
+        const uint32_t head = __atomic_load_n(&rbp->producer.head, __ATOMIC_RELAXED);
+
+        if ((rbp->producer.claimed) || (RBP_Has_Room(rbp, head)))
+        {
+            *slot = (void *)RBP_Slot(rbp, head);
+            rbp->producer.claimed = true;
+            success = true;
+        }
+    }
+
+    return success;
+}
+
+
+bool Ring_Buffer_Pipeline_Static_Publish(const Ring_Buffer_Pipeline_Static_Handle * me)
+{
+    bool success = false;
+
+    if (RBP_Is_Valid_Handle(me) && (RBP_Instances[(*me)].producer.claimed))
+    {
+        struct Ring_Buffer_Pipeline_t * const rbp = &RBP_Instances[(*me)];
+
+        /* Release: the producer's writes to the slot are visible to Stage 0 before the new HEAD. */
+        __atomic_store_n(&rbp->producer.head, RBP_Next(rbp, __atomic_load_n(&rbp->producer.head, __ATOMIC_RELAXED)), __ATOMIC_RELEASE);
+        rbp->producer.claimed = false;
+        success = true;
+    }
+
+    return success;
+}
+
+
+bool Ring_Buffer_Pipeline_Static_Write(const Ring_Buffer_Pipeline_Static_Handle * me, const void * data, size_t data_size)
+{
+    bool success = false;
+    void * slot = NULL;
+
+    /* A claimed slot may already hold part of an element. Refuse instead of overwriting it. */
+    if (RBP_Is_Valid_Handle(me) && (!RBP_Instances[(*me)].producer.claimed) && (data) && (data_size == RBP_Instances[(*me)].element_size) &&
+        Ring_Buffer_Pipeline_Static_Claim(me, &slot))
+    {
+        /* Copy data directly from memory so it is passed BY VALUE. */
+        memcpy(slot, data, data_size);
+        success = Ring_Buffer_Pipeline_Static_Publish(me);
+    }
+
+    return success;
+}
+
+
+bool Ring_Buffer_Pipeline_Static_Acquire(const Ring_Buffer_Pipeline_Static_Handle * me, uint32_t stage, void ** slot)
+{
+    bool success = false;
+
+    if (RBP_Is_Valid_Stage(me, stage) && (slot))
+    {
+        struct Ring_Buffer_Pipeline_t * const rbp = &RBP_Instances[(*me)];
+        struct Pipeline_Stage_t * const self = &rbp->stages[stage];
+        const uint32_t sequence = __atomic_load_n(&self->sequence, __ATOMIC_RELAXED);
+
+        if ((!self->acquired) && (sequence == self->available))
+        {
+            /* Acquire: the previous Stage's work on the slot is visible before it is used here. */
+            self->available = __atomic_load_n(RBP_Barrier(rbp, stage), __ATOMIC_ACQUIRE);
+        }
+
+        if ((self->acquired) || (sequence != self->available))
+        {
+            *slot = (void *)RBP_Slot(rbp, sequence);
+            self->acquired = true;
+            success = true;
+        }
+    }
+
+    return success;
+}
+
+
+bool Ring_Buffer_Pipeline_Static_Release(const Ring_Buffer_Pipeline_Static_Handle * me, uint32_t stage)
+{
+    bool success = false;
+
+    if (RBP_Is_Valid_Stage(me, stage) && (RBP_Instances[(*me)].stages[stage].acquired))
+    {
+        struct Ring_Buffer_Pipeline_t * const rbp = &RBP_Instances[(*me)];
+        struct Pipeline_Stage_t * const self = &rbp->stages[stage];
+
+        /* Release: this Stage's work on the slot is visible to the next Stage (or the producer) first. */
+        __atomic_store_n(&self->sequence, RBP_Next(rbp, __atomic_load_n(&self->sequence, __ATOMIC_RELAXED)), __ATOMIC_RELEASE);
+        self->acquired = false;
+        success = true;
+    }
+
+    return success;
+}
+
+
+uint32_t Ring_Buffer_Pipeline_Static_Get_Number_Of_Elements(const Ring_Buffer_Pipeline_Static_Handle * me, uint32_t stage)
+{
+    uint32_t num_of_elements = 0;
+
+    if (RBP_Is_Valid_Stage(me, stage))
+    {
+        struct Ring_Buffer_Pipeline_t * const rbp = &RBP_Instances[(*me)];
+        struct Pipeline_Stage_t * const self = &rbp->stages[stage];
+
+        self->available = __atomic_load_n(RBP_Barrier(rbp, stage), __ATOMIC_ACQUIRE);
+        num_of_elements = RBP_Distance(rbp, __atomic_load_n(&self->sequence, __ATOMIC_RELAXED), self->available);
+    }
+
+    return num_of_elements;
+}
+
+
+bool Ring_Buffer_Pipeline_Static_Is_Full(const Ring_Buffer_Pipeline_Static_Handle * me)
+{
+    bool full = true;
+
+    if (RBP_Is_Valid_Handle(me))
+    {
+        struct Ring_Buffer_Pipeline_t * const rbp = &RBP_Instances[(*me)];
+
+        full = !RBP_Has_Room(rbp, __atomic_load_n(&rbp->producer.head, __ATOMIC_RELAXED));
+    }
+
+    return full;
+}
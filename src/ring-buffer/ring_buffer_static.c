@@ -10,6 +10,8 @@
  * use the Ring Buffer reserved for this Handle until it is destroyed via a Destructor call.
  * 
  * To pass data by value functions take in a void pointer and copy memory contents directly to and from the buffer.
+ * The Ring Buffer type and the hot-path methods (Write, Read, Get_Number_Of_Elements, Is_Empty and Is_Full) are in
+ * ring_buffer_static_inline.h so they can optionally be inlined into the Caller. See RING_BUFFER_STATIC_INLINE.
  * @version 0.1
  * @date 2023-08-18
  * 
@@ -18,33 +20,29 @@
  */
 
 
-/* Translation Unit */
-#include "ring_buffer_static.h"
+/* Decides RING_BUFFER_STATIC_FD_IO without including any system header. */
+#include "ring_buffer_static_config.h"
 
-/* STD-C Libraries. */
-#include <string.h>     /* size_t, memcpy */
+/* readv and writev are POSIX. Only requested when the File Descriptor methods are compiled. Must come before any
+ * system header. */
+#if defined(RING_BUFFER_STATIC_FD_IO)
+    #if !defined(_POSIX_C_SOURCE)
+        #define _POSIX_C_SOURCE 200809L
+    #endif
+#endif
 
+/* Translation Unit */
+#include "ring_buffer_static.h"
 
+/* Ring Buffer type, Pool declarations and the hot-path methods. Out-of-line unless RING_BUFFER_STATIC_INLINE. */
+#include "ring_buffer_static_inline.h"
 
-/*---------------------------------------------------------------------------------------------------------------------------*/
-/*------------------------------ RING BUFFER CLASS DEFINITION. NOTE HOW THIS IS COMPLETELY PRIVATE --------------------------*/
-/*---------------------------- AND ENCAPSULATED FROM THE APPLICATION. ALL USERS GET IS A CLASS HANDLE. ----------------------*/
-/*---------------------------------------------------------------------------------------------------------------------------*/
+/* STD-C Libraries. */
+#include <string.h>     /* size_t, memset */
 
-/**
- * @brief The Ring Buffer Object. Note how this is defined in the Source File so it is completely
- * encapsulated and private from the external Application.
- */
-struct Ring_Buffer_t
-{
-    Ring_Buffer_Static_Handle * handle;         /* Handle using the Ring Buffer. Address comparison ensures multiple Handles can't use the same Ring Buffer. */
-    uint8_t buffer[RING_BUFFER_STATIC_SIZE];
-    volatile size_t head;
-    volatile size_t tail;
-    size_t element_size;                        /* Number of Bytes */
-    size_t capacity;                            /* Number of Bytes */
-    bool is_empty;
-};
+#if defined(RING_BUFFER_STATIC_FD_IO)
+    #include <sys/uio.h>        /* readv, writev, struct iovec */
+#endif
 
 
 
@@ -53,92 +51,25 @@ struct Ring_Buffer_t
 /*---------------------------- IS DEFINED AT COMPILE-TIME SO WE CAN AVOID DYNAMIC MEMORY ALLOCATION. ------------------------*/
 /*---------------------------------------------------------------------------------------------------------------------------*/
 
-#if defined(APPLICATION_UNIT_TEST_)
-    /**
-     * These Unit Test Memory Regions need the Ring_Buffer_t type in order to be defined.
-     * It is done this way instead of exposing the Ring_Buffer_t type in the Header File
-     * in order to keep the Source Code consistent and the type encapsulated. 
-     */
-
-    uint8_t Test_RB_Instances_Memory_Region[(RB_INSTANCES_MEMORY_EXTENSION_BYTES) + \
-                                            (NUMBER_OF_STATIC_RING_BUFFERS * sizeof(struct Ring_Buffer_t)) + \
-                                            (RB_INSTANCES_MEMORY_EXTENSION_BYTES)];
-
-    uint8_t Test_RB_Instances_In_Use_Memory_Region[(RB_INSTANCES_IN_USE_MEMORY_EXTENSION_BYTES) + \
-                                                    (NUMBER_OF_STATIC_RING_BUFFERS * sizeof(bool)) + \
-                                                    (RB_INSTANCES_IN_USE_MEMORY_EXTENSION_BYTES)];
-
-    const size_t Test_RB_Instances_Mem_Size         = sizeof(Test_RB_Instances_Memory_Region);
-    const size_t Test_RB_Instances_In_Use_Mem_Size  = sizeof(Test_RB_Instances_In_Use_Memory_Region);
-
-
-    /**
-     * @brief Used by Unit Tests to verify no out-of-bounds memory access occurs. This is the
-     * same pre-allocated Pool of Ring Buffers available to the Application and behaves exactly
-     * the same as the normal version. The only difference is that this is stored in the middle
-     * of Test_RB_Instances_Memory_Region[]. I.e.
-     * 
-     * Unit Test: Test_RB_Instances_Memory_Region[] = [Known Pad Bytes, RB_Instances[], Known Pad Bytes]
-     * Normal Application: RB_Instances[]
-     */
-    static struct Ring_Buffer_t * const RB_Instances = (struct Ring_Buffer_t *)&Test_RB_Instances_Memory_Region[RB_INSTANCES_MEMORY_EXTENSION_BYTES];
-
-
-    /**
-     * @brief Used by Unit Tests to verify no out-of-bounds memory access occurs. This is the
-     * same array that stores whether each Ring Buffer is in use and behaves exactly the same as
-     * the normal version. The only difference is that this is stored in the middle
-     * of Test_RB_Instances_In_Use_Memory_Region[]. I.e.
-     * 
-     * Unit Test: Test_RB_Instances_In_Use_Memory_Region[] = [Known Pad Bytes, RB_Instances_In_Use[], Known Pad Bytes]
-     * Normal Application: RB_Instances_In_Use[]
-     */
-    static bool * const RB_Instances_In_Use = (bool *)&Test_RB_Instances_In_Use_Memory_Region[RB_INSTANCES_IN_USE_MEMORY_EXTENSION_BYTES];
-
-#else /* Normal Application */
-
-    /**
-     * @brief The pre-allocated Pool of Ring Buffers available to the Application. Each array index corresponds 
-     * to a unique Ring Buffer. Notice that memory is allocated for this at compile-time to avoid Dynamic Memory 
-     * Allocation. When the Constructor is called this Pool is scanned. If there is an available Ring Buffer it 
-     * will be reserved for the Caller and will be represented by a generic Ring Buffer Handle, which is the index
-     * in this array containing the reserved Ring Buffer.
-     */
-    static struct Ring_Buffer_t RB_Instances[NUMBER_OF_STATIC_RING_BUFFERS];
-
-
-    /**
-     * @brief Stores whether each Ring Buffer is available or free for use. A true element means that the Ring
-     * Buffer is in use. A false element means that Ring Buffer is free.
-     */
-    static bool RB_Instances_In_Use[NUMBER_OF_STATIC_RING_BUFFERS];
-
+/**
+ * @brief Linkage of the Pool definitions. Matches the RB_POOL_LINKAGE declarations in ring_buffer_static_inline.h.
+ */
+#if defined(RING_BUFFER_STATIC_INLINE)
+    #define RB_POOL_DEFINITION
+#else
+    #define RB_POOL_DEFINITION                                              static
 #endif
 
 
-
-/*---------------------------------------------------------------------------------------------------------------------------*/
-/*------------------------------------------------------ HELPER FUNCTIONS ---------------------------------------------------*/
-/*---------------------------------------------------------------------------------------------------------------------------*/
-
 /**
- * @brief Returns if the supplied Ring Buffer Handle (object) is valid. Valid means that the 
- * Ring Buffer Handle was initialized successfully using the Constructor. 
- * 
- * @param me Ring Buffer Handle to check.
- * 
- * @return True if the Handle is valid. False if the Handle is invalid. No Ring Buffer methods should
- * execute for an invalid Handle.
+ * @brief The pre-allocated Pool of Ring Buffers available to the Application. Each array index corresponds 
+ * to a unique Ring Buffer. Notice that memory is allocated for this at compile-time to avoid Dynamic Memory 
+ * Allocation. When the Constructor is called this Pool is scanned. If there is an available Ring Buffer it 
+ * will be reserved for the Caller and will be represented by a generic Ring Buffer Handle, which is the index
+ * in this array containing the reserved Ring Buffer. RB_Instances_In_Use[] stores whether each one is in use.
+ * Unit Tests store both in the middle of the Unit Test Memory Regions. See class_pool.h.
  */
-static inline bool Is_Valid_Handle(const Ring_Buffer_Static_Handle * me);
-static inline bool Is_Valid_Handle(const Ring_Buffer_Static_Handle * me)
-{
-    /**
-     * Note that the evaluation order DOES matter to avoid dereferencing NULL pointer
-     * or accessing out-of-bounds memory.
-     */
-    return ((me) && (*me < NUMBER_OF_STATIC_RING_BUFFERS) && (RB_Instances_In_Use[(*me)]) && (RB_Instances[(*me)].handle == me));
-}
+CLASS_POOL_DEFINE(RB_POOL_DEFINITION, RB, struct Ring_Buffer_t, NUMBER_OF_STATIC_RING_BUFFERS);
 
 
 
@@ -150,7 +81,7 @@ bool Ring_Buffer_Static_Ctor(Ring_Buffer_Static_Handle * me, size_t element_size
 {
     bool success = false;
 
-    if (Is_Valid_Handle(me))
+    if (RB_Is_Valid_Handle(me))
     {
         /* Constructor already called on Handle. Return false. */
     }
@@ -200,7 +131,7 @@ bool Ring_Buffer_Static_Clear(const Ring_Buffer_Static_Handle * me)
 {
     bool success = false;
 
-    if (Is_Valid_Handle(me))
+    if (RB_Is_Valid_Handle(me))
     {
         memset((void *)RB_Instances[(*me)].buffer, 0, RING_BUFFER_STATIC_SIZE);
         RB_Instances[(*me)].head = 0;
@@ -213,105 +144,143 @@ bool Ring_Buffer_Static_Clear(const Ring_Buffer_Static_Handle * me)
 }
 
 
-bool Ring_Buffer_Static_Write(const Ring_Buffer_Static_Handle * me, const void * data, size_t data_size)
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------- FILE DESCRIPTOR I/O. POSIX SYSTEMS ONLY --------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+#if defined(RING_BUFFER_STATIC_FD_IO)
+
+/**
+ * @brief Describes the free space of the Ring Buffer, from HEAD up to TAIL, as at most two regions of the Buffer.
+ *
+ * @param me Valid Ring Buffer Handle that is not Full.
+ * @param region Filled with the free regions in the order they are written.
+ *
+ * @return Number of regions used. 1 or 2.
+ */
+static int RB_Free_Regions(const Ring_Buffer_Static_Handle * me, struct iovec region[2]);
+static int RB_Free_Regions(const Ring_Buffer_Static_Handle * me, struct iovec region[2])
 {
-    bool success = false;
+    const size_t head = RB_Instances[(*me)].head;
+    const size_t tail = RB_Instances[(*me)].tail;
+    int count = 1;
+
+    region[0].iov_base = (void *)(RB_Instances[(*me)].buffer + head);
 
-    /**
-     * data_size is checked to ensure Ring Buffer consists of the same types. Also note
-     * that Is_Full also calls Is_Valid_Handle() since this is a Public Method. If further 
-     * optimization is needed then the body of Is_Full can be copied into this function.
-     */
-    if (Is_Valid_Handle(me) && (!Ring_Buffer_Static_Is_Full(me)) && (data) && (data_size == RB_Instances[(*me)].element_size))
+    if (head < tail)
     {
-        /* Copy data directly from memory so it is passed BY VALUE. */
-        memcpy((void *)(RB_Instances[(*me)].buffer + RB_Instances[(*me)].head), data, data_size);
-        RB_Instances[(*me)].head = (RB_Instances[(*me)].head + data_size) % RB_Instances[(*me)].capacity;
-        RB_Instances[(*me)].is_empty = false;
-        success = true;
+        region[0].iov_len = tail - head;
+    }
+    else
+    {
+        /* Free space wraps around the end of the Buffer. Empty is the case head == tail. */
+        region[0].iov_len = RB_Instances[(*me)].capacity - head;
+        region[1].iov_base = (void *)RB_Instances[(*me)].buffer;
+        region[1].iov_len = tail;
+        count = (tail) ? 2 : 1;
     }
 
-    return success;
+    return count;
 }
 
 
-bool Ring_Buffer_Static_Read(const Ring_Buffer_Static_Handle * me, void * data, size_t data_size)
+/**
+ * @brief Describes the stored bytes of the Ring Buffer, from TAIL up to HEAD, as at most two regions of the Buffer.
+ *
+ * @param me Valid Ring Buffer Handle that is not Empty.
+ * @param region Filled with the used regions in the order they are read.
+ *
+ * @return Number of regions used. 1 or 2.
+ */
+static int RB_Used_Regions(const Ring_Buffer_Static_Handle * me, struct iovec region[2]);
+static int RB_Used_Regions(const Ring_Buffer_Static_Handle * me, struct iovec region[2])
 {
-    bool success = false;
-
-    /**
-     * data_size is checked to ensure Ring Buffer consists of the same types. Also note
-     * that Is_Empty also calls Is_Valid_Handle() since this is a Public Method. If further 
-     * optimization is needed then the body of Is_Empty can be copied into this function.
-     */
-    if (Is_Valid_Handle(me) && !Ring_Buffer_Static_Is_Empty(me) && (data) && (data_size == RB_Instances[(*me)].element_size))
-    {
-        /* Copy data directly from memory so it is passed BY VALUE. */
-        memcpy(data, (const void *)(RB_Instances[(*me)].buffer + RB_Instances[(*me)].tail), data_size);
-        RB_Instances[(*me)].tail = (RB_Instances[(*me)].tail + data_size) % (RB_Instances[(*me)].capacity);
+    const size_t head = RB_Instances[(*me)].head;
+    const size_t tail = RB_Instances[(*me)].tail;
+    int count = 1;
 
-        if (RB_Instances[(*me)].head == RB_Instances[(*me)].tail) 
-        {
-            RB_Instances[(*me)].is_empty = true;
-        }
+    region[0].iov_base = (void *)(RB_Instances[(*me)].buffer + tail);
 
-        success = true;
+    if (tail < head)
+    {
+        region[0].iov_len = head - tail;
+    }
+    else
+    {
+        /* Stored bytes wrap around the end of the Buffer. Full is the case head == tail. */
+        region[0].iov_len = RB_Instances[(*me)].capacity - tail;
+        region[1].iov_base = (void *)RB_Instances[(*me)].buffer;
+        region[1].iov_len = head;
+        count = (head) ? 2 : 1;
     }
 
-    return success;
+    return count;
 }
 
 
-uint32_t Ring_Buffer_Static_Get_Number_Of_Elements(const Ring_Buffer_Static_Handle * me)
+bool Ring_Buffer_Static_Fill_From_Fd(const Ring_Buffer_Static_Handle * me, int fd, size_t * bytes_read)
 {
-    uint32_t num_of_elements = 0;
+    bool success = false;
 
-    if (Is_Valid_Handle(me))
+    if (bytes_read)
     {
-        /**
-         * Note that Is_Full and Is_Empty also call Is_Valid_Handle() since these are Public
-         * Methods. If further optimization is needed then the body of Is_Full and Is_Empty 
-         * can be copied into this function.
-         */
-        if (Ring_Buffer_Static_Is_Full(me))
-        {
-            num_of_elements = RB_Instances[(*me)].capacity;
-        }
-        else if (Ring_Buffer_Static_Is_Empty(me))
-        {
-            num_of_elements = 0;
-        }
-        else
+        *bytes_read = 0;
+    }
+
+    if (RB_Is_Valid_Handle(me) && (bytes_read) && (RB_Instances[(*me)].element_size == 1) && (!Ring_Buffer_Static_Is_Full(me)))
+    {
+        struct iovec region[2];
+        ssize_t count = readv(fd, region, RB_Free_Regions(me, region));
+
+        if (count >= 0)
         {
-            num_of_elements = RB_Instances[(*me)].head / RB_Instances[(*me)].element_size;
+            if (count > 0)
+            {
+                RB_Instances[(*me)].head = (RB_Instances[(*me)].head + (size_t)count) % RB_Instances[(*me)].capacity;
+                RB_Instances[(*me)].is_empty = false;
+            }
+
+            *bytes_read = (size_t)count;
+            success = true;
         }
     }
 
-    return num_of_elements;
+    return success;
 }
 
 
-bool Ring_Buffer_Static_Is_Empty(const Ring_Buffer_Static_Handle * me)
+bool Ring_Buffer_Static_Drain_To_Fd(const Ring_Buffer_Static_Handle * me, int fd, size_t * bytes_written)
 {
-    bool empty = false;
+    bool success = false;
 
-    if (Is_Valid_Handle(me))
+    if (bytes_written)
     {
-        empty = RB_Instances[(*me)].is_empty;
+        *bytes_written = 0;
     }
 
-    return empty;
-}
+    if (RB_Is_Valid_Handle(me) && (bytes_written) && (RB_Instances[(*me)].element_size == 1) && (!Ring_Buffer_Static_Is_Empty(me)))
+    {
+        struct iovec region[2];
+        ssize_t count = writev(fd, region, RB_Used_Regions(me, region));
 
+        if (count >= 0)
+        {
+            if (count > 0)
+            {
+                RB_Instances[(*me)].tail = (RB_Instances[(*me)].tail + (size_t)count) % RB_Instances[(*me)].capacity;
 
-bool Ring_Buffer_Static_Is_Full(const Ring_Buffer_Static_Handle * me)
-{
-    bool full = true;
-    
-    if (Is_Valid_Handle(me))
-    {
-        full = (RB_Instances[(*me)].head == RB_Instances[(*me)].tail) && !(RB_Instances[(*me)].is_empty);
+                if (RB_Instances[(*me)].head == RB_Instances[(*me)].tail)
+                {
+                    RB_Instances[(*me)].is_empty = true;
+                }
+            }
+
+            *bytes_written = (size_t)count;
+            success = true;
+        }
     }
 
-    return full;
+    return success;
 }
+
+#endif /* RING_BUFFER_STATIC_FD_IO */
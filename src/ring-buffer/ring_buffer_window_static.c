@@ -0,0 +1,487 @@
+/**
+ * @file ring_buffer_window_static.c
+ * @author agent
+ * @brief Window Ring Buffer keeping running statistics of its last N samples, without the use of Dynamic Memory
+ * Allocation. See ring_buffer_window_static.h.
+ *
+ * Samples are written to slot 0, 1, ... window_length - 1 and then over the oldest sample again. Until the window is
+ * full its samples are slots 0 to count - 1; once it is full every slot holds one and the oldest is the next one
+ * written (TAIL). Either way the window is one contiguous block, so Recompute sums it in a single pass regardless of
+ * where TAIL is.
+ *
+ * The minimum and maximum are kept in monotonic deques of slot numbers: the minimum deque holds the slots of the
+ * samples that may still become the minimum, oldest first, with their samples increasing from front to back. A new
+ * sample removes every sample behind it that it is smaller than or equal to, so those can never be the minimum again,
+ * and the front is the minimum of the window. The front is removed when its slot is overwritten. Every slot enters
+ * and leaves each deque once, so the minimum and maximum cost O(1) amortized per sample.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+/* Translation Unit */
+#include "ring_buffer_window_static.h"
+
+/* STD-C Libraries. */
+#include <math.h>       /* sqrtf */
+#include <string.h>     /* size_t, memset */
+
+/* Bulk recompute. RING_BUFFER_WINDOW_STATIC_NO_SIMD keeps the scalar loop, i.e. to compare both. */
+#if !defined(RING_BUFFER_WINDOW_STATIC_NO_SIMD) && defined(__AVX2__)
+    #define RBW_AVX2
+    #include <immintrin.h>
+#elif !defined(RING_BUFFER_WINDOW_STATIC_NO_SIMD) && defined(__ARM_NEON) && defined(__aarch64__)
+    #define RBW_NEON
+    #include <arm_neon.h>
+#endif
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------- WINDOW RING BUFFER CLASS DEFINITION ------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Running sum and sum of squares. Exact 64-bit integers for int16_t samples. double for the others: the square
+ * of an int32_t does not fit 64 bits summed over a window, and float sums need more precision than a float.
+ */
+#if defined(RING_BUFFER_WINDOW_STATIC_SAMPLE_INT32)
+    typedef int64_t RBW_Sum;
+    typedef double RBW_Square_Sum;
+#elif defined(RING_BUFFER_WINDOW_STATIC_SAMPLE_FLOAT)
+    typedef double RBW_Sum;
+    typedef double RBW_Square_Sum;
+#else
+    typedef int64_t RBW_Sum;
+    typedef int64_t RBW_Square_Sum;
+#endif
+
+
+/**
+ * @brief A monotonic deque of slot numbers. A Ring Buffer of its own: front is the index of the oldest entry.
+ */
+struct Window_Deque_t
+{
+    uint32_t slots[RING_BUFFER_WINDOW_STATIC_MAX_LENGTH];
+    uint32_t front;
+    uint32_t count;
+};
+
+
+/**
+ * @brief The Window Ring Buffer Object.
+ */
+struct Ring_Buffer_Window_t
+{
+    Ring_Buffer_Window_Static_Sample samples[RING_BUFFER_WINDOW_STATIC_MAX_LENGTH];
+    struct Window_Deque_t min;                  /* Samples increase from front to back. */
+    struct Window_Deque_t max;                  /* Samples decrease from front to back. */
+    RBW_Sum sum;
+    RBW_Square_Sum sum_squares;
+    Ring_Buffer_Window_Static_Handle * handle;  /* Handle using the Window Ring Buffer. See struct Ring_Buffer_t. */
+    uint32_t window_length;
+    uint32_t count;                             /* Number of samples in the window. */
+    uint32_t tail;                              /* Slot the next sample is written to. */
+    uint32_t pushes_since_recompute;
+};
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*---------------------------------- AVAILABLE WINDOW RING BUFFERS FOR USE IN THE APPLICATION -------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/**
+ * @brief The pre-allocated Pool of Window Ring Buffers available to the Application and whether each one is in use. The
+ * Handle is the index in this Pool of the reserved Object. See class_pool.h.
+ */
+CLASS_POOL_DEFINE(static, RBW, struct Ring_Buffer_Window_t, NUMBER_OF_STATIC_WINDOW_RING_BUFFERS);
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ HELPER FUNCTIONS ---------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Returns if the supplied Window Ring Buffer Handle is valid, i.e. the Constructor was successfully called on it.
+ */
+CLASS_POOL_DEFINE_IS_VALID_HANDLE(RBW, Ring_Buffer_Window_Static_Handle, NUMBER_OF_STATIC_WINDOW_RING_BUFFERS)
+
+
+/**
+ * @brief Index in a deque's slots[] of its entry @p offset places behind the front.
+ */
+static inline uint32_t RBW_Deque_Index(const struct Window_Deque_t * deque, uint32_t offset);
+static inline uint32_t RBW_Deque_Index(const struct Window_Deque_t * deque, uint32_t offset)
+{
+    const uint32_t index = deque->front + offset;
+
+    return (index < RING_BUFFER_WINDOW_STATIC_MAX_LENGTH) ? index : (index - RING_BUFFER_WINDOW_STATIC_MAX_LENGTH);
+}
+
+
+/**
+ * @brief Removes the front of a deque if it is @p slot, i.e. the slot about to be overwritten.
+ */
+static inline void RBW_Deque_Expire(struct Window_Deque_t * deque, uint32_t slot);
+static inline void RBW_Deque_Expire(struct Window_Deque_t * deque, uint32_t slot)
+{
+    if ((deque->count) && (deque->slots[deque->front] == slot))
+    {
+        deque->front = RBW_Deque_Index(deque, 1);
+        deque->count--;
+    }
+}
+
+
+/**
+ * @brief Adds @p slot, which stores @p sample, to the back of the minimum (@p is_min) or maximum deque, after removing
+ * every entry it makes redundant.
+ */
+static inline void RBW_Deque_Push(const struct Ring_Buffer_Window_t * rbw, struct Window_Deque_t * deque, bool is_min, uint32_t slot, Ring_Buffer_Window_Static_Sample sample);
+static inline void RBW_Deque_Push(const struct Ring_Buffer_Window_t * rbw, struct Window_Deque_t * deque, bool is_min, uint32_t slot, Ring_Buffer_Window_Static_Sample sample)
+{
+    while (deque->count)
+    {
+        const Ring_Buffer_Window_Static_Sample back = rbw->samples[deque->slots[RBW_Deque_Index(deque, deque->count - 1u)]];
+
+        if ((is_min) ? (back < sample) : (back > sample))
+        {
+            break;
+        }
+
+        deque->count--;
+    }
+
+    deque->slots[RBW_Deque_Index(deque, deque->count)] = slot;
+    deque->count++;
+}
+
+
+/**
+ * @brief The square of a sample, in the type of the sum of squares.
+ */
+static inline RBW_Square_Sum RBW_Square(Ring_Buffer_Window_Static_Sample sample);
+static inline RBW_Square_Sum RBW_Square(Ring_Buffer_Window_Static_Sample sample)
+{
+    return (RBW_Square_Sum)sample * (RBW_Square_Sum)sample;
+}
+
+
+/**
+ * @brief Sums @p count samples and their squares, with AVX2 or NEON when available. The remaining samples that do
+ * not fill a vector are summed by the scalar loop.
+ */
+static void RBW_Bulk_Sums(const Ring_Buffer_Window_Static_Sample * samples, uint32_t count, RBW_Sum * sum, RBW_Square_Sum * sum_squares);
+static void RBW_Bulk_Sums(const Ring_Buffer_Window_Static_Sample * samples, uint32_t count, RBW_Sum * sum, RBW_Square_Sum * sum_squares)
+{
+    RBW_Sum total = 0;
+    RBW_Square_Sum total_squares = 0;
+    uint32_t i = 0;
+
+#if defined(RBW_AVX2) && defined(RING_BUFFER_WINDOW_STATIC_SAMPLE_INT32)
+    __m256i sum_4 = _mm256_setzero_si256();
+    __m256d squares_4 = _mm256_setzero_pd();
+    int64_t sum_lanes[4];
+    double squares_lanes[4];
+
+    for (; (i + 8u) <= count; i += 8u)
+    {
+        const __m256i v = _mm256_loadu_si256((const __m256i *)&samples[i]);
+        const __m128i lo = _mm256_castsi256_si128(v);
+        const __m128i hi = _mm256_extracti128_si256(v, 1);
+        const __m256d lo_d = _mm256_cvtepi32_pd(lo);
+        const __m256d hi_d = _mm256_cvtepi32_pd(hi);
+
+        sum_4 = _mm256_add_epi64(sum_4, _mm256_add_epi64(_mm256_cvtepi32_epi64(lo), _mm256_cvtepi32_epi64(hi)));
+        squares_4 = _mm256_add_pd(squares_4, _mm256_add_pd(_mm256_mul_pd(lo_d, lo_d), _mm256_mul_pd(hi_d, hi_d)));
+    }
+
+    _mm256_storeu_si256((__m256i *)sum_lanes, sum_4);
+    _mm256_storeu_pd(squares_lanes, squares_4);
+    total = sum_lanes[0] + sum_lanes[1] + sum_lanes[2] + sum_lanes[3];
+    total_squares = squares_lanes[0] + squares_lanes[1] + squares_lanes[2] + squares_lanes[3];
+
+#elif defined(RBW_AVX2) && defined(RING_BUFFER_WINDOW_STATIC_SAMPLE_FLOAT)
+    __m256d sum_4 = _mm256_setzero_pd();
+    __m256d squares_4 = _mm256_setzero_pd();
+    double sum_lanes[4];
+    double squares_lanes[4];
+
+    for (; (i + 8u) <= count; i += 8u)
+    {
+        const __m256 v = _mm256_loadu_ps(&samples[i]);
+        const __m256d lo = _mm256_cvtps_pd(_mm256_castps256_ps128(v));
+        const __m256d hi = _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1));
+
+        sum_4 = _mm256_add_pd(sum_4, _mm256_add_pd(lo, hi));
+        squares_4 = _mm256_add_pd(squares_4, _mm256_add_pd(_mm256_mul_pd(lo, lo), _mm256_mul_pd(hi, hi)));
+    }
+
+    _mm256_storeu_pd(sum_lanes, sum_4);
+    _mm256_storeu_pd(squares_lanes, squares_4);
+    total = sum_lanes[0] + sum_lanes[1] + sum_lanes[2] + sum_lanes[3];
+    total_squares = squares_lanes[0] + squares_lanes[1] + squares_lanes[2] + squares_lanes[3];
+
+#elif defined(RBW_AVX2)
+    const __m256i ones = _mm256_set1_epi16(1);
+    __m256i sum_4 = _mm256_setzero_si256();
+    __m256i squares_4 = _mm256_setzero_si256();
+    int64_t sum_lanes[4];
+    int64_t squares_lanes[4];
+
+    for (; (i + 16u) <= count; i += 16u)
+    {
+        const __m256i v = _mm256_loadu_si256((const __m256i *)&samples[i]);
+        const __m256i pairs = _mm256_madd_epi16(v, ones);
+        /* Up to 2 * 32768^2 = 2^31, which only fits unsigned. */
+        const __m256i squares = _mm256_madd_epi16(v, v);
+
+        sum_4 = _mm256_add_epi64(sum_4, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(pairs)));
+        sum_4 = _mm256_add_epi64(sum_4, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(pairs, 1)));
+        squares_4 = _mm256_add_epi64(squares_4, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(squares)));
+        squares_4 = _mm256_add_epi64(squares_4, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(squares, 1)));
+    }
+
+    _mm256_storeu_si256((__m256i *)sum_lanes, sum_4);
+    _mm256_storeu_si256((__m256i *)squares_lanes, squares_4);
+    total = sum_lanes[0] + sum_lanes[1] + sum_lanes[2] + sum_lanes[3];
+    total_squares = squares_lanes[0] + squares_lanes[1] + squares_lanes[2] + squares_lanes[3];
+
+#elif defined(RBW_NEON) && defined(RING_BUFFER_WINDOW_STATIC_SAMPLE_INT32)
+    int64x2_t sum_2 = vdupq_n_s64(0);
+    float64x2_t squares_2 = vdupq_n_f64(0.0);
+
+    for (; (i + 4u) <= count; i += 4u)
+    {
+        const int32x4_t v = vld1q_s32(&samples[i]);
+        const float64x2_t lo = vcvtq_f64_s64(vmovl_s32(vget_low_s32(v)));
+        const float64x2_t hi = vcvtq_f64_s64(vmovl_high_s32(v));
+
+        sum_2 = vpadalq_s32(sum_2, v);
+        squares_2 = vfmaq_f64(vfmaq_f64(squares_2, lo, lo), hi, hi);
+    }
+
+    total = vaddvq_s64(sum_2);
+    total_squares = vaddvq_f64(squares_2);
+
+#elif defined(RBW_NEON) && defined(RING_BUFFER_WINDOW_STATIC_SAMPLE_FLOAT)
+    float64x2_t sum_2 = vdupq_n_f64(0.0);
+    float64x2_t squares_2 = vdupq_n_f64(0.0);
+
+    for (; (i + 4u) <= count; i += 4u)
+    {
+        const float32x4_t v = vld1q_f32(&samples[i]);
+        const float64x2_t lo = vcvt_f64_f32(vget_low_f32(v));
+        const float64x2_t hi = vcvt_high_f64_f32(v);
+
+        sum_2 = vaddq_f64(sum_2, vaddq_f64(lo, hi));
+        squares_2 = vfmaq_f64(vfmaq_f64(squares_2, lo, lo), hi, hi);
+    }
+
+    total = vaddvq_f64(sum_2);
+    total_squares = vaddvq_f64(squares_2);
+
+#elif defined(RBW_NEON)
+    int64x2_t sum_2 = vdupq_n_s64(0);
+    int64x2_t squares_2 = vdupq_n_s64(0);
+
+    for (; (i + 8u) <= count; i += 8u)
+    {
+        const int16x8_t v = vld1q_s16(&samples[i]);
+
+        sum_2 = vpadalq_s32(sum_2, vpaddlq_s16(v));
+        squares_2 = vpadalq_s32(squares_2, vmull_s16(vget_low_s16(v), vget_low_s16(v)));
+        squares_2 = vpadalq_s32(squares_2, vmull_high_s16(v, v));
+    }
+
+    total = vaddvq_s64(sum_2);
+    total_squares = vaddvq_s64(squares_2);
+#endif
+
+    for (; i < count; i++)
+    {
+        total += (RBW_Sum)samples[i];
+        total_squares += RBW_Square(samples[i]);
+    }
+
+    *sum = total;
+    *sum_squares = total_squares;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ PUBLIC FUNCTIONS ---------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+bool Ring_Buffer_Window_Static_Ctor(Ring_Buffer_Window_Static_Handle * me, uint32_t window_length_0)
+{
+    bool success = false;
+
+    if (RBW_Is_Valid_Handle(me))
+    {
+        /* Constructor already called on Handle. Return false. */
+    }
+    else
+    {
+        if ((me) && (window_length_0) && (window_length_0 <= RING_BUFFER_WINDOW_STATIC_MAX_LENGTH))
+        {
+            for (uint32_t i = 0; i < NUMBER_OF_STATIC_WINDOW_RING_BUFFERS; i++)
+            {
+                if (!RBW_Instances_In_Use[i])
+                {
+                    memset((void *)&RBW_Instances[i], 0, sizeof(RBW_Instances[i]));
+                    *me = i;
+                    RBW_Instances[i].handle = me;
+                    RBW_Instances[i].window_length = window_length_0;
+                    RBW_Instances_In_Use[i] = true;
+                    success = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    return success;
+}
+
+
+bool Ring_Buffer_Window_Static_Destroy(const Ring_Buffer_Window_Static_Handle * me)
+{
+    bool success = false;
+
+    if (RBW_Is_Valid_Handle(me))
+    {
+        memset((void *)&RBW_Instances[(*me)], 0, sizeof(RBW_Instances[(*me)]));
+        RBW_Instances_In_Use[(*me)] = false;
+        success = true;
+    }
+
+    return success;
+}
+
+
+bool Ring_Buffer_Window_Static_Clear(const Ring_Buffer_Window_Static_Handle * me)
+{
+    bool success = false;
+
+    if (RBW_Is_Valid_Handle(me))
+    {
+        struct Ring_Buffer_Window_t * const rbw = &RBW_Instances[(*me)];
+
+        rbw->min.front = 0;
+        rbw->min.count = 0;
+        rbw->max.front = 0;
+        rbw->max.count = 0;
+        rbw->sum = 0;
+        rbw->sum_squares = 0;
+        rbw->count = 0;
+        rbw->tail = 0;
+        rbw->pushes_since_recompute = 0;
+        success = true;
+    }
+
+    return success;
+}
+
+
+bool Ring_Buffer_Window_Static_Push(const Ring_Buffer_Window_Static_Handle * me, Ring_Buffer_Window_Static_Sample sample)
+{
+    bool success = false;
+
+    if (RBW_Is_Valid_Handle(me))
+    {
+        struct Ring_Buffer_Window_t * const rbw = &RBW_Instances[(*me)];
+        const uint32_t slot = rbw->tail;
+
+        if (rbw->count == rbw->window_length)
+        {
+            /* The oldest sample is at TAIL. It leaves the window. */
+            const Ring_Buffer_Window_Static_Sample oldest = rbw->samples[slot];
+
+            RBW_Deque_Expire(&rbw->min, slot);
+            RBW_Deque_Expire(&rbw->max, slot);
+            rbw->sum -= (RBW_Sum)oldest;
+            rbw->sum_squares -= RBW_Square(oldest);
+        }
+        else
+        {
+            rbw->count++;
+        }
+
+        rbw->samples[slot] = sample;
+        rbw->sum += (RBW_Sum)sample;
+        rbw->sum_squares += RBW_Square(sample);
+        RBW_Deque_Push(rbw, &rbw->min, true, slot, sample);
+        RBW_Deque_Push(rbw, &rbw->max, false, slot, sample);
+        rbw->tail = ((slot + 1u) == rbw->window_length) ? 0 : (slot + 1u);
+
+#if (RING_BUFFER_WINDOW_STATIC_RECOMPUTE_PERIOD > 0)
+        if (++rbw->pushes_since_recompute >= RING_BUFFER_WINDOW_STATIC_RECOMPUTE_PERIOD)
+        {
+            (void)Ring_Buffer_Window_Static_Recompute(me);
+        }
+#endif
+
+        success = true;
+    }
+
+    return success;
+}
+
+
+bool Ring_Buffer_Window_Static_Get_Stats(const Ring_Buffer_Window_Static_Handle * me, Ring_Buffer_Window_Static_Stats * stats)
+{
+    bool success = false;
+
+    if (RBW_Is_Valid_Handle(me) && (RBW_Instances[(*me)].count) && (stats))
+    {
+        const struct Ring_Buffer_Window_t * const rbw = &RBW_Instances[(*me)];
+        const float count = (float)rbw->count;
+        /* The running sum of squares of float samples may drift slightly below 0 when the window is all zeros. */
+        const float mean_square = (float)rbw->sum_squares / count;
+
+        stats->min = rbw->samples[rbw->min.slots[rbw->min.front]];
+        stats->max = rbw->samples[rbw->max.slots[rbw->max.front]];
+        stats->mean = (float)rbw->sum / count;
+        stats->rms = (mean_square > 0.0f) ? sqrtf(mean_square) : 0.0f;
+        success = true;
+    }
+
+    return success;
+}
+
+
+uint32_t Ring_Buffer_Window_Static_Get_Number_Of_Samples(const Ring_Buffer_Window_Static_Handle * me)
+{
+    uint32_t count = 0;
+
+    if (RBW_Is_Valid_Handle(me))
+    {
+        count = RBW_Instances[(*me)].count;
+    }
+
+    return count;
+}
+
+
+bool Ring_Buffer_Window_Static_Recompute(const Ring_Buffer_Window_Static_Handle * me)
+{
+    bool success = false;
+
+    if (RBW_Is_Valid_Handle(me))
+    {
+        struct Ring_Buffer_Window_t * const rbw = &RBW_Instances[(*me)];
+
+        /* The samples in the window are always slots 0 to count - 1. See the top of this file. */
+        RBW_Bulk_Sums(rbw->samples, rbw->count, &rbw->sum, &rbw->sum_squares);
+        rbw->pushes_since_recompute = 0;
+        success = true;
+    }
+
+    return success;
+}
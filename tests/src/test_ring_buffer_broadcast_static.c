@@ -0,0 +1,552 @@
+/**
+ * @file test_ring_buffer_broadcast_static.c
+ * @author agent
+ * @brief Unit Tests for the Broadcast Ring Buffer module (ring_buffer_broadcast_static.h). Covers the Handles, the
+ * delivery of every element to every Reader, the producer being held back by the slowest Reader only, and a
+ * producer thread with several Reader threads that is meant to run under the tsan profile:
+ * cd tests && make clean && make test PROFILE=tsan
+ *
+ * RBB_THREADS_ITEMS=<count> overrides the number of items the producer thread writes.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#define _POSIX_C_SOURCE 200809L     /* pthread, sched_yield */
+
+/* STD-C Libraries */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>      /* snprintf */
+#include <stdlib.h>     /* getenv, strtoull */
+#include <string.h>     /* memset, size_t */
+
+/* POSIX */
+#include <pthread.h>
+#include <sched.h>      /* sched_yield */
+
+/* Unit Test Framework */
+#include "unity.h"
+
+/* Unit Test Support */
+#include "test_guard.h"
+
+/* Module Under Test */
+#include "ring_buffer_broadcast_static.h"
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------- UNIT TEST SETUP VALUES ------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Guard Region patterns. Same meaning as RB_INSTANCES_PREPOSTPEND_VALUES and
+ * RB_INSTANCES_IN_USE_PREPOSTPEND_VALUES in test_ring_buffer_static.c.
+ */
+#define RBB_INSTANCES_PREPOSTPEND_VALUES                          0x35
+#define RBB_INSTANCES_IN_USE_PREPOSTPEND_VALUES                   0x46
+
+
+/**
+ * @brief Number of uint32_t elements of the Broadcast Ring Buffer most tests use. Small, so positions wrap often.
+ */
+#define RBB_TEST_LENGTH                                           5u
+
+
+/**
+ * @brief Number of items the producer thread writes when RBB_THREADS_ITEMS is not set.
+ */
+#define RBB_THREADS_DEFAULT_ITEMS                                 20000ULL
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------- GUARD REGIONS ---------------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+static Test_Guard RBB_Instances_Guard;
+static Test_Guard RBB_Instances_In_Use_Guard;
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*----------------------------------------------------------- HELPERS -----------------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief The Handles the tests construct, destroyed in tearDown() whatever happened.
+ */
+static Ring_Buffer_Broadcast_Static_Handle RBB_Handles[NUMBER_OF_STATIC_BROADCAST_RING_BUFFERS + 1];
+static Ring_Buffer_Broadcast_Static_Reader RBB_Readers[RING_BUFFER_BROADCAST_STATIC_MAX_READERS + 1];
+
+
+/**
+ * @brief A Reader thread. Written by the thread only and read by the test after pthread_join().
+ */
+typedef struct
+{
+   const Ring_Buffer_Broadcast_Static_Handle * me;
+   const Ring_Buffer_Broadcast_Static_Reader * reader;
+   uint64_t items;
+   uint64_t received;
+   uint64_t mismatches;
+   uint32_t reads_per_yield;                       /* Makes some Readers slower than others. */
+   int * start;                                    /* __atomic */
+} RBB_Threads_Reader_t;
+
+
+/**
+ * @brief Constructs RBB_Handles[0] with RBB_TEST_LENGTH uint32_t elements and registers @p readers Readers on it.
+ */
+static void RBB_Setup(uint32_t readers);
+static void RBB_Setup(uint32_t readers)
+{
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Ctor(&RBB_Handles[0], sizeof(uint32_t), RBB_TEST_LENGTH));
+
+   for (uint32_t i = 0; i < readers; i++)
+   {
+      TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Add_Reader(&RBB_Handles[0], &RBB_Readers[i]));
+   }
+}
+
+
+/**
+ * @brief Reads one element of a Reader and checks it is @p expected.
+ */
+static void RBB_Expect_Read(const Ring_Buffer_Broadcast_Static_Reader * reader, uint32_t expected);
+static void RBB_Expect_Read(const Ring_Buffer_Broadcast_Static_Reader * reader, uint32_t expected)
+{
+   uint32_t value = ~expected;
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Read(&RBB_Handles[0], reader, &value, sizeof(value)));
+   TEST_ASSERT_EQUAL_UINT32(expected, value);
+}
+
+
+/**
+ * @brief Number of items the producer thread writes. RBB_THREADS_ITEMS overrides RBB_THREADS_DEFAULT_ITEMS.
+ */
+static uint64_t RBB_Threads_Items(void);
+static uint64_t RBB_Threads_Items(void)
+{
+   const char * text = getenv("RBB_THREADS_ITEMS");
+   uint64_t items = RBB_THREADS_DEFAULT_ITEMS;
+
+   if ((text) && (*text))
+   {
+      items = (uint64_t)strtoull(text, NULL, 0);
+   }
+
+   return items;
+}
+
+
+/**
+ * @brief Spins until the test sets start. Yields so this also works when there are fewer CPUs than threads.
+ */
+static void RBB_Threads_Wait_For_Start(int * start);
+static void RBB_Threads_Wait_For_Start(int * start)
+{
+   while (!__atomic_load_n(start, __ATOMIC_ACQUIRE))
+   {
+      (void)sched_yield();
+   }
+}
+
+
+/**
+ * @brief Reads every item the producer writes and checks they are 0, 1, 2... without gaps.
+ */
+static void * RBB_Threads_Reader(void * arg);
+static void * RBB_Threads_Reader(void * arg)
+{
+   RBB_Threads_Reader_t * self = (RBB_Threads_Reader_t *)arg;
+   uint32_t reads = 0;
+
+   RBB_Threads_Wait_For_Start(self->start);
+
+   while (self->received < self->items)
+   {
+      uint32_t value = 0;
+
+      if (Ring_Buffer_Broadcast_Static_Read(self->me, self->reader, &value, sizeof(value)))
+      {
+         self->mismatches += (value != (uint32_t)self->received);
+         self->received++;
+      }
+
+      if ((++reads % self->reads_per_yield) == 0)
+      {
+         (void)sched_yield();
+      }
+   }
+
+   return NULL;
+}
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------- RUNS AT THE START AND END OF EACH TEST --------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+void setUp(void)
+{
+   Test_Guard_Init(&RBB_Instances_Guard, "RBB_Instances[]", &Test_RBB_Instances_Memory_Region[0], Test_RBB_Instances_Mem_Size,
+                   CLASS_POOL_MEMORY_EXTENSION_BYTES, RBB_INSTANCES_PREPOSTPEND_VALUES);
+   Test_Guard_Init(&RBB_Instances_In_Use_Guard, "RBB_Instances_In_Use[]", &Test_RBB_Instances_In_Use_Memory_Region[0], Test_RBB_Instances_In_Use_Mem_Size,
+                   CLASS_POOL_IN_USE_MEMORY_EXTENSION_BYTES, RBB_INSTANCES_IN_USE_PREPOSTPEND_VALUES);
+   Test_Guard_Arm(&RBB_Instances_Guard);
+   Test_Guard_Arm(&RBB_Instances_In_Use_Guard);
+
+   memset((void *)RBB_Handles, 0, sizeof(RBB_Handles));
+   memset((void *)RBB_Readers, 0, sizeof(RBB_Readers));
+}
+
+void tearDown(void)
+{
+   for (uint32_t i = 0; i < (NUMBER_OF_STATIC_BROADCAST_RING_BUFFERS + 1); i++)
+   {
+      (void)Ring_Buffer_Broadcast_Static_Destroy(&RBB_Handles[i]);
+   }
+
+   Test_Guard_Release(&RBB_Instances_Guard);
+   Test_Guard_Release(&RBB_Instances_In_Use_Guard);
+   memset((void *)&Test_RBB_Instances_Memory_Region[0], 0, Test_RBB_Instances_Mem_Size);
+   memset((void *)&Test_RBB_Instances_In_Use_Memory_Region[0], 0, Test_RBB_Instances_In_Use_Mem_Size);
+}
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------------------- UNIT TESTS BEGIN -----------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief The Constructor refuses invalid arguments, Handles already constructed and requests once the pool is used
+ * up. Destroy frees a Broadcast Ring Buffer for the next Constructor and invalidates the Handle.
+ */
+static void Test_Ring_Buffer_Broadcast_Static_Ctor_Destroy(void);
+static void Test_Ring_Buffer_Broadcast_Static_Ctor_Destroy(void)
+{
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Ctor(NULL, 1, 1));
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Ctor(&RBB_Handles[0], 0, 1));
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Ctor(&RBB_Handles[0], 1, 0));
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Ctor(&RBB_Handles[0], 1, RING_BUFFER_BROADCAST_STATIC_SIZE + 1));
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Destroy(&RBB_Handles[0]));
+
+   for (uint32_t i = 0; i < NUMBER_OF_STATIC_BROADCAST_RING_BUFFERS; i++)
+   {
+      TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Ctor(&RBB_Handles[i], 1, RING_BUFFER_BROADCAST_STATIC_SIZE));
+      TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Ctor(&RBB_Handles[i], 1, 1));
+   }
+
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Ctor(&RBB_Handles[NUMBER_OF_STATIC_BROADCAST_RING_BUFFERS], 1, 1));
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Destroy(&RBB_Handles[0]));
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Destroy(&RBB_Handles[0]));
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Is_Full(&RBB_Handles[0]));
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Ctor(&RBB_Handles[NUMBER_OF_STATIC_BROADCAST_RING_BUFFERS], 1, 1));
+
+   TEST_ASSERT_GUARD_INTACT(&RBB_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RBB_Instances_In_Use_Guard);
+}
+
+
+/**
+ * @brief Up to RING_BUFFER_BROADCAST_STATIC_MAX_READERS Readers register. A Reader Handle is only valid on the
+ * Broadcast Ring Buffer it was added to, until it is removed or that Broadcast Ring Buffer is destroyed.
+ */
+static void Test_Ring_Buffer_Broadcast_Static_Readers(void);
+static void Test_Ring_Buffer_Broadcast_Static_Readers(void)
+{
+   uint32_t value = 0;
+
+   RBB_Setup(RING_BUFFER_BROADCAST_STATIC_MAX_READERS);
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Ctor(&RBB_Handles[1], sizeof(uint32_t), RBB_TEST_LENGTH));
+
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Add_Reader(&RBB_Handles[0], &RBB_Readers[RING_BUFFER_BROADCAST_STATIC_MAX_READERS]));
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Add_Reader(&RBB_Handles[0], &RBB_Readers[0]));
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Add_Reader(&RBB_Handles[0], NULL));
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Add_Reader(&RBB_Handles[2], &RBB_Readers[RING_BUFFER_BROADCAST_STATIC_MAX_READERS]));
+
+   /* Registered on RBB_Handles[0] only. */
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Write(&RBB_Handles[1], &value, sizeof(value)));
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Read(&RBB_Handles[1], &RBB_Readers[0], &value, sizeof(value)));
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Remove_Reader(&RBB_Handles[1], &RBB_Readers[0]));
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Remove_Reader(&RBB_Handles[0], &RBB_Readers[1]));
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Remove_Reader(&RBB_Handles[0], &RBB_Readers[1]));
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Is_Empty(&RBB_Handles[0], &RBB_Readers[1]));
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Add_Reader(&RBB_Handles[0], &RBB_Readers[RING_BUFFER_BROADCAST_STATIC_MAX_READERS]));
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Is_Empty(&RBB_Handles[0], &RBB_Readers[RING_BUFFER_BROADCAST_STATIC_MAX_READERS]));
+
+   /* Destroying the Broadcast Ring Buffer unregisters its Readers. */
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Destroy(&RBB_Handles[0]));
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Ctor(&RBB_Handles[0], sizeof(uint32_t), RBB_TEST_LENGTH));
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Is_Empty(&RBB_Handles[0], &RBB_Readers[0]));
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Remove_Reader(&RBB_Handles[0], &RBB_Readers[0]));
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Add_Reader(&RBB_Handles[0], &RBB_Readers[0]));
+
+   TEST_ASSERT_GUARD_INTACT(&RBB_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RBB_Instances_In_Use_Guard);
+}
+
+
+/**
+ * @brief Every Reader reads every element, in order, at its own pace, while the positions wrap many times.
+ */
+static void Test_Ring_Buffer_Broadcast_Static_Every_Reader_Reads_Everything(void);
+static void Test_Ring_Buffer_Broadcast_Static_Every_Reader_Reads_Everything(void)
+{
+   uint32_t next_read[3] = { 0, 0, 0 };
+
+   RBB_Setup(3);
+
+   for (uint32_t value = 0; value < 20u * RBB_TEST_LENGTH; value++)
+   {
+      TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Write(&RBB_Handles[0], &value, sizeof(value)));
+
+      /* Reader 0 keeps up, Reader 1 catches up in bursts and Reader 2 stays as far behind as possible. */
+      RBB_Expect_Read(&RBB_Readers[0], next_read[0]++);
+
+      if ((value % RBB_TEST_LENGTH) == (RBB_TEST_LENGTH - 1))
+      {
+         while (next_read[1] <= value)
+         {
+            RBB_Expect_Read(&RBB_Readers[1], next_read[1]++);
+         }
+      }
+
+      if ((value + 1 - next_read[2]) == RBB_TEST_LENGTH)
+      {
+         TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Is_Full(&RBB_Handles[0]));
+         RBB_Expect_Read(&RBB_Readers[2], next_read[2]++);
+      }
+
+      for (uint32_t r = 0; r < 3; r++)
+      {
+         TEST_ASSERT_EQUAL_UINT32(value + 1 - next_read[r], Ring_Buffer_Broadcast_Static_Get_Number_Of_Elements(&RBB_Handles[0], &RBB_Readers[r]));
+      }
+   }
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Is_Empty(&RBB_Handles[0], &RBB_Readers[0]));
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Is_Empty(&RBB_Handles[0], &RBB_Readers[1]));
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Is_Empty(&RBB_Handles[0], &RBB_Readers[2]));
+   TEST_ASSERT_GUARD_INTACT(&RBB_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RBB_Instances_In_Use_Guard);
+}
+
+
+/**
+ * @brief The slowest Reader alone decides when the producer is Full. Reading from it, or removing it, makes room.
+ */
+static void Test_Ring_Buffer_Broadcast_Static_Slowest_Reader_Gates_Producer(void);
+static void Test_Ring_Buffer_Broadcast_Static_Slowest_Reader_Gates_Producer(void)
+{
+   uint32_t value = 0;
+
+   RBB_Setup(2);
+
+   for (value = 0; value < RBB_TEST_LENGTH; value++)
+   {
+      TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Is_Full(&RBB_Handles[0]));
+      TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Write(&RBB_Handles[0], &value, sizeof(value)));
+      RBB_Expect_Read(&RBB_Readers[0], value);
+   }
+
+   /* Reader 0 has read everything. Reader 1 holds back the producer. */
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Is_Full(&RBB_Handles[0]));
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Write(&RBB_Handles[0], &value, sizeof(value)));
+   TEST_ASSERT_EQUAL_UINT32(RBB_TEST_LENGTH, Ring_Buffer_Broadcast_Static_Get_Number_Of_Elements(&RBB_Handles[0], &RBB_Readers[1]));
+
+   RBB_Expect_Read(&RBB_Readers[1], 0);
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Is_Full(&RBB_Handles[0]));
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Write(&RBB_Handles[0], &value, sizeof(value)));
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Is_Full(&RBB_Handles[0]));
+
+   /* The element overwritten last is the one Reader 1 read. Its other elements are intact. */
+   for (uint32_t expected = 1; expected <= RBB_TEST_LENGTH; expected++)
+   {
+      RBB_Expect_Read(&RBB_Readers[1], expected);
+   }
+
+   /* Removing the slowest Reader releases the producer. */
+   value++;
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Write(&RBB_Handles[0], &value, sizeof(value)));
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Remove_Reader(&RBB_Handles[0], &RBB_Readers[0]));
+
+   for (uint32_t i = 0; i < (RBB_TEST_LENGTH - 1); i++)
+   {
+      value++;
+      TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Write(&RBB_Handles[0], &value, sizeof(value)));
+   }
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Is_Full(&RBB_Handles[0]));
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Remove_Reader(&RBB_Handles[0], &RBB_Readers[1]));
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Is_Full(&RBB_Handles[0]));
+   TEST_ASSERT_GUARD_INTACT(&RBB_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RBB_Instances_In_Use_Guard);
+}
+
+
+/**
+ * @brief Without Readers nothing holds back the producer. A Reader added later only reads what is written after it.
+ */
+static void Test_Ring_Buffer_Broadcast_Static_Late_Reader(void);
+static void Test_Ring_Buffer_Broadcast_Static_Late_Reader(void)
+{
+   uint32_t value = 0;
+
+   RBB_Setup(0);
+
+   for (value = 0; value < (3u * RBB_TEST_LENGTH) + 2u; value++)
+   {
+      TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Is_Full(&RBB_Handles[0]));
+      TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Write(&RBB_Handles[0], &value, sizeof(value)));
+   }
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Add_Reader(&RBB_Handles[0], &RBB_Readers[0]));
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Is_Empty(&RBB_Handles[0], &RBB_Readers[0]));
+
+   for (uint32_t i = 0; i < RBB_TEST_LENGTH; i++, value++)
+   {
+      TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Write(&RBB_Handles[0], &value, sizeof(value)));
+   }
+
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Write(&RBB_Handles[0], &value, sizeof(value)));
+
+   for (uint32_t i = 0; i < RBB_TEST_LENGTH; i++)
+   {
+      RBB_Expect_Read(&RBB_Readers[0], value - RBB_TEST_LENGTH + i);
+   }
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Is_Empty(&RBB_Handles[0], &RBB_Readers[0]));
+   TEST_ASSERT_GUARD_INTACT(&RBB_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RBB_Instances_In_Use_Guard);
+}
+
+
+/**
+ * @brief Write and Read refuse invalid Handles, NULL data and the wrong data size without changing anything.
+ */
+static void Test_Ring_Buffer_Broadcast_Static_Invalid_Arguments(void);
+static void Test_Ring_Buffer_Broadcast_Static_Invalid_Arguments(void)
+{
+   Ring_Buffer_Broadcast_Static_Reader unregistered = 0;
+   uint64_t wide = 0;
+   uint32_t value = 7;
+
+   RBB_Setup(1);
+
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Write(NULL, &value, sizeof(value)));
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Write(&RBB_Handles[1], &value, sizeof(value)));
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Write(&RBB_Handles[0], NULL, sizeof(value)));
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Write(&RBB_Handles[0], &wide, sizeof(wide)));
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Is_Empty(&RBB_Handles[0], &RBB_Readers[0]));
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Write(&RBB_Handles[0], &value, sizeof(value)));
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Read(&RBB_Handles[0], NULL, &value, sizeof(value)));
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Read(&RBB_Handles[0], &unregistered, &value, sizeof(value)));
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Read(&RBB_Handles[0], &RBB_Readers[0], NULL, sizeof(value)));
+   TEST_ASSERT_FALSE(Ring_Buffer_Broadcast_Static_Read(&RBB_Handles[0], &RBB_Readers[0], &wide, sizeof(wide)));
+   TEST_ASSERT_EQUAL_UINT32(0, Ring_Buffer_Broadcast_Static_Get_Number_Of_Elements(&RBB_Handles[0], &unregistered));
+   TEST_ASSERT_EQUAL_UINT32(1, Ring_Buffer_Broadcast_Static_Get_Number_Of_Elements(&RBB_Handles[0], &RBB_Readers[0]));
+   RBB_Expect_Read(&RBB_Readers[0], 7);
+
+   TEST_ASSERT_GUARD_INTACT(&RBB_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RBB_Instances_In_Use_Guard);
+}
+
+
+/**
+ * @brief The Objects stay aligned to RING_BUFFER_BROADCAST_STATIC_CACHE_LINE and have room for the producer's line
+ * and one line per Reader besides the buffer.
+ */
+static void Test_Ring_Buffer_Broadcast_Static_Cache_Line_Layout(void);
+static void Test_Ring_Buffer_Broadcast_Static_Cache_Line_Layout(void)
+{
+   const size_t pool_size = Test_RBB_Instances_Mem_Size - (2u * CLASS_POOL_MEMORY_EXTENSION_BYTES);
+   const size_t object_size = pool_size / NUMBER_OF_STATIC_BROADCAST_RING_BUFFERS;
+
+   TEST_ASSERT_EQUAL_size_t(0, (size_t)(uintptr_t)&Test_RBB_Instances_Memory_Region[CLASS_POOL_MEMORY_EXTENSION_BYTES] % RING_BUFFER_BROADCAST_STATIC_CACHE_LINE);
+   TEST_ASSERT_EQUAL_size_t(0, object_size % RING_BUFFER_BROADCAST_STATIC_CACHE_LINE);
+   TEST_ASSERT_TRUE(object_size >= (((1u + RING_BUFFER_BROADCAST_STATIC_MAX_READERS) * RING_BUFFER_BROADCAST_STATIC_CACHE_LINE) + RING_BUFFER_BROADCAST_STATIC_SIZE));
+}
+
+
+/**
+ * @brief One producer thread and RING_BUFFER_BROADCAST_STATIC_MAX_READERS Reader threads of different speeds,
+ * without locks. Every Reader must read every item exactly once and in order.
+ */
+static void Test_Ring_Buffer_Broadcast_Static_Threads(void);
+static void Test_Ring_Buffer_Broadcast_Static_Threads(void)
+{
+   pthread_t threads[RING_BUFFER_BROADCAST_STATIC_MAX_READERS];
+   RBB_Threads_Reader_t readers[RING_BUFFER_BROADCAST_STATIC_MAX_READERS];
+   const uint64_t items = RBB_Threads_Items();
+   int start = 0;
+   char message[64];
+
+   RBB_Setup(RING_BUFFER_BROADCAST_STATIC_MAX_READERS);
+   memset((void *)readers, 0, sizeof(readers));
+
+   for (uint32_t i = 0; i < RING_BUFFER_BROADCAST_STATIC_MAX_READERS; i++)
+   {
+      readers[i].me = &RBB_Handles[0];
+      readers[i].reader = &RBB_Readers[i];
+      readers[i].items = items;
+      readers[i].reads_per_yield = 1u + (i * 7u);
+      readers[i].start = &start;
+      TEST_ASSERT_EQUAL_INT(0, pthread_create(&threads[i], NULL, RBB_Threads_Reader, &readers[i]));
+   }
+
+   __atomic_store_n(&start, 1, __ATOMIC_RELEASE);
+
+   /* This thread is the producer. */
+   for (uint64_t i = 0; i < items; i++)
+   {
+      const uint32_t value = (uint32_t)i;
+
+      while (!Ring_Buffer_Broadcast_Static_Write(&RBB_Handles[0], &value, sizeof(value)))
+      {
+         (void)sched_yield();
+      }
+   }
+
+   for (uint32_t i = 0; i < RING_BUFFER_BROADCAST_STATIC_MAX_READERS; i++)
+   {
+      TEST_ASSERT_EQUAL_INT(0, pthread_join(threads[i], NULL));
+   }
+
+   for (uint32_t i = 0; i < RING_BUFFER_BROADCAST_STATIC_MAX_READERS; i++)
+   {
+      (void)snprintf(message, sizeof(message), "Reader %u", (unsigned)i);
+      TEST_ASSERT_EQUAL_UINT64_MESSAGE(items, readers[i].received, message);
+      TEST_ASSERT_EQUAL_UINT64_MESSAGE(0, readers[i].mismatches, message);
+      TEST_ASSERT_TRUE(Ring_Buffer_Broadcast_Static_Is_Empty(&RBB_Handles[0], &RBB_Readers[i]));
+   }
+
+   TEST_ASSERT_GUARD_INTACT(&RBB_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RBB_Instances_In_Use_Guard);
+}
+
+
+
+
+int main(void)
+{
+   UNITY_BEGIN();
+   RUN_TEST(Test_Ring_Buffer_Broadcast_Static_Ctor_Destroy);
+   RUN_TEST(Test_Ring_Buffer_Broadcast_Static_Readers);
+   RUN_TEST(Test_Ring_Buffer_Broadcast_Static_Every_Reader_Reads_Everything);
+   RUN_TEST(Test_Ring_Buffer_Broadcast_Static_Slowest_Reader_Gates_Producer);
+   RUN_TEST(Test_Ring_Buffer_Broadcast_Static_Late_Reader);
+   RUN_TEST(Test_Ring_Buffer_Broadcast_Static_Invalid_Arguments);
+   RUN_TEST(Test_Ring_Buffer_Broadcast_Static_Cache_Line_Layout);
+   RUN_TEST(Test_Ring_Buffer_Broadcast_Static_Threads);
+   return UNITY_END();
+}
@@ -0,0 +1,445 @@
+/**
+ * @file test_ring_buffer_fir_static.c
+ * @author agent
+ * @brief Unit Tests for the FIR Filter Ring Buffer module (ring_buffer_fir_static.h). Checks the filtered samples
+ * against a direct convolution of the whole input for tap counts around every vector width, streamed in blocks of
+ * different sizes, out of and in place. Covers the sample type and instruction set the Class library was built with:
+ * cd tests && make clean && make test FIR_SAMPLE=q31 ARCH_FLAGS=-mavx2
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+/* STD-C Libraries */
+#include <math.h>       /* fabs */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>      /* snprintf */
+#include <string.h>     /* memcpy, memset */
+
+/* Unit Test Framework */
+#include "unity.h"
+
+/* Unit Test Support */
+#include "test_guard.h"
+
+/* Module Under Test */
+#include "ring_buffer_fir_static.h"
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------- UNIT TEST SETUP VALUES ------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Guard Region patterns. Same meaning as RB_INSTANCES_PREPOSTPEND_VALUES and
+ * RB_INSTANCES_IN_USE_PREPOSTPEND_VALUES in test_ring_buffer_static.c.
+ */
+#define RBF_INSTANCES_PREPOSTPEND_VALUES                          0x39
+#define RBF_INSTANCES_IN_USE_PREPOSTPEND_VALUES                   0x4A
+
+
+/**
+ * @brief Number of samples streamed through the filter per tap count.
+ */
+#define RBF_TEST_SAMPLES                                          300u
+
+
+/**
+ * @brief Per sample type:
+ * RBF_HALF              0.5, the amplitude of the impulse.
+ * RBF_COEFFICIENT_SCALE Scales the coefficients of the impulse response so that half of them is exact.
+ * RBF_SAMPLE_SHIFT      Right shift of the random samples. Q31 needs log2(RING_BUFFER_FIR_STATIC_MAX_TAPS) guard bits.
+ * RBF_EXTREME_SAMPLE    The most negative sample.
+ * RBF_EXTREME_TAP       The most negative coefficient allowed with RBF_EXTREME_SAMPLE for every tap.
+ */
+#if defined(RING_BUFFER_FIR_STATIC_SAMPLE_Q31)
+   #define RBF_HALF                                               ((Ring_Buffer_FIR_Static_Sample)0x40000000)
+   #define RBF_COEFFICIENT_SCALE                                  1000000
+   #define RBF_SAMPLE_SHIFT                                       6
+   #define RBF_EXTREME_SAMPLE                                     INT32_MIN
+   #define RBF_EXTREME_TAP                                        (INT32_MIN / RING_BUFFER_FIR_STATIC_MAX_TAPS)
+#elif defined(RING_BUFFER_FIR_STATIC_SAMPLE_FLOAT)
+   #define RBF_HALF                                               0.5f
+   #define RBF_COEFFICIENT_SCALE                                  1
+   #define RBF_SAMPLE_SHIFT                                       0
+   #define RBF_EXTREME_SAMPLE                                     (-1.0f)
+   #define RBF_EXTREME_TAP                                        (-1.0f)
+#else
+   #define RBF_HALF                                               ((Ring_Buffer_FIR_Static_Sample)0x4000)
+   #define RBF_COEFFICIENT_SCALE                                  100
+   #define RBF_SAMPLE_SHIFT                                       0
+   #define RBF_EXTREME_SAMPLE                                     INT16_MIN
+   #define RBF_EXTREME_TAP                                        INT16_MIN
+#endif
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------- GUARD REGIONS ---------------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+static Test_Guard RBF_Instances_Guard;
+static Test_Guard RBF_Instances_In_Use_Guard;
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*----------------------------------------------------------- HELPERS -----------------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief The Handles the tests construct, destroyed in tearDown() whatever happened.
+ */
+static Ring_Buffer_FIR_Static_Handle RBF_Handles[NUMBER_OF_STATIC_FIR_RING_BUFFERS + 1];
+
+
+/**
+ * @brief Coefficients, input and output of the filter under test.
+ */
+static Ring_Buffer_FIR_Static_Sample RBF_Coefficients[RING_BUFFER_FIR_STATIC_MAX_TAPS];
+static Ring_Buffer_FIR_Static_Sample RBF_Input[RBF_TEST_SAMPLES];
+static Ring_Buffer_FIR_Static_Sample RBF_Output[RBF_TEST_SAMPLES];
+
+
+/**
+ * @brief State of the pseudo-random generator. Reset in setUp() so every run filters the same samples.
+ */
+static uint32_t RBF_Random_State;
+
+
+/**
+ * @brief Next pseudo-random 32 bits.
+ */
+static uint32_t RBF_Random(void);
+static uint32_t RBF_Random(void)
+{
+   RBF_Random_State ^= RBF_Random_State << 13;
+   RBF_Random_State ^= RBF_Random_State >> 17;
+   RBF_Random_State ^= RBF_Random_State << 5;
+
+   return RBF_Random_State;
+}
+
+
+/**
+ * @brief A pseudo-random sample or coefficient over the whole range of the type (-1 to 1 for float), shifted right
+ * by @p shift.
+ */
+static Ring_Buffer_FIR_Static_Sample RBF_Random_Sample(uint32_t shift);
+static Ring_Buffer_FIR_Static_Sample RBF_Random_Sample(uint32_t shift)
+{
+#if defined(RING_BUFFER_FIR_STATIC_SAMPLE_Q31)
+   return (Ring_Buffer_FIR_Static_Sample)((int32_t)RBF_Random() >> shift);
+#elif defined(RING_BUFFER_FIR_STATIC_SAMPLE_FLOAT)
+   (void)shift;
+   return (float)(int32_t)RBF_Random() / 2147483648.0f;
+#else
+   return (Ring_Buffer_FIR_Static_Sample)((int16_t)(RBF_Random() >> 16) >> shift);
+#endif
+}
+
+
+/**
+ * @brief Output @p n of a direct convolution of RBF_Input[] with the first @p taps RBF_Coefficients[], computed the
+ * way ring_buffer_fir_static.h specifies. For float, @p magnitude is set to the sum of the magnitudes of the products
+ * to scale the tolerance with.
+ */
+static Ring_Buffer_FIR_Static_Sample RBF_Direct(uint32_t taps, uint32_t n, double * magnitude);
+static Ring_Buffer_FIR_Static_Sample RBF_Direct(uint32_t taps, uint32_t n, double * magnitude)
+{
+#if defined(RING_BUFFER_FIR_STATIC_SAMPLE_FLOAT)
+   double acc = 0.0;
+
+   *magnitude = 0.0;
+
+   for (uint32_t k = 0; (k < taps) && (k <= n); k++)
+   {
+      acc += (double)RBF_Coefficients[k] * (double)RBF_Input[n - k];
+      *magnitude += fabs((double)RBF_Coefficients[k] * (double)RBF_Input[n - k]);
+   }
+
+   return (Ring_Buffer_FIR_Static_Sample)acc;
+#else
+   int64_t acc = 0;
+
+   *magnitude = 0.0;
+
+   for (uint32_t k = 0; (k < taps) && (k <= n); k++)
+   {
+      acc += (int64_t)RBF_Coefficients[k] * (int64_t)RBF_Input[n - k];
+   }
+
+   #if defined(RING_BUFFER_FIR_STATIC_SAMPLE_Q31)
+      acc >>= 31;
+      return (Ring_Buffer_FIR_Static_Sample)((acc < INT32_MIN) ? INT32_MIN : ((acc > INT32_MAX) ? INT32_MAX : acc));
+   #else
+      acc >>= 15;
+      return (Ring_Buffer_FIR_Static_Sample)((acc < INT16_MIN) ? INT16_MIN : ((acc > INT16_MAX) ? INT16_MAX : acc));
+   #endif
+#endif
+}
+
+
+/**
+ * @brief Checks RBF_Output[] against the direct convolution. Exact for Q15 and Q31.
+ */
+static void RBF_Expect_Direct(uint32_t taps, const char * what);
+static void RBF_Expect_Direct(uint32_t taps, const char * what)
+{
+   char message[96];
+
+   for (uint32_t n = 0; n < RBF_TEST_SAMPLES; n++)
+   {
+      double magnitude;
+      const Ring_Buffer_FIR_Static_Sample expected = RBF_Direct(taps, n, &magnitude);
+
+      (void)snprintf(message, sizeof(message), "%s: %lu taps, output %lu", what, (unsigned long)taps, (unsigned long)n);
+#if defined(RING_BUFFER_FIR_STATIC_SAMPLE_FLOAT)
+      TEST_ASSERT_TRUE_MESSAGE(fabs((double)expected - (double)RBF_Output[n]) <= (1e-5 * magnitude) + 1e-6, message);
+#else
+      TEST_ASSERT_EQUAL_INT32_MESSAGE((int32_t)expected, (int32_t)RBF_Output[n], message);
+#endif
+   }
+}
+
+
+/**
+ * @brief Streams RBF_Input[] through RBF_Handles[0] in blocks of 1, 2, 3, ... samples. Writes RBF_Output[], or
+ * RBF_Input[] itself when @p in_place (RBF_Output[] then receives a copy).
+ */
+static void RBF_Stream(bool in_place);
+static void RBF_Stream(bool in_place)
+{
+   static Ring_Buffer_FIR_Static_Sample samples[RBF_TEST_SAMPLES];
+   uint32_t block = 1;
+
+   memcpy((void *)samples, (const void *)RBF_Input, sizeof(samples));
+
+   for (uint32_t n = 0; n < RBF_TEST_SAMPLES; n += block, block++)
+   {
+      const uint32_t count = ((n + block) <= RBF_TEST_SAMPLES) ? block : (RBF_TEST_SAMPLES - n);
+
+      TEST_ASSERT_TRUE(Ring_Buffer_FIR_Static_Process(&RBF_Handles[0], &samples[n], (in_place) ? &samples[n] : &RBF_Output[n], count));
+   }
+
+   if (in_place)
+   {
+      memcpy((void *)RBF_Output, (const void *)samples, sizeof(samples));
+   }
+}
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------- RUNS AT THE START AND END OF EACH TEST --------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+void setUp(void)
+{
+   Test_Guard_Init(&RBF_Instances_Guard, "RBF_Instances[]", &Test_RBF_Instances_Memory_Region[0], Test_RBF_Instances_Mem_Size,
+                   CLASS_POOL_MEMORY_EXTENSION_BYTES, RBF_INSTANCES_PREPOSTPEND_VALUES);
+   Test_Guard_Init(&RBF_Instances_In_Use_Guard, "RBF_Instances_In_Use[]", &Test_RBF_Instances_In_Use_Memory_Region[0], Test_RBF_Instances_In_Use_Mem_Size,
+                   CLASS_POOL_IN_USE_MEMORY_EXTENSION_BYTES, RBF_INSTANCES_IN_USE_PREPOSTPEND_VALUES);
+   Test_Guard_Arm(&RBF_Instances_Guard);
+   Test_Guard_Arm(&RBF_Instances_In_Use_Guard);
+
+   memset((void *)RBF_Handles, 0, sizeof(RBF_Handles));
+   memset((void *)RBF_Coefficients, 0, sizeof(RBF_Coefficients));
+   memset((void *)RBF_Input, 0, sizeof(RBF_Input));
+   memset((void *)RBF_Output, 0, sizeof(RBF_Output));
+   RBF_Random_State = 2463534242u;
+}
+
+void tearDown(void)
+{
+   for (uint32_t i = 0; i < (NUMBER_OF_STATIC_FIR_RING_BUFFERS + 1); i++)
+   {
+      (void)Ring_Buffer_FIR_Static_Destroy(&RBF_Handles[i]);
+   }
+
+   Test_Guard_Release(&RBF_Instances_Guard);
+   Test_Guard_Release(&RBF_Instances_In_Use_Guard);
+   memset((void *)&Test_RBF_Instances_Memory_Region[0], 0, Test_RBF_Instances_Mem_Size);
+   memset((void *)&Test_RBF_Instances_In_Use_Memory_Region[0], 0, Test_RBF_Instances_In_Use_Mem_Size);
+}
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------------------- UNIT TESTS BEGIN -----------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief The Constructor refuses invalid arguments, Handles already constructed and requests once the pool is used up.
+ */
+static void Test_Ring_Buffer_FIR_Static_Ctor_Destroy(void);
+static void Test_Ring_Buffer_FIR_Static_Ctor_Destroy(void)
+{
+   TEST_ASSERT_FALSE(Ring_Buffer_FIR_Static_Ctor(NULL, RBF_Coefficients, 1));
+   TEST_ASSERT_FALSE(Ring_Buffer_FIR_Static_Ctor(&RBF_Handles[0], NULL, 1));
+   TEST_ASSERT_FALSE(Ring_Buffer_FIR_Static_Ctor(&RBF_Handles[0], RBF_Coefficients, 0));
+   TEST_ASSERT_FALSE(Ring_Buffer_FIR_Static_Ctor(&RBF_Handles[0], RBF_Coefficients, RING_BUFFER_FIR_STATIC_MAX_TAPS + 1));
+   TEST_ASSERT_FALSE(Ring_Buffer_FIR_Static_Destroy(&RBF_Handles[0]));
+
+   for (uint32_t i = 0; i < NUMBER_OF_STATIC_FIR_RING_BUFFERS; i++)
+   {
+      TEST_ASSERT_TRUE(Ring_Buffer_FIR_Static_Ctor(&RBF_Handles[i], RBF_Coefficients, RING_BUFFER_FIR_STATIC_MAX_TAPS));
+      TEST_ASSERT_FALSE(Ring_Buffer_FIR_Static_Ctor(&RBF_Handles[i], RBF_Coefficients, 1));
+   }
+
+   TEST_ASSERT_FALSE(Ring_Buffer_FIR_Static_Ctor(&RBF_Handles[NUMBER_OF_STATIC_FIR_RING_BUFFERS], RBF_Coefficients, 1));
+   TEST_ASSERT_TRUE(Ring_Buffer_FIR_Static_Destroy(&RBF_Handles[0]));
+   TEST_ASSERT_FALSE(Ring_Buffer_FIR_Static_Destroy(&RBF_Handles[0]));
+   TEST_ASSERT_TRUE(Ring_Buffer_FIR_Static_Ctor(&RBF_Handles[NUMBER_OF_STATIC_FIR_RING_BUFFERS], RBF_Coefficients, 1));
+
+   TEST_ASSERT_GUARD_INTACT(&RBF_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RBF_Instances_In_Use_Guard);
+}
+
+
+/**
+ * @brief Invalid Handles and NULL buffers are refused. Processing 0 samples succeeds and does nothing.
+ */
+static void Test_Ring_Buffer_FIR_Static_Invalid_Arguments(void);
+static void Test_Ring_Buffer_FIR_Static_Invalid_Arguments(void)
+{
+   TEST_ASSERT_TRUE(Ring_Buffer_FIR_Static_Ctor(&RBF_Handles[0], RBF_Coefficients, 4));
+
+   TEST_ASSERT_FALSE(Ring_Buffer_FIR_Static_Process(NULL, RBF_Input, RBF_Output, 1));
+   TEST_ASSERT_FALSE(Ring_Buffer_FIR_Static_Process(&RBF_Handles[1], RBF_Input, RBF_Output, 1));
+   TEST_ASSERT_FALSE(Ring_Buffer_FIR_Static_Process(&RBF_Handles[0], NULL, RBF_Output, 1));
+   TEST_ASSERT_FALSE(Ring_Buffer_FIR_Static_Process(&RBF_Handles[0], RBF_Input, NULL, 1));
+   TEST_ASSERT_FALSE(Ring_Buffer_FIR_Static_Clear(&RBF_Handles[1]));
+   TEST_ASSERT_TRUE(Ring_Buffer_FIR_Static_Process(&RBF_Handles[0], RBF_Input, RBF_Output, 0));
+   TEST_ASSERT_TRUE(Ring_Buffer_FIR_Static_Clear(&RBF_Handles[0]));
+
+   TEST_ASSERT_GUARD_INTACT(&RBF_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RBF_Instances_In_Use_Guard);
+}
+
+
+/**
+ * @brief An impulse of 0.5 brings out half of every coefficient, newest first, then the filter returns to 0. Clear
+ * forgets the impulse.
+ */
+static void Test_Ring_Buffer_FIR_Static_Impulse_Response(void);
+static void Test_Ring_Buffer_FIR_Static_Impulse_Response(void)
+{
+   const uint32_t taps = 11;
+
+   for (uint32_t k = 0; k < taps; k++)
+   {
+      RBF_Coefficients[k] = (Ring_Buffer_FIR_Static_Sample)(((k % 2) ? -2 : 2) * (int32_t)(k + 1) * RBF_COEFFICIENT_SCALE);
+   }
+
+   TEST_ASSERT_TRUE(Ring_Buffer_FIR_Static_Ctor(&RBF_Handles[0], RBF_Coefficients, taps));
+
+   for (uint32_t pass = 0; pass < 2; pass++)
+   {
+      RBF_Input[0] = RBF_HALF;
+      TEST_ASSERT_TRUE(Ring_Buffer_FIR_Static_Process(&RBF_Handles[0], RBF_Input, RBF_Output, 2 * taps));
+
+      for (uint32_t n = 0; n < (2 * taps); n++)
+      {
+         const int32_t expected = (n < taps) ? ((int32_t)RBF_Coefficients[n] / 2) : 0;
+         TEST_ASSERT_EQUAL_INT32(expected, (int32_t)RBF_Output[n]);
+      }
+
+      /* Leave something in the history for Clear to forget. */
+      TEST_ASSERT_TRUE(Ring_Buffer_FIR_Static_Process(&RBF_Handles[0], RBF_Input, RBF_Output, 3));
+      TEST_ASSERT_TRUE(Ring_Buffer_FIR_Static_Clear(&RBF_Handles[0]));
+   }
+
+   TEST_ASSERT_GUARD_INTACT(&RBF_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RBF_Instances_In_Use_Guard);
+}
+
+
+/**
+ * @brief Streaming random samples in blocks of growing size matches a direct convolution of the whole input, out of
+ * and in place, for tap counts below, at and above every vector width.
+ */
+static void Test_Ring_Buffer_FIR_Static_Matches_Direct_Convolution(void);
+static void Test_Ring_Buffer_FIR_Static_Matches_Direct_Convolution(void)
+{
+   const uint32_t tap_counts[] = { 1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 47, RING_BUFFER_FIR_STATIC_MAX_TAPS - 1, RING_BUFFER_FIR_STATIC_MAX_TAPS };
+
+   for (uint32_t t = 0; t < (sizeof(tap_counts) / sizeof(tap_counts[0])); t++)
+   {
+      const uint32_t taps = tap_counts[t];
+
+      for (uint32_t k = 0; k < taps; k++)
+      {
+         RBF_Coefficients[k] = RBF_Random_Sample(0);
+      }
+
+      for (uint32_t n = 0; n < RBF_TEST_SAMPLES; n++)
+      {
+         RBF_Input[n] = RBF_Random_Sample(RBF_SAMPLE_SHIFT);
+      }
+
+      TEST_ASSERT_TRUE(Ring_Buffer_FIR_Static_Ctor(&RBF_Handles[0], RBF_Coefficients, taps));
+      RBF_Stream(false);
+      RBF_Expect_Direct(taps, "Out of place");
+
+      TEST_ASSERT_TRUE(Ring_Buffer_FIR_Static_Clear(&RBF_Handles[0]));
+      RBF_Stream(true);
+      RBF_Expect_Direct(taps, "In place");
+
+      TEST_ASSERT_TRUE(Ring_Buffer_FIR_Static_Destroy(&RBF_Handles[0]));
+   }
+
+   TEST_ASSERT_GUARD_INTACT(&RBF_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RBF_Instances_In_Use_Guard);
+}
+
+
+/**
+ * @brief The most negative samples and coefficients. The Q15 and Q31 outputs saturate. For Q15, pairs of
+ * -32768 * -32768 sum to 2^31, one more than an int32_t holds.
+ */
+static void Test_Ring_Buffer_FIR_Static_Extreme_Samples(void);
+static void Test_Ring_Buffer_FIR_Static_Extreme_Samples(void)
+{
+   for (uint32_t k = 0; k < RING_BUFFER_FIR_STATIC_MAX_TAPS; k++)
+   {
+      RBF_Coefficients[k] = RBF_EXTREME_TAP;
+   }
+
+   for (uint32_t n = 0; n < RBF_TEST_SAMPLES; n++)
+   {
+      RBF_Input[n] = RBF_EXTREME_SAMPLE;
+   }
+
+   TEST_ASSERT_TRUE(Ring_Buffer_FIR_Static_Ctor(&RBF_Handles[0], RBF_Coefficients, RING_BUFFER_FIR_STATIC_MAX_TAPS));
+   RBF_Stream(false);
+   RBF_Expect_Direct(RING_BUFFER_FIR_STATIC_MAX_TAPS, "Extreme");
+
+#if defined(RING_BUFFER_FIR_STATIC_SAMPLE_Q31)
+   TEST_ASSERT_EQUAL_INT32(INT32_MAX, RBF_Output[RBF_TEST_SAMPLES - 1]);
+#elif !defined(RING_BUFFER_FIR_STATIC_SAMPLE_FLOAT)
+   TEST_ASSERT_EQUAL_INT16(INT16_MAX, RBF_Output[RBF_TEST_SAMPLES - 1]);
+#endif
+
+   TEST_ASSERT_GUARD_INTACT(&RBF_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RBF_Instances_In_Use_Guard);
+}
+
+
+
+
+int main(void)
+{
+   UNITY_BEGIN();
+   RUN_TEST(Test_Ring_Buffer_FIR_Static_Ctor_Destroy);
+   RUN_TEST(Test_Ring_Buffer_FIR_Static_Invalid_Arguments);
+   RUN_TEST(Test_Ring_Buffer_FIR_Static_Impulse_Response);
+   RUN_TEST(Test_Ring_Buffer_FIR_Static_Matches_Direct_Convolution);
+   RUN_TEST(Test_Ring_Buffer_FIR_Static_Extreme_Samples);
+   return UNITY_END();
+}
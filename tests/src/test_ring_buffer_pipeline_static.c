@@ -0,0 +1,547 @@
+/**
+ * @file test_ring_buffer_pipeline_static.c
+ * @author agent
+ * @brief Unit Tests for the Pipeline Ring Buffer module (ring_buffer_pipeline_static.h). Covers the Handle, the
+ * order in which Claim, Publish, Acquire and Release hand a slot from the producer through every Stage and back, the
+ * work of every Stage being done in place, and a producer thread with one thread per Stage that is meant to run
+ * under the tsan profile:
+ * cd tests && make clean && make test PROFILE=tsan
+ *
+ * RBP_THREADS_ITEMS=<count> overrides the number of items the producer thread publishes.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#define _POSIX_C_SOURCE 200809L     /* pthread, sched_yield */
+
+/* STD-C Libraries */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>      /* snprintf */
+#include <stdlib.h>     /* getenv, strtoull */
+#include <string.h>     /* memset, size_t */
+
+/* POSIX */
+#include <pthread.h>
+#include <sched.h>      /* sched_yield */
+
+/* Unit Test Framework */
+#include "unity.h"
+
+/* Unit Test Support */
+#include "test_guard.h"
+
+/* Module Under Test */
+#include "ring_buffer_pipeline_static.h"
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------- UNIT TEST SETUP VALUES ------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Guard Region patterns. Same meaning as RB_INSTANCES_PREPOSTPEND_VALUES and
+ * RB_INSTANCES_IN_USE_PREPOSTPEND_VALUES in test_ring_buffer_static.c.
+ */
+#define RBP_INSTANCES_PREPOSTPEND_VALUES                          0x37
+#define RBP_INSTANCES_IN_USE_PREPOSTPEND_VALUES                   0x48
+
+
+/**
+ * @brief Number of elements of the Pipeline Ring Buffer the tests use. Small, so positions wrap often.
+ */
+#define RBP_TEST_LENGTH                                           4u
+
+
+/**
+ * @brief Number of items the producer thread publishes when RBP_THREADS_ITEMS is not set.
+ */
+#define RBP_THREADS_DEFAULT_ITEMS                                 20000ULL
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------- GUARD REGIONS ---------------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+static Test_Guard RBP_Instances_Guard;
+static Test_Guard RBP_Instances_In_Use_Guard;
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*----------------------------------------------------------- HELPERS -----------------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief The element passed through the Pipeline. Every Stage records itself in it in place.
+ */
+typedef struct
+{
+   uint32_t sequence;                              /* Written by the producer. */
+   uint32_t stamps;                                /* Each Stage shifts in its number + 1. */
+} RBP_Item_t;
+
+
+/**
+ * @brief The Handles the tests construct, destroyed in tearDown() whatever happened.
+ */
+static Ring_Buffer_Pipeline_Static_Handle RBP_Handles[NUMBER_OF_STATIC_PIPELINE_RING_BUFFERS + 1];
+
+
+/**
+ * @brief A Stage thread. Written by the thread only and read by the test after pthread_join().
+ */
+typedef struct
+{
+   const Ring_Buffer_Pipeline_Static_Handle * me;
+   uint32_t stage;
+   uint64_t items;
+   uint64_t mismatches;
+   int * start;                                    /* __atomic */
+} RBP_Threads_Stage_t;
+
+
+/**
+ * @brief The stamps of an item after Stages 0 to @p stages - 1 worked on it.
+ */
+static uint32_t RBP_Stamps(uint32_t stages);
+static uint32_t RBP_Stamps(uint32_t stages)
+{
+   uint32_t stamps = 0;
+
+   for (uint32_t s = 0; s < stages; s++)
+   {
+      stamps = (stamps << 4) | (s + 1u);
+   }
+
+   return stamps;
+}
+
+
+/**
+ * @brief Acquires the next item of a Stage, checks which item it is and what the earlier Stages did to it, stamps it
+ * and releases it.
+ */
+static void RBP_Expect_Stage(uint32_t stage, uint32_t sequence);
+static void RBP_Expect_Stage(uint32_t stage, uint32_t sequence)
+{
+   void * slot = NULL;
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Pipeline_Static_Acquire(&RBP_Handles[0], stage, &slot));
+
+   RBP_Item_t * item = (RBP_Item_t *)slot;
+   TEST_ASSERT_EQUAL_UINT32(sequence, item->sequence);
+   TEST_ASSERT_EQUAL_HEX32(RBP_Stamps(stage), item->stamps);
+   item->stamps = (item->stamps << 4) | (stage + 1u);
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Pipeline_Static_Release(&RBP_Handles[0], stage));
+}
+
+
+/**
+ * @brief Publishes item @p sequence with Claim and Publish.
+ */
+static void RBP_Publish(uint32_t sequence);
+static void RBP_Publish(uint32_t sequence)
+{
+   void * slot = NULL;
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Pipeline_Static_Claim(&RBP_Handles[0], &slot));
+   ((RBP_Item_t *)slot)->sequence = sequence;
+   ((RBP_Item_t *)slot)->stamps = 0;
+   TEST_ASSERT_TRUE(Ring_Buffer_Pipeline_Static_Publish(&RBP_Handles[0]));
+}
+
+
+/**
+ * @brief Number of items the producer thread publishes. RBP_THREADS_ITEMS overrides RBP_THREADS_DEFAULT_ITEMS.
+ */
+static uint64_t RBP_Threads_Items(void);
+static uint64_t RBP_Threads_Items(void)
+{
+   const char * text = getenv("RBP_THREADS_ITEMS");
+   uint64_t items = RBP_THREADS_DEFAULT_ITEMS;
+
+   if ((text) && (*text))
+   {
+      items = (uint64_t)strtoull(text, NULL, 0);
+   }
+
+   return items;
+}
+
+
+/**
+ * @brief Spins until the test sets start. Yields so this also works when there are fewer CPUs than threads.
+ */
+static void RBP_Threads_Wait_For_Start(int * start);
+static void RBP_Threads_Wait_For_Start(int * start)
+{
+   while (!__atomic_load_n(start, __ATOMIC_ACQUIRE))
+   {
+      (void)sched_yield();
+   }
+}
+
+
+/**
+ * @brief One Stage. Works on every item in place and checks the items arrive in order with the stamps of every
+ * earlier Stage.
+ */
+static void * RBP_Threads_Stage(void * arg);
+static void * RBP_Threads_Stage(void * arg)
+{
+   RBP_Threads_Stage_t * self = (RBP_Threads_Stage_t *)arg;
+   const uint32_t expected_stamps = RBP_Stamps(self->stage);
+   uint64_t processed = 0;
+
+   RBP_Threads_Wait_For_Start(self->start);
+
+   while (processed < self->items)
+   {
+      void * slot = NULL;
+
+      if (Ring_Buffer_Pipeline_Static_Acquire(self->me, self->stage, &slot))
+      {
+         RBP_Item_t * item = (RBP_Item_t *)slot;
+
+         self->mismatches += ((item->sequence != (uint32_t)processed) || (item->stamps != expected_stamps));
+         item->stamps = (item->stamps << 4) | (self->stage + 1u);
+         (void)Ring_Buffer_Pipeline_Static_Release(self->me, self->stage);
+         processed++;
+      }
+      else
+      {
+         (void)sched_yield();
+      }
+   }
+
+   return NULL;
+}
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------- RUNS AT THE START AND END OF EACH TEST --------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+void setUp(void)
+{
+   Test_Guard_Init(&RBP_Instances_Guard, "RBP_Instances[]", &Test_RBP_Instances_Memory_Region[0], Test_RBP_Instances_Mem_Size,
+                   CLASS_POOL_MEMORY_EXTENSION_BYTES, RBP_INSTANCES_PREPOSTPEND_VALUES);
+   Test_Guard_Init(&RBP_Instances_In_Use_Guard, "RBP_Instances_In_Use[]", &Test_RBP_Instances_In_Use_Memory_Region[0], Test_RBP_Instances_In_Use_Mem_Size,
+                   CLASS_POOL_IN_USE_MEMORY_EXTENSION_BYTES, RBP_INSTANCES_IN_USE_PREPOSTPEND_VALUES);
+   Test_Guard_Arm(&RBP_Instances_Guard);
+   Test_Guard_Arm(&RBP_Instances_In_Use_Guard);
+
+   memset((void *)RBP_Handles, 0, sizeof(RBP_Handles));
+}
+
+void tearDown(void)
+{
+   for (uint32_t i = 0; i < (NUMBER_OF_STATIC_PIPELINE_RING_BUFFERS + 1); i++)
+   {
+      (void)Ring_Buffer_Pipeline_Static_Destroy(&RBP_Handles[i]);
+   }
+
+   Test_Guard_Release(&RBP_Instances_Guard);
+   Test_Guard_Release(&RBP_Instances_In_Use_Guard);
+   memset((void *)&Test_RBP_Instances_Memory_Region[0], 0, Test_RBP_Instances_Mem_Size);
+   memset((void *)&Test_RBP_Instances_In_Use_Memory_Region[0], 0, Test_RBP_Instances_In_Use_Mem_Size);
+}
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------------------- UNIT TESTS BEGIN -----------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief The Constructor refuses invalid arguments, including 0 or too many Stages, Handles already constructed and
+ * requests once the pool is used up.
+ */
+static void Test_Ring_Buffer_Pipeline_Static_Ctor_Destroy(void);
+static void Test_Ring_Buffer_Pipeline_Static_Ctor_Destroy(void)
+{
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Ctor(NULL, 1, 1, 1));
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Ctor(&RBP_Handles[0], 0, 1, 1));
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Ctor(&RBP_Handles[0], 1, 0, 1));
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Ctor(&RBP_Handles[0], 1, RING_BUFFER_PIPELINE_STATIC_SIZE + 1, 1));
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Ctor(&RBP_Handles[0], 1, 1, 0));
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Ctor(&RBP_Handles[0], 1, 1, RING_BUFFER_PIPELINE_STATIC_MAX_STAGES + 1));
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Destroy(&RBP_Handles[0]));
+
+   for (uint32_t i = 0; i < NUMBER_OF_STATIC_PIPELINE_RING_BUFFERS; i++)
+   {
+      TEST_ASSERT_TRUE(Ring_Buffer_Pipeline_Static_Ctor(&RBP_Handles[i], 1, RING_BUFFER_PIPELINE_STATIC_SIZE, RING_BUFFER_PIPELINE_STATIC_MAX_STAGES));
+      TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Ctor(&RBP_Handles[i], 1, 1, 1));
+   }
+
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Ctor(&RBP_Handles[NUMBER_OF_STATIC_PIPELINE_RING_BUFFERS], 1, 1, 1));
+   TEST_ASSERT_TRUE(Ring_Buffer_Pipeline_Static_Destroy(&RBP_Handles[0]));
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Destroy(&RBP_Handles[0]));
+   TEST_ASSERT_TRUE(Ring_Buffer_Pipeline_Static_Is_Full(&RBP_Handles[0]));
+   TEST_ASSERT_TRUE(Ring_Buffer_Pipeline_Static_Ctor(&RBP_Handles[NUMBER_OF_STATIC_PIPELINE_RING_BUFFERS], 1, 1, 1));
+
+   TEST_ASSERT_GUARD_INTACT(&RBP_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RBP_Instances_In_Use_Guard);
+}
+
+
+/**
+ * @brief A Stage only sees what the Stage before it released, and the producer only reuses what the last Stage
+ * released. Every Stage works on the same slot in place.
+ */
+static void Test_Ring_Buffer_Pipeline_Static_Sequence_Barriers(void);
+static void Test_Ring_Buffer_Pipeline_Static_Sequence_Barriers(void)
+{
+   void * slot = NULL;
+   void * published = NULL;
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Pipeline_Static_Ctor(&RBP_Handles[0], sizeof(RBP_Item_t), RBP_TEST_LENGTH, 3));
+
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Acquire(&RBP_Handles[0], 0, &slot));
+   TEST_ASSERT_TRUE(Ring_Buffer_Pipeline_Static_Claim(&RBP_Handles[0], &published));
+
+   /* Claimed is not published. */
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Acquire(&RBP_Handles[0], 0, &slot));
+   ((RBP_Item_t *)published)->sequence = 0;
+   ((RBP_Item_t *)published)->stamps = 0;
+   TEST_ASSERT_TRUE(Ring_Buffer_Pipeline_Static_Publish(&RBP_Handles[0]));
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Publish(&RBP_Handles[0]));
+
+   /* Stage 1 waits for Stage 0. Acquired is not released. */
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Acquire(&RBP_Handles[0], 1, &slot));
+   TEST_ASSERT_TRUE(Ring_Buffer_Pipeline_Static_Acquire(&RBP_Handles[0], 0, &slot));
+   TEST_ASSERT_EQUAL_PTR(published, slot);
+   TEST_ASSERT_TRUE(Ring_Buffer_Pipeline_Static_Acquire(&RBP_Handles[0], 0, &slot));
+   TEST_ASSERT_EQUAL_PTR(published, slot);
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Acquire(&RBP_Handles[0], 1, &slot));
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Release(&RBP_Handles[0], 1));
+   ((RBP_Item_t *)slot)->stamps = RBP_Stamps(1);
+   TEST_ASSERT_TRUE(Ring_Buffer_Pipeline_Static_Release(&RBP_Handles[0], 0));
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Release(&RBP_Handles[0], 0));
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Acquire(&RBP_Handles[0], 0, &slot));
+
+   RBP_Expect_Stage(1, 0);
+   TEST_ASSERT_EQUAL_UINT32(1, Ring_Buffer_Pipeline_Static_Get_Number_Of_Elements(&RBP_Handles[0], 2));
+
+   /* Fill the Pipeline. The last Stage holds back the producer even when the others are done. */
+   for (uint32_t i = 1; i < RBP_TEST_LENGTH; i++)
+   {
+      RBP_Publish(i);
+      RBP_Expect_Stage(0, i);
+      RBP_Expect_Stage(1, i);
+   }
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Pipeline_Static_Is_Full(&RBP_Handles[0]));
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Claim(&RBP_Handles[0], &slot));
+   TEST_ASSERT_EQUAL_UINT32(RBP_TEST_LENGTH, Ring_Buffer_Pipeline_Static_Get_Number_Of_Elements(&RBP_Handles[0], 2));
+   TEST_ASSERT_EQUAL_UINT32(0, Ring_Buffer_Pipeline_Static_Get_Number_Of_Elements(&RBP_Handles[0], 1));
+
+   RBP_Expect_Stage(2, 0);
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Is_Full(&RBP_Handles[0]));
+   TEST_ASSERT_TRUE(Ring_Buffer_Pipeline_Static_Claim(&RBP_Handles[0], &slot));
+   TEST_ASSERT_EQUAL_PTR(published, slot);
+
+   TEST_ASSERT_GUARD_INTACT(&RBP_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RBP_Instances_In_Use_Guard);
+}
+
+
+/**
+ * @brief Items published with Claim and Publish and with Write pass through every Stage in order, each Stage seeing
+ * the work of the ones before it, while the positions wrap many times. Stages run in bursts of different sizes.
+ */
+static void Test_Ring_Buffer_Pipeline_Static_Items_Pass_Every_Stage_In_Order(void);
+static void Test_Ring_Buffer_Pipeline_Static_Items_Pass_Every_Stage_In_Order(void)
+{
+   const uint32_t stages = RING_BUFFER_PIPELINE_STATIC_MAX_STAGES;
+   const uint32_t items = 25u * RBP_TEST_LENGTH;
+   uint32_t next[RING_BUFFER_PIPELINE_STATIC_MAX_STAGES + 1];
+
+   memset((void *)next, 0, sizeof(next));
+   TEST_ASSERT_TRUE(Ring_Buffer_Pipeline_Static_Ctor(&RBP_Handles[0], sizeof(RBP_Item_t), RBP_TEST_LENGTH, stages));
+
+   while (next[stages] < items)
+   {
+      /* next[0] is the producer. The others advance by up to s + 1 items each round. */
+      if ((next[0] < items) && !Ring_Buffer_Pipeline_Static_Is_Full(&RBP_Handles[0]))
+      {
+         if (next[0] % 2)
+         {
+            const RBP_Item_t item = { next[0], 0 };
+            TEST_ASSERT_TRUE(Ring_Buffer_Pipeline_Static_Write(&RBP_Handles[0], &item, sizeof(item)));
+         }
+         else
+         {
+            RBP_Publish(next[0]);
+         }
+
+         next[0]++;
+      }
+
+      for (uint32_t s = 0; s < stages; s++)
+      {
+         for (uint32_t burst = 0; (burst <= s) && (Ring_Buffer_Pipeline_Static_Get_Number_Of_Elements(&RBP_Handles[0], s)); burst++)
+         {
+            RBP_Expect_Stage(s, next[s + 1]++);
+         }
+      }
+   }
+
+   TEST_ASSERT_EQUAL_UINT32(items, next[0]);
+
+   for (uint32_t s = 0; s < stages; s++)
+   {
+      TEST_ASSERT_EQUAL_UINT32(0, Ring_Buffer_Pipeline_Static_Get_Number_Of_Elements(&RBP_Handles[0], s));
+   }
+
+   TEST_ASSERT_GUARD_INTACT(&RBP_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RBP_Instances_In_Use_Guard);
+}
+
+
+/**
+ * @brief Invalid Handles, Stages beyond number_of_stages_0, NULL slots and wrong data sizes are refused. Write
+ * refuses to overwrite a slot that is claimed.
+ */
+static void Test_Ring_Buffer_Pipeline_Static_Invalid_Arguments(void);
+static void Test_Ring_Buffer_Pipeline_Static_Invalid_Arguments(void)
+{
+   const RBP_Item_t item = { 9, 0 };
+   uint64_t wide = 0;
+   void * slot = NULL;
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Pipeline_Static_Ctor(&RBP_Handles[0], sizeof(RBP_Item_t), RBP_TEST_LENGTH, 2));
+
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Claim(NULL, &slot));
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Claim(&RBP_Handles[1], &slot));
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Claim(&RBP_Handles[0], NULL));
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Publish(&RBP_Handles[1]));
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Write(&RBP_Handles[0], NULL, sizeof(item)));
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Write(&RBP_Handles[0], &wide, sizeof(wide) + 1));
+   TEST_ASSERT_EQUAL_UINT32(0, Ring_Buffer_Pipeline_Static_Get_Number_Of_Elements(&RBP_Handles[0], 0));
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Pipeline_Static_Write(&RBP_Handles[0], &item, sizeof(item)));
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Acquire(&RBP_Handles[0], 2, &slot));
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Acquire(&RBP_Handles[0], 0, NULL));
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Acquire(&RBP_Handles[1], 0, &slot));
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Release(&RBP_Handles[0], 2));
+   TEST_ASSERT_EQUAL_UINT32(0, Ring_Buffer_Pipeline_Static_Get_Number_Of_Elements(&RBP_Handles[0], 2));
+   TEST_ASSERT_EQUAL_UINT32(1, Ring_Buffer_Pipeline_Static_Get_Number_Of_Elements(&RBP_Handles[0], 0));
+
+   /* A claimed slot is not overwritten by Write. */
+   TEST_ASSERT_TRUE(Ring_Buffer_Pipeline_Static_Claim(&RBP_Handles[0], &slot));
+   TEST_ASSERT_FALSE(Ring_Buffer_Pipeline_Static_Write(&RBP_Handles[0], &item, sizeof(item)));
+   TEST_ASSERT_EQUAL_UINT32(1, Ring_Buffer_Pipeline_Static_Get_Number_Of_Elements(&RBP_Handles[0], 0));
+
+   RBP_Expect_Stage(0, 9);
+
+   TEST_ASSERT_GUARD_INTACT(&RBP_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RBP_Instances_In_Use_Guard);
+}
+
+
+/**
+ * @brief Slot 0 is aligned to RING_BUFFER_PIPELINE_STATIC_CACHE_LINE, so elements can be used in place as structs.
+ */
+static void Test_Ring_Buffer_Pipeline_Static_Slot_Alignment(void);
+static void Test_Ring_Buffer_Pipeline_Static_Slot_Alignment(void)
+{
+   void * slot = NULL;
+
+   for (uint32_t i = 0; i < NUMBER_OF_STATIC_PIPELINE_RING_BUFFERS; i++)
+   {
+      TEST_ASSERT_TRUE(Ring_Buffer_Pipeline_Static_Ctor(&RBP_Handles[i], sizeof(uint64_t), RBP_TEST_LENGTH, 1));
+      TEST_ASSERT_TRUE(Ring_Buffer_Pipeline_Static_Claim(&RBP_Handles[i], &slot));
+      TEST_ASSERT_EQUAL_size_t(0, (size_t)(uintptr_t)slot % RING_BUFFER_PIPELINE_STATIC_CACHE_LINE);
+   }
+}
+
+
+/**
+ * @brief The producer and every Stage in their own thread, without locks, for 1 to
+ * RING_BUFFER_PIPELINE_STATIC_MAX_STAGES Stages. Every Stage must see every item once, in order, with the work of
+ * every Stage before it.
+ */
+static void Test_Ring_Buffer_Pipeline_Static_Threads(void);
+static void Test_Ring_Buffer_Pipeline_Static_Threads(void)
+{
+   pthread_t threads[RING_BUFFER_PIPELINE_STATIC_MAX_STAGES];
+   RBP_Threads_Stage_t stage_args[RING_BUFFER_PIPELINE_STATIC_MAX_STAGES];
+   const uint64_t items = RBP_Threads_Items();
+   char message[64];
+
+   for (uint32_t stages = 1; stages <= RING_BUFFER_PIPELINE_STATIC_MAX_STAGES; stages++)
+   {
+      int start = 0;
+
+      TEST_ASSERT_TRUE(Ring_Buffer_Pipeline_Static_Ctor(&RBP_Handles[0], sizeof(RBP_Item_t), RBP_TEST_LENGTH, stages));
+      memset((void *)stage_args, 0, sizeof(stage_args));
+
+      for (uint32_t s = 0; s < stages; s++)
+      {
+         stage_args[s].me = &RBP_Handles[0];
+         stage_args[s].stage = s;
+         stage_args[s].items = items;
+         stage_args[s].start = &start;
+         TEST_ASSERT_EQUAL_INT(0, pthread_create(&threads[s], NULL, RBP_Threads_Stage, &stage_args[s]));
+      }
+
+      __atomic_store_n(&start, 1, __ATOMIC_RELEASE);
+
+      /* This thread is the producer. */
+      for (uint64_t i = 0; i < items; i++)
+      {
+         void * slot = NULL;
+
+         while (!Ring_Buffer_Pipeline_Static_Claim(&RBP_Handles[0], &slot))
+         {
+            (void)sched_yield();
+         }
+
+         ((RBP_Item_t *)slot)->sequence = (uint32_t)i;
+         ((RBP_Item_t *)slot)->stamps = 0;
+         TEST_ASSERT_TRUE(Ring_Buffer_Pipeline_Static_Publish(&RBP_Handles[0]));
+      }
+
+      for (uint32_t s = 0; s < stages; s++)
+      {
+         TEST_ASSERT_EQUAL_INT(0, pthread_join(threads[s], NULL));
+      }
+
+      for (uint32_t s = 0; s < stages; s++)
+      {
+         (void)snprintf(message, sizeof(message), "Stage %u of %u", (unsigned)s, (unsigned)stages);
+         TEST_ASSERT_EQUAL_UINT64_MESSAGE(0, stage_args[s].mismatches, message);
+         TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, Ring_Buffer_Pipeline_Static_Get_Number_Of_Elements(&RBP_Handles[0], s), message);
+      }
+
+      TEST_ASSERT_TRUE(Ring_Buffer_Pipeline_Static_Destroy(&RBP_Handles[0]));
+   }
+
+   TEST_ASSERT_GUARD_INTACT(&RBP_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RBP_Instances_In_Use_Guard);
+}
+
+
+
+
+int main(void)
+{
+   UNITY_BEGIN();
+   RUN_TEST(Test_Ring_Buffer_Pipeline_Static_Ctor_Destroy);
+   RUN_TEST(Test_Ring_Buffer_Pipeline_Static_Sequence_Barriers);
+   RUN_TEST(Test_Ring_Buffer_Pipeline_Static_Items_Pass_Every_Stage_In_Order);
+   RUN_TEST(Test_Ring_Buffer_Pipeline_Static_Invalid_Arguments);
+   RUN_TEST(Test_Ring_Buffer_Pipeline_Static_Slot_Alignment);
+   RUN_TEST(Test_Ring_Buffer_Pipeline_Static_Threads);
+   return UNITY_END();
+}
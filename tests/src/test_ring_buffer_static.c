@@ -16,6 +16,7 @@
 /* STD-C Libraries */
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdio.h>      /* sprintf */
 #include <stdlib.h>     /* rand */
 #include <string.h>     /* memset, size_t */
 #include <time.h>       /* time */
@@ -23,6 +24,12 @@
 /* Unit Test Framework */
 #define UNITY_INCLUDE_PRINT_FORMATTED
 #include "unity.h"
+#if defined(UNITY_INCLUDE_BENCH)
+#include "unity_bench.h"
+#endif
+
+/* Unit Test Support */
+#include "test_guard.h"
 
 /* Module Under Test */
 #include "ring_buffer_static.h"
@@ -35,7 +42,7 @@
 
 /**
  * @brief Used to verify the Ring Buffer Module under test does not access out-of-bounds memory
- * when editing the pre-allocated Ring Buffer Objects. This is the value stored in the pre and 
+ * when editing the pre-allocated Ring Buffer Objects. This is the value RB_Instances_Guard stores in the pre and 
  * postpended bytes of Test_RB_Instances_Memory_Region[]. For example if this is 0x33 then 
  * Test_RB_Instances_Memory_Region[] would be: [0x33, 0x33,... RB_Instances[], 0x33,.. 0x33]
  * If out-of-bounds memory access occurred then some of the pre and postpended regions would be
@@ -46,7 +53,7 @@
 
 /**
  * @brief Used to verify the Ring Buffer Module under test does not access out-of-bounds memory
- * when editing the Ring Buffer status array. This is the value stored in the pre and postpended 
+ * when editing the Ring Buffer status array. This is the value RB_Instances_In_Use_Guard stores in the pre and postpended 
  * bytes of Test_RB_Instances_In_Use_Memory_Region[]. For example if this is 0x44 then 
  * Test_RB_Instances_In_Use_Memory_Region[] would be: [0x44, 0x44,... RB_Instances_In_Use[], 0x44,.. 0x44]
  * If out-of-bounds memory access occurred then some of the pre and postpended regions would be
@@ -89,6 +96,23 @@ static Test_Ring_Buffer_Static_Handle_t Test_Ring_Buffer_Handles[NUMBER_OF_STATI
 
 
 
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------- GUARD REGIONS ---------------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Guard Region around RB_Instances[], the pre-allocated Ring Buffer Objects. Armed in setUp().
+ */
+static Test_Guard RB_Instances_Guard;
+
+
+/**
+ * @brief Guard Region around RB_Instances_In_Use[], the Ring Buffer status array. Armed in setUp().
+ */
+static Test_Guard RB_Instances_In_Use_Guard;
+
+
+
 /*-------------------------------------------------------------------------------------------------------------------------------*/
 /*----------------------------------------------------------- HELPERS -----------------------------------------------------------*/
 /*-------------------------------------------------------------------------------------------------------------------------------*/
@@ -101,17 +125,8 @@ static Test_Ring_Buffer_Static_Handle_t Test_Ring_Buffer_Handles[NUMBER_OF_STATI
 static inline void Test_RB_Objects_Memory_Access(void);
 static inline void Test_RB_Objects_Memory_Access(void)
 {
-   TEST_ASSERT_EACH_EQUAL_UINT8_MESSAGE(RB_INSTANCES_PREPOSTPEND_VALUES, &Test_RB_Instances_Memory_Region[0], RB_INSTANCES_MEMORY_EXTENSION_BYTES,
-                                       "Wrote to out-of-range memory when updating RB_Instances[]!");
-
-   TEST_ASSERT_EACH_EQUAL_UINT8_MESSAGE(RB_INSTANCES_PREPOSTPEND_VALUES, ((&Test_RB_Instances_Memory_Region[0]) + (Test_RB_Instances_Mem_Size - RB_INSTANCES_MEMORY_EXTENSION_BYTES)),
-                                       RB_INSTANCES_MEMORY_EXTENSION_BYTES, "Wrote to out-of-range memory when updating RB_Instances[]!");
-
-   TEST_ASSERT_EACH_EQUAL_UINT8_MESSAGE(RB_INSTANCES_IN_USE_PREPOSTPEND_VALUES, &Test_RB_Instances_In_Use_Memory_Region[0], RB_INSTANCES_IN_USE_MEMORY_EXTENSION_BYTES,
-                                       "Wrote to out-of-range memory when updating RB_Instances_In_Use[]!");
-
-   TEST_ASSERT_EACH_EQUAL_UINT8_MESSAGE(RB_INSTANCES_IN_USE_PREPOSTPEND_VALUES, ((&Test_RB_Instances_In_Use_Memory_Region[0]) + (Test_RB_Instances_In_Use_Mem_Size - RB_INSTANCES_IN_USE_MEMORY_EXTENSION_BYTES)),
-                                       RB_INSTANCES_IN_USE_MEMORY_EXTENSION_BYTES, "Wrote to out-of-range memory when updating RB_Instances_In_Use[]!");
+   TEST_ASSERT_GUARD_INTACT(&RB_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RB_Instances_In_Use_Guard);
 }
 
 
@@ -122,22 +137,16 @@ static inline void Test_RB_Objects_Memory_Access(void)
 
 void setUp(void) 
 {
-   /* Prepend test Memory Region that holds Ring Buffers with known values to test out-of-bounds access. */
-   memset((void *)&Test_RB_Instances_Memory_Region[0], RB_INSTANCES_PREPOSTPEND_VALUES, RB_INSTANCES_MEMORY_EXTENSION_BYTES);
-   memset((void *)&Test_RB_Instances_In_Use_Memory_Region[0], RB_INSTANCES_IN_USE_PREPOSTPEND_VALUES, RB_INSTANCES_IN_USE_MEMORY_EXTENSION_BYTES);
-
    /**
-    * Postpend test Memory Region that holds Ring Buffers with known values to test out-of-bounds access.
+    * Pre and postpend the test Memory Regions that hold the Ring Buffers with known values to test out-of-bounds access.
     * We have to use mem size variables instead of sizeof because we are only given access to a pointer.
     */
-   for (uint32_t i = (Test_RB_Instances_Mem_Size - 1); i > (Test_RB_Instances_Mem_Size - RB_INSTANCES_MEMORY_EXTENSION_BYTES - 1); i--)
-   {
-      Test_RB_Instances_Memory_Region[i] = RB_INSTANCES_PREPOSTPEND_VALUES;
-   }
-   for (uint32_t i = (Test_RB_Instances_In_Use_Mem_Size - 1); i > (Test_RB_Instances_In_Use_Mem_Size - RB_INSTANCES_IN_USE_MEMORY_EXTENSION_BYTES - 1); i--)
-   {
-      Test_RB_Instances_In_Use_Memory_Region[i] = RB_INSTANCES_IN_USE_PREPOSTPEND_VALUES;
-   }
+   Test_Guard_Init(&RB_Instances_Guard, "RB_Instances[]", &Test_RB_Instances_Memory_Region[0], Test_RB_Instances_Mem_Size,
+                   CLASS_POOL_MEMORY_EXTENSION_BYTES, RB_INSTANCES_PREPOSTPEND_VALUES);
+   Test_Guard_Init(&RB_Instances_In_Use_Guard, "RB_Instances_In_Use[]", &Test_RB_Instances_In_Use_Memory_Region[0], Test_RB_Instances_In_Use_Mem_Size,
+                   CLASS_POOL_IN_USE_MEMORY_EXTENSION_BYTES, RB_INSTANCES_IN_USE_PREPOSTPEND_VALUES);
+   Test_Guard_Arm(&RB_Instances_Guard);
+   Test_Guard_Arm(&RB_Instances_In_Use_Guard);
 
    /* Ensure all Ring Buffers supply valid values to the Constructor when called. */
    for (uint32_t i = 0; i < NUMBER_OF_STATIC_RING_BUFFERS; i++)
@@ -158,7 +167,9 @@ void tearDown(void)
       (void)Ring_Buffer_Static_Destroy((const Ring_Buffer_Static_Handle *)&(Test_Ring_Buffer_Handles[i].me));
    }
 
-   /* Clear our test Memory Regions. */
+   /* Clear our test Memory Regions. Guard pages (if any) have to be writable again first. */
+   Test_Guard_Release(&RB_Instances_Guard);
+   Test_Guard_Release(&RB_Instances_In_Use_Guard);
    memset((void *)&Test_RB_Instances_Memory_Region[0], 0, Test_RB_Instances_Mem_Size);
    memset((void *)&Test_RB_Instances_In_Use_Memory_Region[0], 0, Test_RB_Instances_In_Use_Mem_Size);
 }
@@ -638,9 +649,11 @@ static void Test_Ring_Buffer_Static_Read_Write(void)
    uint8_t * const write_data = &write_data_memory_region[DATA_PREPOSTPEND_LENGTH];
    uint8_t * const read_data = &read_data_memory_region[DATA_PREPOSTPEND_LENGTH];
 
-   /* Copy Data Contents and known prepend/postpend values into Memory Regions. */
-   memset((void *)&read_data_memory_region[0], READ_DATA_PREPOSTPEND_VALUE, DATA_PREPOSTPEND_LENGTH);
-   memset((void *)&read_data_memory_region[DATA_PREPOSTPEND_LENGTH + sizeof(test_type)], READ_DATA_PREPOSTPEND_VALUE, DATA_PREPOSTPEND_LENGTH);
+   /* Copy Data Contents and known prepend/postpend values into Memory Regions. The Read Data is a Guard Region. */
+   Test_Guard read_data_guard;
+   Test_Guard_Init(&read_data_guard, "read_data[]", &read_data_memory_region[0], sizeof(read_data_memory_region), DATA_PREPOSTPEND_LENGTH,
+                   READ_DATA_PREPOSTPEND_VALUE);
+   Test_Guard_Arm(&read_data_guard);
 
    memset((void *)&write_data_memory_region[0], WRITE_DATA_PREPOSTPEND_VALUE, DATA_PREPOSTPEND_LENGTH);
    memset((void *)&write_data_memory_region[DATA_PREPOSTPEND_LENGTH + sizeof(test_type)], WRITE_DATA_PREPOSTPEND_VALUE, DATA_PREPOSTPEND_LENGTH);
@@ -735,10 +748,7 @@ static void Test_Ring_Buffer_Static_Read_Write(void)
       TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(&write_data_values, &read_data[0], sizeof(test_type), fail_msg);
 
       /* Test if Read wrote to out-of-bounds memory. */
-      TEST_ASSERT_EACH_EQUAL_UINT8_MESSAGE(READ_DATA_PREPOSTPEND_VALUE, &read_data_memory_region[0], DATA_PREPOSTPEND_LENGTH, fail_msg);
-
-      TEST_ASSERT_EACH_EQUAL_UINT8_MESSAGE(READ_DATA_PREPOSTPEND_VALUE, &read_data_memory_region[(DATA_PREPOSTPEND_LENGTH + sizeof(test_type))],
-                                          DATA_PREPOSTPEND_LENGTH, fail_msg);
+      TEST_ASSERT_GUARD_INTACT_MESSAGE(&read_data_guard, fail_msg);
 
       /* Reset Read Data buffer and fail message. */
       memset((void *)&read_data[0], 0, sizeof(test_type));
@@ -783,10 +793,7 @@ static void Test_Ring_Buffer_Static_Read_Write(void)
             TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(&write_data_values, &read_data[0], sizeof(test_type), fail_msg);
 
             /* Test if Read wrote to out-of-bounds memory. */
-            TEST_ASSERT_EACH_EQUAL_UINT8_MESSAGE(READ_DATA_PREPOSTPEND_VALUE, &read_data_memory_region[0], DATA_PREPOSTPEND_LENGTH, fail_msg);
-
-            TEST_ASSERT_EACH_EQUAL_UINT8_MESSAGE(READ_DATA_PREPOSTPEND_VALUE, &read_data_memory_region[(DATA_PREPOSTPEND_LENGTH + sizeof(test_type))],
-                                                DATA_PREPOSTPEND_LENGTH, fail_msg);
+            TEST_ASSERT_GUARD_INTACT_MESSAGE(&read_data_guard, fail_msg);
 
             /* Reset Read Data Buffer. */
             memset((void *)&read_data[0], 0, sizeof(test_type));
@@ -844,9 +851,11 @@ static void Test_Ring_Buffer_Static_Read_Write_Max_Number_Of_Elements(void)
    uint8_t * const write_data = &write_data_memory_region[DATA_PREPOSTPEND_LENGTH];
    uint8_t * const read_data = &read_data_memory_region[DATA_PREPOSTPEND_LENGTH];
 
-   /* Copy Data Contents and known prepend/postpend values into Memory Regions. */
-   memset((void *)&read_data_memory_region[0], READ_DATA_PREPOSTPEND_VALUE, DATA_PREPOSTPEND_LENGTH);
-   memset((void *)&read_data_memory_region[DATA_PREPOSTPEND_LENGTH + sizeof(write_data_values)], READ_DATA_PREPOSTPEND_VALUE, DATA_PREPOSTPEND_LENGTH);
+   /* Copy Data Contents and known prepend/postpend values into Memory Regions. The Read Data is a Guard Region. */
+   Test_Guard read_data_guard;
+   Test_Guard_Init(&read_data_guard, "read_data[]", &read_data_memory_region[0], sizeof(read_data_memory_region), DATA_PREPOSTPEND_LENGTH,
+                   READ_DATA_PREPOSTPEND_VALUE);
+   Test_Guard_Arm(&read_data_guard);
 
    memset((void *)&write_data_memory_region[0], WRITE_DATA_PREPOSTPEND_VALUE, DATA_PREPOSTPEND_LENGTH);
    memset((void *)&write_data_memory_region[DATA_PREPOSTPEND_LENGTH + sizeof(write_data_values)], WRITE_DATA_PREPOSTPEND_VALUE, DATA_PREPOSTPEND_LENGTH);
@@ -899,10 +908,7 @@ static void Test_Ring_Buffer_Static_Read_Write_Max_Number_Of_Elements(void)
          TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(&write_data_values, &read_data[0], sizeof(write_data_values), fail_msg);
 
          /* Test if Read wrote to out-of-bounds memory. */
-         TEST_ASSERT_EACH_EQUAL_UINT8_MESSAGE(READ_DATA_PREPOSTPEND_VALUE, &read_data_memory_region[0], DATA_PREPOSTPEND_LENGTH, fail_msg);
-
-         TEST_ASSERT_EACH_EQUAL_UINT8_MESSAGE(READ_DATA_PREPOSTPEND_VALUE, &read_data_memory_region[DATA_PREPOSTPEND_LENGTH + sizeof(write_data_values)],
-                                             DATA_PREPOSTPEND_LENGTH, fail_msg);
+         TEST_ASSERT_GUARD_INTACT_MESSAGE(&read_data_guard, fail_msg);
 
          /* Reset Read Data buffer and fail message. */
          memset((void *)&read_data[0], 0, sizeof(write_data_values));
@@ -952,9 +958,11 @@ static void Test_Ring_Buffer_Static_Read_Write_Max_Element_Size(void)
    uint8_t * const write_data = &write_data_memory_region[DATA_PREPOSTPEND_LENGTH];
    uint8_t * const read_data = &read_data_memory_region[DATA_PREPOSTPEND_LENGTH];
 
-   /* Copy Data Contents and known prepend/postpend values into Memory Regions. */
-   memset((void *)&read_data_memory_region[0], READ_DATA_PREPOSTPEND_VALUE, DATA_PREPOSTPEND_LENGTH);
-   memset((void *)&read_data_memory_region[DATA_PREPOSTPEND_LENGTH + RING_BUFFER_STATIC_SIZE], READ_DATA_PREPOSTPEND_VALUE, DATA_PREPOSTPEND_LENGTH);
+   /* Copy Data Contents and known prepend/postpend values into Memory Regions. The Read Data is a Guard Region. */
+   Test_Guard read_data_guard;
+   Test_Guard_Init(&read_data_guard, "read_data[]", &read_data_memory_region[0], sizeof(read_data_memory_region), DATA_PREPOSTPEND_LENGTH,
+                   READ_DATA_PREPOSTPEND_VALUE);
+   Test_Guard_Arm(&read_data_guard);
 
    memset((void *)&write_data_memory_region[0], WRITE_DATA_PREPOSTPEND_VALUE, DATA_PREPOSTPEND_LENGTH);
    memset((void *)&write_data_memory_region[DATA_PREPOSTPEND_LENGTH + RING_BUFFER_STATIC_SIZE], WRITE_DATA_PREPOSTPEND_VALUE, DATA_PREPOSTPEND_LENGTH);
@@ -1007,10 +1015,7 @@ static void Test_Ring_Buffer_Static_Read_Write_Max_Element_Size(void)
       TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(&write_data_values[0], &read_data[0], RING_BUFFER_STATIC_SIZE, fail_msg);
 
       /* Test if Read wrote to out-of-bounds memory. */
-      TEST_ASSERT_EACH_EQUAL_UINT8_MESSAGE(READ_DATA_PREPOSTPEND_VALUE, &read_data_memory_region[0], DATA_PREPOSTPEND_LENGTH, fail_msg);
-
-      TEST_ASSERT_EACH_EQUAL_UINT8_MESSAGE(READ_DATA_PREPOSTPEND_VALUE, &read_data_memory_region[DATA_PREPOSTPEND_LENGTH + RING_BUFFER_STATIC_SIZE],
-                                          DATA_PREPOSTPEND_LENGTH, fail_msg);
+      TEST_ASSERT_GUARD_INTACT_MESSAGE(&read_data_guard, fail_msg);
 
       /* Reset Read Data buffer and fail message. */
       memset((void *)&read_data[0], 0, RING_BUFFER_STATIC_SIZE);
@@ -1032,50 +1037,133 @@ static void Test_Ring_Buffer_Static_Read_Write_Max_Element_Size(void)
 /*----------------------------------------- Ring_Buffer_Static_Get_Number_Of_Elements() -----------------------------------------*/
 /*-------------------------------------------------------------------------------------------------------------------------------*/
 
-#warning "TODO"
+/**
+ * @brief Tests if the Number of Elements follows every Write and Read, including after the Buffer wrapped around.
+ * Each Buffer is given a different starting offset so the tail is not at the start of the Buffer.
+ */
 static void Test_Ring_Buffer_Static_Get_Number_Of_Elements_Element_Size_1(void);
 static void Test_Ring_Buffer_Static_Get_Number_Of_Elements_Element_Size_1(void)
 {
-   /*---------------------------------------------------------------------------------------------------*/
-   /*-------- Setup. Seed "random number generator" and create dummy read/write buffers. We don't ------*/
-   /*---- verify read/write contents and out-of-bounds access on the data in this test since it was ----*/ 
-   /*----------------- done previously. We just need a place to store write and read data --------------*/
-   /*---------------------------------------------------------------------------------------------------*/
-   srand(time(NULL));
-   uint8_t write_data[NUMBER_OF_STATIC_RING_BUFFERS];
-   uint8_t read_data[NUMBER_OF_STATIC_RING_BUFFERS];
+   uint8_t write_data = 0;
+   uint8_t read_data = 0;
+   Ring_Buffer_Static_Handle invalid_handle = NUMBER_OF_STATIC_RING_BUFFERS;
 
    /*---------------------------------------------------------------------------------------------------*/
-   /*---- Generate random number of elements and random element size for all Buffers but guarantee -----*/
-   /*---------------- Buffers always have enough capacity to hold the requested data sizes. ------------*/
+   /*---------------------- Verify 0 is returned on invalid and empty Handles --------------------------*/
    /*---------------------------------------------------------------------------------------------------*/
-   // Ring_Buffer_Static_Handle invalid_handle;
+   TEST_ASSERT_EQUAL_UINT32(0, Ring_Buffer_Static_Get_Number_Of_Elements((const Ring_Buffer_Static_Handle *)0));
+   TEST_ASSERT_EQUAL_UINT32(0, Ring_Buffer_Static_Get_Number_Of_Elements((const Ring_Buffer_Static_Handle *)&invalid_handle));
+
+   for (uint32_t buf = 0; buf < NUMBER_OF_STATIC_RING_BUFFERS; buf++)
+   {
+      TEST_ASSERT_TRUE(Ring_Buffer_Static_Ctor(&Test_Ring_Buffer_Handles[buf].me, Test_Ring_Buffer_Handles[buf].element_size, 
+                                                Test_Ring_Buffer_Handles[buf].number_of_elements));
+      TEST_ASSERT_EQUAL_UINT32(0, Ring_Buffer_Static_Get_Number_Of_Elements((const Ring_Buffer_Static_Handle *)&Test_Ring_Buffer_Handles[buf].me));
+   }
+
+   for (uint32_t buf = 0; buf < NUMBER_OF_STATIC_RING_BUFFERS; buf++)
+   {
+      const Ring_Buffer_Static_Handle * me = (const Ring_Buffer_Static_Handle *)&Test_Ring_Buffer_Handles[buf].me;
+      const uint32_t number_of_elements = Test_Ring_Buffer_Handles[buf].number_of_elements;
+      const uint32_t offset = (buf * number_of_elements) / NUMBER_OF_STATIC_RING_BUFFERS + 1;
+
+      /*------------------------------------------------------------------------------------------------*/
+      /*------------- Move head and tail away from the start of the Buffer so Writes wrap. -------------*/
+      /*------------------------------------------------------------------------------------------------*/
+      for (uint32_t i = 0; i < offset; i++)
+      {
+         TEST_ASSERT_TRUE(Ring_Buffer_Static_Write(me, (const void *)&write_data, sizeof(write_data)));
+         TEST_ASSERT_TRUE(Ring_Buffer_Static_Read(me, (void *)&read_data, sizeof(read_data)));
+      }
+
+      /*------------------------------------------------------------------------------------------------*/
+      /*------- Write until Full and then Read until Empty, twice. Each Write increments the count -----*/
+      /*--------------------------- by one and each Read decrements it by one. -------------------------*/
+      /*------------------------------------------------------------------------------------------------*/
+      for (uint32_t repeat = 0; repeat < 2; repeat++)
+      {
+         for (uint32_t i = 1; i <= number_of_elements; i++)
+         {
+            TEST_ASSERT_TRUE(Ring_Buffer_Static_Write(me, (const void *)&write_data, sizeof(write_data)));
+            TEST_ASSERT_EQUAL_UINT32(i, Ring_Buffer_Static_Get_Number_Of_Elements(me));
+         }
 
-   // for (uint32_t buf = 0; buf < NUMBER_OF_STATIC_RING_BUFFERS; buf++)
-   // {
-   //    /* Max capacity of each Buffer is RING_BUFFER_STATIC_SIZE bytes. Guarantee we never request more than this. */
-   //    size_t rand_element_size                           = (rand() % RING_BUFFER_STATIC_SIZE) + 1;
-   //    uint32_t max_number_of_elements                    = floor(RING_BUFFER_STATIC_SIZE / rand_element_size); 
-   //    uint32_t rand_number_of_elements                   = (rand() % max_number_of_elements) + 1;
-   //    Test_Ring_Buffer_Handles[buf].element_size         = rand_element_size;
-   //    Test_Ring_Buffer_Handles[buf].number_of_elements   = rand_number_of_elements;
+         TEST_ASSERT_TRUE(Ring_Buffer_Static_Is_Full(me));
+
+         for (uint32_t i = number_of_elements; i > 0; i--)
+         {
+            TEST_ASSERT_TRUE(Ring_Buffer_Static_Read(me, (void *)&read_data, sizeof(read_data)));
+            TEST_ASSERT_EQUAL_UINT32(i - 1, Ring_Buffer_Static_Get_Number_Of_Elements(me));
+         }
+
+         TEST_ASSERT_TRUE(Ring_Buffer_Static_Is_Empty(me));
+      }
+   }
 
-   //    TEST_ASSERT_TRUE(Ring_Buffer_Static_Ctor(&Test_Ring_Buffer_Handles[buf].me, Test_Ring_Buffer_Handles[buf].element_size, 
-   //                                              Test_Ring_Buffer_Handles[buf].number_of_elements));
-   // }
+   Test_RB_Objects_Memory_Access();
+}
 
 
-   /* Verify 0 is returned on invalid handle */
 
-   /* Verify 0 is returned on empty handles */
 
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ PERFORMANCE PROBES -----------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/* Built with make BENCH=1 only, which compiles the Unity bench extra */
+#if defined(UNITY_INCLUDE_BENCH)
 
-   /* Write until Full. With each write verify Element count incremetns by one. */
+/**
+ * @brief Performance probe for the Write/Read hot path. Every Write and Read in the measured loop is
+ * still asserted so the probe doubles as a correctness test. Results are printed next to PASS.
+ */
+static void Test_Ring_Buffer_Static_Write_Read_Bench(void);
+static void Test_Ring_Buffer_Static_Write_Read_Bench(void)
+{
+   uint8_t write_data = 0x5A;
+   uint8_t read_data = 0;
 
-   /* Read until empty. With each read verify Eleemtn count decrements by one. */
+   TEST_ASSERT_TRUE(Ring_Buffer_Static_Ctor(&Test_Ring_Buffer_Handles[0].me, Test_Ring_Buffer_Handles[0].element_size, 
+                                             Test_Ring_Buffer_Handles[0].number_of_elements));
 
-   /* Repeat Write/Read sequence for certain number of times. */
+   TEST_BENCH_LOOP(1)
+   {
+      TEST_ASSERT_TRUE(Ring_Buffer_Static_Write((const Ring_Buffer_Static_Handle *)&Test_Ring_Buffer_Handles[0].me, (const void *)&write_data,
+                                                sizeof(write_data)));
+      TEST_ASSERT_TRUE(Ring_Buffer_Static_Read((const Ring_Buffer_Static_Handle *)&Test_Ring_Buffer_Handles[0].me, (void *)&read_data,
+                                               sizeof(read_data)));
+   }
+
+   TEST_ASSERT_EQUAL_UINT8(write_data, read_data);
+   TEST_ASSERT_TRUE(Ring_Buffer_Static_Is_Empty((const Ring_Buffer_Static_Handle *)&Test_Ring_Buffer_Handles[0].me));
+   Test_RB_Objects_Memory_Access();
+}
+
+
+/**
+ * @brief Performance probe for a Constructor immediately followed by a Destructor on the last
+ * Ring Buffer in the pool, which is the worst case for the Constructor's pool scan.
+ */
+static void Test_Ring_Buffer_Static_Ctor_Destroy_Bench(void);
+static void Test_Ring_Buffer_Static_Ctor_Destroy_Bench(void)
+{
+   const uint32_t last = NUMBER_OF_STATIC_RING_BUFFERS - 1;
+
+   for (uint32_t i = 0; i < last; i++)
+   {
+      TEST_ASSERT_TRUE(Ring_Buffer_Static_Ctor(&Test_Ring_Buffer_Handles[i].me, Test_Ring_Buffer_Handles[i].element_size, 
+                                                Test_Ring_Buffer_Handles[i].number_of_elements));
+   }
+
+   TEST_BENCH_LOOP(1)
+   {
+      TEST_ASSERT_TRUE(Ring_Buffer_Static_Ctor(&Test_Ring_Buffer_Handles[last].me, Test_Ring_Buffer_Handles[last].element_size, 
+                                                Test_Ring_Buffer_Handles[last].number_of_elements));
+      TEST_ASSERT_TRUE(Ring_Buffer_Static_Destroy((const Ring_Buffer_Static_Handle *)&Test_Ring_Buffer_Handles[last].me));
+   }
+
+   Test_RB_Objects_Memory_Access();
 }
+#endif /* UNITY_INCLUDE_BENCH */
 
 
 
@@ -1093,5 +1181,10 @@ int main(void)
    RUN_TEST(Test_Ring_Buffer_Static_Read_Write);
    RUN_TEST(Test_Ring_Buffer_Static_Read_Write_Max_Number_Of_Elements);
    RUN_TEST(Test_Ring_Buffer_Static_Read_Write_Max_Element_Size);
+   RUN_TEST(Test_Ring_Buffer_Static_Get_Number_Of_Elements_Element_Size_1);
+#if defined(UNITY_INCLUDE_BENCH)
+   RUN_TEST(Test_Ring_Buffer_Static_Write_Read_Bench);
+   RUN_TEST(Test_Ring_Buffer_Static_Ctor_Destroy_Bench);
+#endif
    return UNITY_END();
 }
\ No newline at end of file
@@ -0,0 +1,411 @@
+/**
+ * @file test_ring_buffer_static_fd.c
+ * @author agent
+ * @brief Unit Tests of the File Descriptor methods of the Static Ring Buffer, Ring_Buffer_Static_Fill_From_Fd and
+ * Ring_Buffer_Static_Drain_To_Fd. The tests use pipes, so they read and write real file descriptors. HEAD and TAIL are
+ * moved with Write and Read first where a test needs the free or used space to wrap around the end of the Buffer.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#define _POSIX_C_SOURCE 200809L     /* pipe, fcntl */
+
+/* STD-C Libraries */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>     /* memset, size_t */
+
+/* POSIX */
+#include <errno.h>
+#include <fcntl.h>      /* fcntl, O_NONBLOCK */
+#include <unistd.h>     /* pipe, read, write, close */
+
+/* Unit Test Framework */
+#include "unity.h"
+
+/* Unit Test Support */
+#include "test_guard.h"
+
+/* Module Under Test */
+#include "ring_buffer_static.h"
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------- UNIT TEST SETUP VALUES ------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Guard Region patterns. Same meaning as in test_ring_buffer_static.c.
+ */
+#define RB_INSTANCES_PREPOSTPEND_VALUES                           0x33
+#define RB_INSTANCES_IN_USE_PREPOSTPEND_VALUES                    0x44
+
+
+/**
+ * @brief Number of bytes the byte stream Ring Buffer of each test holds. Less than RING_BUFFER_STATIC_SIZE, so the
+ * Guard Regions would catch a region running past the capacity.
+ */
+#define FD_RING_LENGTH                                            16u
+
+
+/**
+ * @brief Pipe ends.
+ */
+#define FD_READ_END                                               0
+#define FD_WRITE_END                                              1
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------- GUARD REGIONS ---------------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+static Test_Guard RB_Instances_Guard;
+static Test_Guard RB_Instances_In_Use_Guard;
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*----------------------------------------------------------- HELPERS -----------------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Handle and pipe of each test. Destroyed and closed in tearDown() whatever happened.
+ */
+static Ring_Buffer_Static_Handle Fd_Handle;
+static int Fd_Pipe[2];
+
+
+/**
+ * @brief Fills @p bytes with a pattern that starts at @p first, so every byte of a test is different.
+ */
+static void Fd_Pattern(uint8_t * bytes, size_t size, uint8_t first);
+static void Fd_Pattern(uint8_t * bytes, size_t size, uint8_t first)
+{
+   for (size_t i = 0; i < size; i++)
+   {
+      bytes[i] = (uint8_t)(first + i);
+   }
+}
+
+
+/**
+ * @brief Moves HEAD and TAIL to @p position by writing and reading that many bytes, leaving the Ring Buffer empty.
+ */
+static void Fd_Move_To(uint32_t position);
+static void Fd_Move_To(uint32_t position)
+{
+   uint8_t byte = 0;
+
+   for (uint32_t i = 0; i < position; i++)
+   {
+      TEST_ASSERT_TRUE(Ring_Buffer_Static_Write(&Fd_Handle, &byte, sizeof(byte)));
+      TEST_ASSERT_TRUE(Ring_Buffer_Static_Read(&Fd_Handle, &byte, sizeof(byte)));
+   }
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Static_Is_Empty(&Fd_Handle));
+}
+
+
+/**
+ * @brief Writes @p size bytes into the pipe and checks the pipe took all of them.
+ */
+static void Fd_Pipe_Write(const uint8_t * bytes, size_t size);
+static void Fd_Pipe_Write(const uint8_t * bytes, size_t size)
+{
+   TEST_ASSERT_EQUAL_INT((int)size, (int)write(Fd_Pipe[FD_WRITE_END], bytes, size));
+}
+
+
+/**
+ * @brief Reads exactly @p size bytes from the pipe and checks nothing else is waiting in it.
+ */
+static void Fd_Pipe_Expect(const uint8_t * bytes, size_t size);
+static void Fd_Pipe_Expect(const uint8_t * bytes, size_t size)
+{
+   uint8_t received[RING_BUFFER_STATIC_SIZE + 1];
+
+   TEST_ASSERT_EQUAL_INT(0, fcntl(Fd_Pipe[FD_READ_END], F_SETFL, O_NONBLOCK));
+   TEST_ASSERT_EQUAL_INT((int)size, (int)read(Fd_Pipe[FD_READ_END], received, sizeof(received)));
+   TEST_ASSERT_EQUAL_UINT8_ARRAY(bytes, received, size);
+}
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------- RUNS AT THE START AND END OF EACH TEST --------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+void setUp(void)
+{
+   Test_Guard_Init(&RB_Instances_Guard, "RB_Instances[]", &Test_RB_Instances_Memory_Region[0], Test_RB_Instances_Mem_Size,
+                   CLASS_POOL_MEMORY_EXTENSION_BYTES, RB_INSTANCES_PREPOSTPEND_VALUES);
+   Test_Guard_Init(&RB_Instances_In_Use_Guard, "RB_Instances_In_Use[]", &Test_RB_Instances_In_Use_Memory_Region[0], Test_RB_Instances_In_Use_Mem_Size,
+                   CLASS_POOL_IN_USE_MEMORY_EXTENSION_BYTES, RB_INSTANCES_IN_USE_PREPOSTPEND_VALUES);
+   Test_Guard_Arm(&RB_Instances_Guard);
+   Test_Guard_Arm(&RB_Instances_In_Use_Guard);
+
+   Fd_Handle = 0;
+   TEST_ASSERT_EQUAL_INT(0, pipe(Fd_Pipe));
+   TEST_ASSERT_TRUE(Ring_Buffer_Static_Ctor(&Fd_Handle, sizeof(uint8_t), FD_RING_LENGTH));
+}
+
+void tearDown(void)
+{
+   (void)Ring_Buffer_Static_Destroy(&Fd_Handle);
+   (void)close(Fd_Pipe[FD_READ_END]);
+   (void)close(Fd_Pipe[FD_WRITE_END]);
+
+   Test_Guard_Release(&RB_Instances_Guard);
+   Test_Guard_Release(&RB_Instances_In_Use_Guard);
+   memset((void *)&Test_RB_Instances_Memory_Region[0], 0, Test_RB_Instances_Mem_Size);
+   memset((void *)&Test_RB_Instances_In_Use_Memory_Region[0], 0, Test_RB_Instances_In_Use_Mem_Size);
+}
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------------------- UNIT TESTS BEGIN -----------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Fewer bytes waiting than free space: all of them are read and come out of Read in order.
+ */
+static void Test_Ring_Buffer_Static_Fd_Fill_Partial(void);
+static void Test_Ring_Buffer_Static_Fd_Fill_Partial(void)
+{
+   uint8_t sent[5];
+   size_t bytes = 0;
+
+   Fd_Pattern(sent, sizeof(sent), 1);
+   Fd_Pipe_Write(sent, sizeof(sent));
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Static_Fill_From_Fd(&Fd_Handle, Fd_Pipe[FD_READ_END], &bytes));
+   TEST_ASSERT_EQUAL_size_t(sizeof(sent), bytes);
+   TEST_ASSERT_EQUAL_UINT32(sizeof(sent), Ring_Buffer_Static_Get_Number_Of_Elements(&Fd_Handle));
+
+   for (size_t i = 0; i < sizeof(sent); i++)
+   {
+      uint8_t byte = 0;
+      TEST_ASSERT_TRUE(Ring_Buffer_Static_Read(&Fd_Handle, &byte, sizeof(byte)));
+      TEST_ASSERT_EQUAL_UINT8(sent[i], byte);
+   }
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Static_Is_Empty(&Fd_Handle));
+   TEST_ASSERT_GUARD_INTACT(&RB_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RB_Instances_In_Use_Guard);
+}
+
+
+/**
+ * @brief HEAD in the middle of the Buffer: one readv() fills the end of the Buffer and then the start, up to Full.
+ * The bytes beyond the free space stay in the pipe.
+ */
+static void Test_Ring_Buffer_Static_Fd_Fill_Wraps_To_Full(void);
+static void Test_Ring_Buffer_Static_Fd_Fill_Wraps_To_Full(void)
+{
+   uint8_t sent[FD_RING_LENGTH + 3];
+   size_t bytes = 0;
+
+   Fd_Move_To(FD_RING_LENGTH - 5);
+   Fd_Pattern(sent, sizeof(sent), 0x80);
+   Fd_Pipe_Write(sent, sizeof(sent));
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Static_Fill_From_Fd(&Fd_Handle, Fd_Pipe[FD_READ_END], &bytes));
+   TEST_ASSERT_EQUAL_size_t(FD_RING_LENGTH, bytes);
+   TEST_ASSERT_TRUE(Ring_Buffer_Static_Is_Full(&Fd_Handle));
+
+   /* Full: nothing is read, and the rest is still in the pipe. */
+   TEST_ASSERT_FALSE(Ring_Buffer_Static_Fill_From_Fd(&Fd_Handle, Fd_Pipe[FD_READ_END], &bytes));
+   TEST_ASSERT_EQUAL_size_t(0, bytes);
+
+   for (size_t i = 0; i < FD_RING_LENGTH; i++)
+   {
+      uint8_t byte = 0;
+      TEST_ASSERT_TRUE(Ring_Buffer_Static_Read(&Fd_Handle, &byte, sizeof(byte)));
+      TEST_ASSERT_EQUAL_UINT8(sent[i], byte);
+   }
+
+   Fd_Pipe_Expect(&sent[FD_RING_LENGTH], sizeof(sent) - FD_RING_LENGTH);
+   TEST_ASSERT_GUARD_INTACT(&RB_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RB_Instances_In_Use_Guard);
+}
+
+
+/**
+ * @brief Stored bytes wrapping around the end of the Buffer are written by one writev() in the order they were
+ * written to the Ring Buffer, leaving it Empty.
+ */
+static void Test_Ring_Buffer_Static_Fd_Drain_Wraps(void);
+static void Test_Ring_Buffer_Static_Fd_Drain_Wraps(void)
+{
+   uint8_t stored[FD_RING_LENGTH - 2];
+   size_t bytes = 0;
+
+   Fd_Move_To(FD_RING_LENGTH - 3);
+   Fd_Pattern(stored, sizeof(stored), 0x40);
+
+   for (size_t i = 0; i < sizeof(stored); i++)
+   {
+      TEST_ASSERT_TRUE(Ring_Buffer_Static_Write(&Fd_Handle, &stored[i], sizeof(stored[i])));
+   }
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Static_Drain_To_Fd(&Fd_Handle, Fd_Pipe[FD_WRITE_END], &bytes));
+   TEST_ASSERT_EQUAL_size_t(sizeof(stored), bytes);
+   TEST_ASSERT_TRUE(Ring_Buffer_Static_Is_Empty(&Fd_Handle));
+   TEST_ASSERT_EQUAL_UINT32(0, Ring_Buffer_Static_Get_Number_Of_Elements(&Fd_Handle));
+
+   /* Empty: nothing is written. */
+   TEST_ASSERT_FALSE(Ring_Buffer_Static_Drain_To_Fd(&Fd_Handle, Fd_Pipe[FD_WRITE_END], &bytes));
+   TEST_ASSERT_EQUAL_size_t(0, bytes);
+
+   Fd_Pipe_Expect(stored, sizeof(stored));
+   TEST_ASSERT_GUARD_INTACT(&RB_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RB_Instances_In_Use_Guard);
+}
+
+
+/**
+ * @brief A Full Ring Buffer drains completely, and a Fill and Drain loop passes a stream through unchanged while
+ * HEAD and TAIL wrap many times.
+ */
+static void Test_Ring_Buffer_Static_Fd_Stream_Through(void);
+static void Test_Ring_Buffer_Static_Fd_Stream_Through(void)
+{
+   int out[2];
+   uint8_t sent[7];
+   uint8_t received[sizeof(sent)];
+   size_t bytes = 0;
+
+   TEST_ASSERT_EQUAL_INT(0, pipe(out));
+
+   for (uint32_t round = 0; round < 3u * FD_RING_LENGTH; round++)
+   {
+      Fd_Pattern(sent, sizeof(sent), (uint8_t)(round * sizeof(sent)));
+      Fd_Pipe_Write(sent, sizeof(sent));
+
+      TEST_ASSERT_TRUE(Ring_Buffer_Static_Fill_From_Fd(&Fd_Handle, Fd_Pipe[FD_READ_END], &bytes));
+      TEST_ASSERT_EQUAL_size_t(sizeof(sent), bytes);
+      TEST_ASSERT_TRUE(Ring_Buffer_Static_Drain_To_Fd(&Fd_Handle, out[FD_WRITE_END], &bytes));
+      TEST_ASSERT_EQUAL_size_t(sizeof(sent), bytes);
+      TEST_ASSERT_EQUAL_INT((int)sizeof(received), (int)read(out[FD_READ_END], received, sizeof(received)));
+      TEST_ASSERT_EQUAL_UINT8_ARRAY(sent, received, sizeof(sent));
+   }
+
+   /* Full, with HEAD == TAIL somewhere in the middle of the Buffer. */
+   uint8_t full[FD_RING_LENGTH];
+   Fd_Pattern(full, sizeof(full), 0xA0);
+   Fd_Pipe_Write(full, sizeof(full));
+   TEST_ASSERT_TRUE(Ring_Buffer_Static_Fill_From_Fd(&Fd_Handle, Fd_Pipe[FD_READ_END], &bytes));
+   TEST_ASSERT_TRUE(Ring_Buffer_Static_Is_Full(&Fd_Handle));
+   TEST_ASSERT_TRUE(Ring_Buffer_Static_Drain_To_Fd(&Fd_Handle, Fd_Pipe[FD_WRITE_END], &bytes));
+   TEST_ASSERT_EQUAL_size_t(FD_RING_LENGTH, bytes);
+   TEST_ASSERT_TRUE(Ring_Buffer_Static_Is_Empty(&Fd_Handle));
+   Fd_Pipe_Expect(full, sizeof(full));
+
+   (void)close(out[FD_READ_END]);
+   (void)close(out[FD_WRITE_END]);
+   TEST_ASSERT_GUARD_INTACT(&RB_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RB_Instances_In_Use_Guard);
+}
+
+
+/**
+ * @brief End of file is a successful Fill of 0 bytes that leaves the Ring Buffer Empty.
+ */
+static void Test_Ring_Buffer_Static_Fd_Fill_End_Of_File(void);
+static void Test_Ring_Buffer_Static_Fd_Fill_End_Of_File(void)
+{
+   size_t bytes = 1;
+
+   TEST_ASSERT_EQUAL_INT(0, close(Fd_Pipe[FD_WRITE_END]));
+   Fd_Pipe[FD_WRITE_END] = -1;
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Static_Fill_From_Fd(&Fd_Handle, Fd_Pipe[FD_READ_END], &bytes));
+   TEST_ASSERT_EQUAL_size_t(0, bytes);
+   TEST_ASSERT_TRUE(Ring_Buffer_Static_Is_Empty(&Fd_Handle));
+}
+
+
+/**
+ * @brief A failing readv() or writev() (nothing to read yet, or a bad file descriptor) leaves errno as it set it
+ * and the Ring Buffer unchanged.
+ */
+static void Test_Ring_Buffer_Static_Fd_System_Call_Errors(void);
+static void Test_Ring_Buffer_Static_Fd_System_Call_Errors(void)
+{
+   uint8_t byte = 0x5A;
+   size_t bytes = 1;
+
+   TEST_ASSERT_EQUAL_INT(0, fcntl(Fd_Pipe[FD_READ_END], F_SETFL, O_NONBLOCK));
+   errno = 0;
+   TEST_ASSERT_FALSE(Ring_Buffer_Static_Fill_From_Fd(&Fd_Handle, Fd_Pipe[FD_READ_END], &bytes));
+   TEST_ASSERT_TRUE((errno == EAGAIN) || (errno == EWOULDBLOCK));
+   TEST_ASSERT_EQUAL_size_t(0, bytes);
+   TEST_ASSERT_TRUE(Ring_Buffer_Static_Is_Empty(&Fd_Handle));
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Static_Write(&Fd_Handle, &byte, sizeof(byte)));
+   errno = 0;
+   TEST_ASSERT_FALSE(Ring_Buffer_Static_Drain_To_Fd(&Fd_Handle, -1, &bytes));
+   TEST_ASSERT_EQUAL_INT(EBADF, errno);
+   TEST_ASSERT_EQUAL_UINT32(1, Ring_Buffer_Static_Get_Number_Of_Elements(&Fd_Handle));
+   TEST_ASSERT_TRUE(Ring_Buffer_Static_Read(&Fd_Handle, &byte, sizeof(byte)));
+   TEST_ASSERT_EQUAL_UINT8(0x5A, byte);
+}
+
+
+/**
+ * @brief Invalid Handles, a NULL byte count and Ring Buffers of elements larger than a byte are refused without
+ * touching the file descriptor.
+ */
+static void Test_Ring_Buffer_Static_Fd_Invalid_Arguments(void);
+static void Test_Ring_Buffer_Static_Fd_Invalid_Arguments(void)
+{
+   Ring_Buffer_Static_Handle never_constructed = 0;
+   Ring_Buffer_Static_Handle wide = 0;
+   uint8_t sent[2] = { 1, 2 };
+   uint16_t element = 0x1234;
+   size_t bytes = 1;
+
+   Fd_Pipe_Write(sent, sizeof(sent));
+
+   TEST_ASSERT_FALSE(Ring_Buffer_Static_Fill_From_Fd(NULL, Fd_Pipe[FD_READ_END], &bytes));
+   TEST_ASSERT_EQUAL_size_t(0, bytes);
+   TEST_ASSERT_FALSE(Ring_Buffer_Static_Fill_From_Fd(&never_constructed, Fd_Pipe[FD_READ_END], &bytes));
+   TEST_ASSERT_FALSE(Ring_Buffer_Static_Fill_From_Fd(&Fd_Handle, Fd_Pipe[FD_READ_END], NULL));
+   TEST_ASSERT_FALSE(Ring_Buffer_Static_Drain_To_Fd(NULL, Fd_Pipe[FD_WRITE_END], &bytes));
+   TEST_ASSERT_FALSE(Ring_Buffer_Static_Drain_To_Fd(&never_constructed, Fd_Pipe[FD_WRITE_END], &bytes));
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Static_Ctor(&wide, sizeof(uint16_t), 4));
+   TEST_ASSERT_FALSE(Ring_Buffer_Static_Fill_From_Fd(&wide, Fd_Pipe[FD_READ_END], &bytes));
+   TEST_ASSERT_TRUE(Ring_Buffer_Static_Write(&wide, &element, sizeof(element)));
+   TEST_ASSERT_FALSE(Ring_Buffer_Static_Drain_To_Fd(&wide, Fd_Pipe[FD_WRITE_END], &bytes));
+   TEST_ASSERT_EQUAL_UINT32(1, Ring_Buffer_Static_Get_Number_Of_Elements(&wide));
+   TEST_ASSERT_TRUE(Ring_Buffer_Static_Destroy(&wide));
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Static_Is_Empty(&Fd_Handle));
+   Fd_Pipe_Expect(sent, sizeof(sent));
+   TEST_ASSERT_GUARD_INTACT(&RB_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RB_Instances_In_Use_Guard);
+}
+
+
+
+
+int main(void)
+{
+   UNITY_BEGIN();
+   RUN_TEST(Test_Ring_Buffer_Static_Fd_Fill_Partial);
+   RUN_TEST(Test_Ring_Buffer_Static_Fd_Fill_Wraps_To_Full);
+   RUN_TEST(Test_Ring_Buffer_Static_Fd_Drain_Wraps);
+   RUN_TEST(Test_Ring_Buffer_Static_Fd_Stream_Through);
+   RUN_TEST(Test_Ring_Buffer_Static_Fd_Fill_End_Of_File);
+   RUN_TEST(Test_Ring_Buffer_Static_Fd_System_Call_Errors);
+   RUN_TEST(Test_Ring_Buffer_Static_Fd_Invalid_Arguments);
+   return UNITY_END();
+}
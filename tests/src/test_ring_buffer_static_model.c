@@ -0,0 +1,891 @@
+/**
+ * @file test_ring_buffer_static_model.c
+ * @author agent
+ * @brief Exhaustive small-scope model checking of the Static Ring Buffer state machine. The hard part of a faster,
+ * branchless or lock-free Ring Buffer is the Full/Empty edge cases, so instead of sampling them this checks ALL of them
+ * for small Ring Buffers:
+ *
+ * 1. Sequences. Every sequence of Write, Read and Clear up to RB_MODEL_DEPTH operations is run against the Module for
+ *    several element sizes and lengths, and every result, every byte read and every state query is compared with a
+ *    reference FIFO.
+ *
+ * 2. Interleavings. The index math of a Ring Buffer is written as a step model: Write and Read split into their
+ *    individual loads and stores of the shared head, tail, flags and slots. Every interleaving of a producer thread
+ *    making RB_MODEL_WRITES Write attempts with a consumer thread making RB_MODEL_READS Read attempts is explored
+ *    (sequential consistency, states already seen are not explored again). Items must arrive exactly once and in order,
+ *    and once both threads are done the Ring Buffer must hold exactly the items that were not read yet.
+ *
+ * The step model of the Module's own index math (is_empty flag plus head == tail) is first checked against the same
+ * reference FIFO as the Module in part 1, so it is known to describe the Module. Part 2 then finds the interleaving that
+ * loses an item, which is why threads sharing a Static Ring Buffer have to lock (test_ring_buffer_static_threads.c).
+ * A candidate lock-free index math (free-running head and tail counters) must pass every interleaving. New index math
+ * is added as another Model_Algorithm_t and has to pass both parts before it replaces the Module's.
+ *
+ * RB_MODEL_DEPTH, RB_MODEL_WRITES and RB_MODEL_READS override the defaults below. A violation prints the operation
+ * sequence or the thread schedule that caused it.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+/* STD-C Libraries */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>      /* snprintf */
+#include <stdlib.h>     /* getenv, strtoul, calloc, free */
+#include <string.h>     /* memset, memcmp, memcpy, size_t */
+
+/* Unit Test Framework */
+#include "unity.h"
+
+/* Unit Test Support */
+#include "test_guard.h"
+
+/* Module Under Test */
+#include "ring_buffer_static.h"
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------- UNIT TEST SETUP VALUES ------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Guard Region patterns. Same meaning as in test_ring_buffer_static.c.
+ */
+#define RB_INSTANCES_PREPOSTPEND_VALUES                           0x33
+#define RB_INSTANCES_IN_USE_PREPOSTPEND_VALUES                    0x44
+
+
+/**
+ * @brief Default scope. Sequences of 9 operations over 3 operations are 3^9 = 19683 sequences per Ring Buffer shape,
+ * which is every Full and Empty transition of a Ring Buffer of up to 4 elements, several times over.
+ */
+#define MODEL_DEFAULT_DEPTH                                       9u
+#define MODEL_DEFAULT_WRITES                                      6u
+#define MODEL_DEFAULT_READS                                       6u
+
+
+/**
+ * @brief Limits of the scope. The step model stores one byte per slot and counts items in a byte.
+ */
+#define MODEL_MAX_DEPTH                                           14u
+#define MODEL_MAX_CAPACITY                                        4u
+#define MODEL_MAX_ATTEMPTS                                        8u
+
+
+/**
+ * @brief Number of states the interleaving search can remember. Every state is at most visited once, so this bounds
+ * the work as well. The default scope needs well under a tenth of it.
+ */
+#define MODEL_VISITED_CAPACITY                                    (1u << 20)
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*----------------------------------------------------------- STEP MODEL --------------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Memory shared by the producer and consumer. One byte per slot holds the item number.
+ */
+typedef struct
+{
+   uint8_t slots[MODEL_MAX_CAPACITY];
+   uint8_t head;
+   uint8_t tail;
+   uint8_t is_empty;                               /* Only used by the flag index math. */
+} Model_Shared_t;
+
+
+/**
+ * @brief One thread. A Write or Read attempt is a sequence of steps, each doing at most one load or store of shared
+ * memory. Registers hold what earlier steps of the attempt loaded.
+ */
+typedef struct
+{
+   uint8_t pc;                                     /* Next step of the current attempt. 0 = the next attempt starts. */
+   uint8_t attempts;                               /* Attempts left, including the current one. */
+   uint8_t item;                                   /* Producer: next item to write. Consumer: next item expected. */
+   uint8_t r0;
+   uint8_t r1;
+   uint8_t r2;
+} Model_Thread_t;
+
+
+/**
+ * @brief Everything a state of the search consists of. Only uint8_t members, so there is no padding and states can be
+ * compared and hashed as bytes.
+ */
+typedef struct
+{
+   Model_Shared_t shared;
+   Model_Thread_t producer;
+   Model_Thread_t consumer;
+   uint8_t violation;                              /* The consumer read an item out of order. */
+} Model_State_t;
+
+
+/**
+ * @brief Index math under test. The steps run one step of the current attempt of a thread that is not done yet.
+ */
+typedef struct
+{
+   const char * name;
+   void (*reset)(Model_Shared_t * shared);
+   void (*producer_step)(Model_State_t * state, uint8_t capacity);
+   void (*consumer_step)(Model_State_t * state, uint8_t capacity);
+} Model_Algorithm_t;
+
+
+/**
+ * @brief Ends the current attempt of a thread. A successful attempt moves on to the next item.
+ */
+static inline void Model_End_Attempt(Model_Thread_t * thread, bool success);
+static inline void Model_End_Attempt(Model_Thread_t * thread, bool success)
+{
+   thread->item = (uint8_t)(thread->item + ((success) ? 1u : 0u));
+   thread->attempts--;
+   thread->pc = 0;
+   thread->r0 = 0;                                 /* So equal states compare equal whatever the last attempt loaded. */
+   thread->r1 = 0;
+   thread->r2 = 0;
+}
+
+
+/**
+ * @brief Checks the item a Read returned is the next one the producer wrote.
+ */
+static inline void Model_Received(Model_State_t * state, uint8_t item);
+static inline void Model_Received(Model_State_t * state, uint8_t item)
+{
+   if (item != state->consumer.item)
+   {
+      state->violation = 1;
+   }
+
+   Model_End_Attempt(&state->consumer, true);
+}
+
+
+/**
+ * @brief The Module's index math (ring_buffer_static_inline.h) with one slot per element. head and tail wrap at the
+ * capacity and is_empty tells a Full Ring Buffer from an Empty one when head == tail. The Module loads head, tail
+ * and is_empty separately, so they are separate steps here too.
+ */
+static void Model_Flag_Reset(Model_Shared_t * shared);
+static void Model_Flag_Reset(Model_Shared_t * shared)
+{
+   shared->head = 0;
+   shared->tail = 0;
+   shared->is_empty = 1;
+}
+
+static void Model_Flag_Producer_Step(Model_State_t * state, uint8_t capacity);
+static void Model_Flag_Producer_Step(Model_State_t * state, uint8_t capacity)
+{
+   Model_Thread_t * self = &state->producer;
+   Model_Shared_t * shared = &state->shared;
+
+   switch (self->pc)
+   {
+      case 0:  self->r0 = shared->head;      self->pc = 1;  break;   /* Is_Full() */
+      case 1:  self->r1 = shared->tail;      self->pc = 2;  break;
+      case 2:
+         self->r2 = shared->is_empty;
+         if ((self->r0 == self->r1) && (!self->r2)) { Model_End_Attempt(self, false); }
+         else                                       { self->pc = 3; }
+         break;
+      case 3:  shared->slots[self->r0] = self->item;                   self->pc = 4;  break;
+      case 4:  shared->head = (uint8_t)((self->r0 + 1u) % capacity);    self->pc = 5;  break;
+      default: shared->is_empty = 0;         Model_End_Attempt(self, true);         break;
+   }
+}
+
+static void Model_Flag_Consumer_Step(Model_State_t * state, uint8_t capacity);
+static void Model_Flag_Consumer_Step(Model_State_t * state, uint8_t capacity)
+{
+   Model_Thread_t * self = &state->consumer;
+   Model_Shared_t * shared = &state->shared;
+
+   switch (self->pc)
+   {
+      case 0:                                                         /* Is_Empty() */
+         if (shared->is_empty) { Model_End_Attempt(self, false); }
+         else                  { self->pc = 1; }
+         break;
+      case 1:  self->r1 = shared->tail;                                self->pc = 2;  break;
+      case 2:  self->r2 = shared->slots[self->r1];                     self->pc = 3;  break;
+      case 3:  shared->tail = (uint8_t)((self->r1 + 1u) % capacity);   self->pc = 4;  break;
+      case 4:                                                         /* if (head == tail) is_empty = true */
+         self->r0 = shared->head;
+         if (self->r0 == shared->tail) { self->pc = 5; }
+         else                          { Model_Received(state, self->r2); }
+         break;
+      default: shared->is_empty = 1;         Model_Received(state, self->r2);       break;
+   }
+}
+
+
+/**
+ * @brief Candidate lock-free index math. head and tail count every item ever written and read and only the slot index
+ * wraps, so head - tail is the number of items and no flag is needed. Each counter is only stored by its own thread.
+ */
+static void Model_Counter_Reset(Model_Shared_t * shared);
+static void Model_Counter_Reset(Model_Shared_t * shared)
+{
+   shared->head = 0;
+   shared->tail = 0;
+   shared->is_empty = 0;
+}
+
+static void Model_Counter_Producer_Step(Model_State_t * state, uint8_t capacity);
+static void Model_Counter_Producer_Step(Model_State_t * state, uint8_t capacity)
+{
+   Model_Thread_t * self = &state->producer;
+   Model_Shared_t * shared = &state->shared;
+
+   switch (self->pc)
+   {
+      case 0:
+         self->r1 = shared->tail;
+         if ((uint8_t)(shared->head - self->r1) == capacity) { Model_End_Attempt(self, false); }
+         else                                                { self->pc = 1; }
+         break;
+      case 1:  shared->slots[shared->head % capacity] = self->item;    self->pc = 2;  break;
+      default: shared->head = (uint8_t)(shared->head + 1u);            Model_End_Attempt(self, true);  break;
+   }
+}
+
+static void Model_Counter_Consumer_Step(Model_State_t * state, uint8_t capacity);
+static void Model_Counter_Consumer_Step(Model_State_t * state, uint8_t capacity)
+{
+   Model_Thread_t * self = &state->consumer;
+   Model_Shared_t * shared = &state->shared;
+
+   switch (self->pc)
+   {
+      case 0:
+         self->r0 = shared->head;
+         if (self->r0 == shared->tail) { Model_End_Attempt(self, false); }
+         else                          { self->pc = 1; }
+         break;
+      case 1:  self->r2 = shared->slots[shared->tail % capacity];      self->pc = 2;  break;
+      default: shared->tail = (uint8_t)(shared->tail + 1u);            Model_Received(state, self->r2);  break;
+   }
+}
+
+
+static const Model_Algorithm_t Model_Flag_Algorithm =
+{
+   "flag (Ring_Buffer_Static)", Model_Flag_Reset, Model_Flag_Producer_Step, Model_Flag_Consumer_Step
+};
+
+static const Model_Algorithm_t Model_Counter_Algorithm =
+{
+   "free-running counters", Model_Counter_Reset, Model_Counter_Producer_Step, Model_Counter_Consumer_Step
+};
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------- GUARD REGIONS ---------------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+static Test_Guard RB_Instances_Guard;
+static Test_Guard RB_Instances_In_Use_Guard;
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*----------------------------------------------------------- HELPERS -----------------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Operations of the sequences in part 1.
+ */
+typedef enum
+{
+   MODEL_OP_WRITE,
+   MODEL_OP_READ,
+   MODEL_OP_CLEAR,
+   MODEL_NUMBER_OF_OPS
+} Model_Op_t;
+
+
+/**
+ * @brief Handle of the Module's Ring Buffer. Destroyed in tearDown() whatever happened.
+ */
+static Ring_Buffer_Static_Handle Model_Handle;
+
+
+/**
+ * @brief States the interleaving search already explored. Allocated by the test that searches.
+ */
+static Model_State_t * Model_Visited;
+static uint8_t * Model_Visited_Used;
+static uint32_t Model_Visited_Count;
+
+
+/**
+ * @brief The schedule that led to the state being explored. 'P' = producer step, 'C' = consumer step.
+ */
+static char Model_Schedule[2u * MODEL_MAX_ATTEMPTS * 8u + 1u];
+
+
+/**
+ * @brief Reads an unsigned number from the environment, or returns the default if it is not set.
+ */
+static uint32_t Model_Getenv(const char * name, uint32_t default_value, uint32_t max_value);
+static uint32_t Model_Getenv(const char * name, uint32_t default_value, uint32_t max_value)
+{
+   const char * text = getenv(name);
+   uint32_t value = default_value;
+
+   if ((text) && (*text))
+   {
+      value = (uint32_t)strtoul(text, NULL, 0);
+   }
+
+   return (value > max_value) ? max_value : value;
+}
+
+
+/**
+ * @brief Prints the operation sequence up to and including the failing operation and fails the test.
+ */
+static void Model_Sequence_Fail(const char * what, size_t element_size, uint32_t length, const Model_Op_t * ops, uint32_t failed);
+static void Model_Sequence_Fail(const char * what, size_t element_size, uint32_t length, const Model_Op_t * ops, uint32_t failed)
+{
+   static const char names[MODEL_NUMBER_OF_OPS] = { 'W', 'R', 'C' };
+   static char message[256];
+   char sequence[MODEL_MAX_DEPTH + 1u];
+
+   for (uint32_t i = 0; i <= failed; i++)
+   {
+      sequence[i] = names[ops[i]];
+   }
+   sequence[failed + 1u] = '\0';
+
+   (void)snprintf(message, sizeof(message), "%s. element_size=%u length=%u after sequence %s (W=Write R=Read C=Clear)",
+                  what, (unsigned)element_size, (unsigned)length, sequence);
+   TEST_FAIL_MESSAGE(message);
+}
+
+
+/**
+ * @brief Runs one operation sequence against the Module and a reference FIFO and compares every result.
+ */
+static void Model_Check_Sequence(size_t element_size, uint32_t length, const Model_Op_t * ops, uint32_t depth);
+static void Model_Check_Sequence(size_t element_size, uint32_t length, const Model_Op_t * ops, uint32_t depth)
+{
+   /* Reference FIFO. Element n holds bytes n*element_size ... so every element differs from its neighbours. */
+   uint32_t fifo_written = 0;
+   uint32_t fifo_read = 0;
+   uint8_t element[RING_BUFFER_STATIC_SIZE];
+   uint8_t read[RING_BUFFER_STATIC_SIZE];
+
+   if (!Ring_Buffer_Static_Ctor(&Model_Handle, element_size, length))
+   {
+      Model_Sequence_Fail("Ctor failed", element_size, length, ops, 0);
+   }
+
+   for (uint32_t i = 0; i < depth; i++)
+   {
+      const uint32_t count = fifo_written - fifo_read;
+      bool expected = true;
+      bool actual = true;
+
+      switch (ops[i])
+      {
+         case MODEL_OP_WRITE:
+            for (size_t b = 0; b < element_size; b++)
+            {
+               element[b] = (uint8_t)(fifo_written * element_size + b + 1u);
+            }
+            expected = (count < length);
+            actual = Ring_Buffer_Static_Write(&Model_Handle, element, element_size);
+            fifo_written += (expected) ? 1u : 0u;
+            break;
+
+         case MODEL_OP_READ:
+            for (size_t b = 0; b < element_size; b++)
+            {
+               element[b] = (uint8_t)(fifo_read * element_size + b + 1u);
+            }
+            memset(read, 0, sizeof(read));
+            expected = (count > 0);
+            actual = Ring_Buffer_Static_Read(&Model_Handle, read, element_size);
+            if ((expected) && (actual) && (memcmp(read, element, element_size) != 0))
+            {
+               Model_Sequence_Fail("Read returned the wrong element", element_size, length, ops, i);
+            }
+            fifo_read += (expected) ? 1u : 0u;
+            break;
+
+         default:
+            actual = Ring_Buffer_Static_Clear(&Model_Handle);
+            fifo_read = fifo_written;
+            break;
+      }
+
+      if (actual != expected)
+      {
+         Model_Sequence_Fail((expected) ? "Operation failed" : "Operation succeeded", element_size, length, ops, i);
+      }
+
+      const uint32_t now = fifo_written - fifo_read;
+
+      if ((Ring_Buffer_Static_Get_Number_Of_Elements(&Model_Handle) != now) ||
+          (Ring_Buffer_Static_Is_Empty(&Model_Handle) != (now == 0)) ||
+          (Ring_Buffer_Static_Is_Full(&Model_Handle) != (now == length)))
+      {
+         Model_Sequence_Fail("State queries disagree with the reference", element_size, length, ops, i);
+      }
+   }
+
+   if (!Ring_Buffer_Static_Destroy(&Model_Handle))
+   {
+      Model_Sequence_Fail("Destroy failed", element_size, length, ops, depth - 1u);
+   }
+}
+
+
+/**
+ * @brief Runs one attempt of a thread to completion without the other thread running. Returns if it succeeded.
+ */
+static bool Model_Run_Attempt(Model_State_t * state, const Model_Algorithm_t * algorithm, uint8_t capacity, bool producer);
+static bool Model_Run_Attempt(Model_State_t * state, const Model_Algorithm_t * algorithm, uint8_t capacity, bool producer)
+{
+   Model_Thread_t * thread = (producer) ? &state->producer : &state->consumer;
+   const uint8_t item = thread->item;
+
+   thread->attempts = 1;
+
+   do
+   {
+      if (producer) { algorithm->producer_step(state, capacity); }
+      else          { algorithm->consumer_step(state, capacity); }
+   } while (thread->attempts);
+
+   return (thread->item != item);
+}
+
+
+/**
+ * @brief Runs one operation sequence against the step model of an index math and the reference FIFO, so the step model
+ * is known to behave like the Module when only one thread runs.
+ */
+static void Model_Check_Step_Sequence(const Model_Algorithm_t * algorithm, uint8_t capacity, const Model_Op_t * ops, uint32_t depth);
+static void Model_Check_Step_Sequence(const Model_Algorithm_t * algorithm, uint8_t capacity, const Model_Op_t * ops, uint32_t depth)
+{
+   Model_State_t state;
+
+   memset(&state, 0, sizeof(state));
+   algorithm->reset(&state.shared);
+   state.producer.item = 1;
+   state.consumer.item = 1;
+
+   for (uint32_t i = 0; i < depth; i++)
+   {
+      const uint32_t count = (uint32_t)(state.producer.item - state.consumer.item);
+
+      if (ops[i] == MODEL_OP_WRITE)
+      {
+         if (Model_Run_Attempt(&state, algorithm, capacity, true) != (count < capacity))
+         {
+            Model_Sequence_Fail(algorithm->name, 1, capacity, ops, i);
+         }
+      }
+      else if (ops[i] == MODEL_OP_READ)
+      {
+         if ((Model_Run_Attempt(&state, algorithm, capacity, false) != (count > 0)) || (state.violation))
+         {
+            Model_Sequence_Fail(algorithm->name, 1, capacity, ops, i);
+         }
+      }
+      else
+      {
+         algorithm->reset(&state.shared);
+         state.consumer.item = state.producer.item;
+      }
+   }
+}
+
+
+/**
+ * @brief Calls check for every sequence of depth operations. The sequence is counted up like a base-3 number.
+ */
+static uint32_t Model_For_Each_Sequence(uint32_t depth, void (*check)(const Model_Op_t * ops, uint32_t depth, const void * context),
+                                        const void * context);
+static uint32_t Model_For_Each_Sequence(uint32_t depth, void (*check)(const Model_Op_t * ops, uint32_t depth, const void * context),
+                                        const void * context)
+{
+   Model_Op_t ops[MODEL_MAX_DEPTH];
+   uint32_t sequences = 0;
+   uint32_t digit = 0;
+
+   memset(ops, 0, sizeof(ops));
+
+   while (digit < depth)
+   {
+      check(ops, depth, context);
+      sequences++;
+
+      for (digit = 0; digit < depth; digit++)
+      {
+         ops[digit] = (Model_Op_t)(ops[digit] + 1);
+
+         if (ops[digit] < MODEL_NUMBER_OF_OPS)
+         {
+            break;
+         }
+         ops[digit] = MODEL_OP_WRITE;
+      }
+   }
+
+   return sequences;
+}
+
+
+/**
+ * @brief Adapters from Model_For_Each_Sequence() to the two sequence checks.
+ */
+typedef struct
+{
+   size_t element_size;
+   uint32_t length;
+} Model_Shape_t;
+
+static void Model_Check_Module(const Model_Op_t * ops, uint32_t depth, const void * context);
+static void Model_Check_Module(const Model_Op_t * ops, uint32_t depth, const void * context)
+{
+   const Model_Shape_t * shape = (const Model_Shape_t *)context;
+   Model_Check_Sequence(shape->element_size, shape->length, ops, depth);
+}
+
+typedef struct
+{
+   const Model_Algorithm_t * algorithm;
+   uint8_t capacity;
+} Model_Step_Shape_t;
+
+static void Model_Check_Step_Model(const Model_Op_t * ops, uint32_t depth, const void * context);
+static void Model_Check_Step_Model(const Model_Op_t * ops, uint32_t depth, const void * context)
+{
+   const Model_Step_Shape_t * shape = (const Model_Step_Shape_t *)context;
+   Model_Check_Step_Sequence(shape->algorithm, shape->capacity, ops, depth);
+}
+
+
+/**
+ * @brief Adds a state to the visited set. Returns false if it was already there.
+ */
+static bool Model_Visit(const Model_State_t * state);
+static bool Model_Visit(const Model_State_t * state)
+{
+   const uint8_t * bytes = (const uint8_t *)state;
+   uint32_t hash = 2166136261u;                    /* FNV-1a */
+
+   for (size_t i = 0; i < sizeof(*state); i++)
+   {
+      hash = (hash ^ bytes[i]) * 16777619u;
+   }
+
+   for (uint32_t slot = hash & (MODEL_VISITED_CAPACITY - 1u); ; slot = (slot + 1u) & (MODEL_VISITED_CAPACITY - 1u))
+   {
+      if (!Model_Visited_Used[slot])
+      {
+         TEST_ASSERT_TRUE_MESSAGE(Model_Visited_Count < (MODEL_VISITED_CAPACITY / 2u), "Scope too large for MODEL_VISITED_CAPACITY");
+         Model_Visited[slot] = *state;
+         Model_Visited_Used[slot] = 1;
+         Model_Visited_Count++;
+         return true;
+      }
+
+      if (memcmp(&Model_Visited[slot], state, sizeof(*state)) == 0)
+      {
+         return false;
+      }
+   }
+}
+
+
+/**
+ * @brief Checks a state where both threads are done. The items written but not read must still be in the Ring Buffer,
+ * in order, and after reading them it must take exactly capacity Writes to fill it. Returns the reason it is wrong.
+ */
+static const char * Model_Check_Final(const Model_State_t * final_state, const Model_Algorithm_t * algorithm, uint8_t capacity);
+static const char * Model_Check_Final(const Model_State_t * final_state, const Model_Algorithm_t * algorithm, uint8_t capacity)
+{
+   Model_State_t state = *final_state;
+   const char * reason = NULL;
+
+   while ((!reason) && (Model_Run_Attempt(&state, algorithm, capacity, false)))
+   {
+      reason = (state.violation) ? "drained an item out of order" : NULL;
+   }
+
+   if ((!reason) && (state.consumer.item != state.producer.item))
+   {
+      reason = "items written were lost";
+   }
+
+   for (uint8_t i = 0; (!reason) && (i < capacity); i++)
+   {
+      reason = (Model_Run_Attempt(&state, algorithm, capacity, true)) ? NULL : "Full before capacity items";
+   }
+
+   if ((!reason) && (Model_Run_Attempt(&state, algorithm, capacity, true)))
+   {
+      reason = "not Full after capacity items";
+   }
+
+   return reason;
+}
+
+
+/**
+ * @brief Depth-first search over every interleaving of the two threads from state. Stops at the first violation and
+ * leaves its schedule in Model_Schedule. Returns the violation, or NULL.
+ */
+static const char * Model_Search(const Model_State_t * state, const Model_Algorithm_t * algorithm, uint8_t capacity, uint32_t depth);
+static const char * Model_Search(const Model_State_t * state, const Model_Algorithm_t * algorithm, uint8_t capacity, uint32_t depth)
+{
+   const char * reason = NULL;
+
+   Model_Schedule[depth] = '\0';
+
+   if (state->violation)
+   {
+      reason = "read an item out of order";
+   }
+   else if (!Model_Visit(state))
+   {
+      /* Explored from another schedule already. */
+   }
+   else if ((!state->producer.attempts) && (!state->consumer.attempts))
+   {
+      reason = Model_Check_Final(state, algorithm, capacity);
+   }
+   else
+   {
+      TEST_ASSERT_TRUE_MESSAGE(depth + 1u < sizeof(Model_Schedule), "Schedule longer than Model_Schedule");
+
+      if (state->producer.attempts)
+      {
+         Model_State_t next = *state;
+         algorithm->producer_step(&next, capacity);
+         Model_Schedule[depth] = 'P';
+         reason = Model_Search(&next, algorithm, capacity, depth + 1u);
+      }
+
+      if ((!reason) && (state->consumer.attempts))
+      {
+         Model_State_t next = *state;
+         algorithm->consumer_step(&next, capacity);
+         Model_Schedule[depth] = 'C';
+         reason = Model_Search(&next, algorithm, capacity, depth + 1u);
+      }
+   }
+
+   return reason;
+}
+
+
+/**
+ * @brief Explores every interleaving for one capacity. Returns the violation found, or NULL. The number of states
+ * explored is added to states.
+ */
+static const char * Model_Check_Interleavings(const Model_Algorithm_t * algorithm, uint8_t capacity, uint32_t * states);
+static const char * Model_Check_Interleavings(const Model_Algorithm_t * algorithm, uint8_t capacity, uint32_t * states)
+{
+   Model_State_t initial;
+
+   memset(&initial, 0, sizeof(initial));
+   algorithm->reset(&initial.shared);
+   initial.producer.item = 1;
+   initial.consumer.item = 1;
+   initial.producer.attempts = (uint8_t)Model_Getenv("RB_MODEL_WRITES", MODEL_DEFAULT_WRITES, MODEL_MAX_ATTEMPTS);
+   initial.consumer.attempts = (uint8_t)Model_Getenv("RB_MODEL_READS", MODEL_DEFAULT_READS, MODEL_MAX_ATTEMPTS);
+
+   memset(Model_Visited_Used, 0, MODEL_VISITED_CAPACITY);
+   Model_Visited_Count = 0;
+
+   const char * reason = Model_Search(&initial, algorithm, capacity, 0);
+
+   *states += Model_Visited_Count;
+   return reason;
+}
+
+
+/**
+ * @brief Runs every sequence check of part 1 for the step model of an index math.
+ */
+static uint32_t Model_Check_Step_Model_Sequences(const Model_Algorithm_t * algorithm);
+static uint32_t Model_Check_Step_Model_Sequences(const Model_Algorithm_t * algorithm)
+{
+   const uint32_t depth = Model_Getenv("RB_MODEL_DEPTH", MODEL_DEFAULT_DEPTH, MODEL_MAX_DEPTH);
+   uint32_t sequences = 0;
+
+   for (uint8_t capacity = 1; capacity <= MODEL_MAX_CAPACITY; capacity++)
+   {
+      const Model_Step_Shape_t shape = { algorithm, capacity };
+      sequences += Model_For_Each_Sequence(depth, Model_Check_Step_Model, &shape);
+   }
+
+   return sequences;
+}
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------- RUNS AT THE START AND END OF EACH TEST --------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+void setUp(void)
+{
+   Test_Guard_Init(&RB_Instances_Guard, "RB_Instances[]", &Test_RB_Instances_Memory_Region[0], Test_RB_Instances_Mem_Size,
+                   CLASS_POOL_MEMORY_EXTENSION_BYTES, RB_INSTANCES_PREPOSTPEND_VALUES);
+   Test_Guard_Init(&RB_Instances_In_Use_Guard, "RB_Instances_In_Use[]", &Test_RB_Instances_In_Use_Memory_Region[0], Test_RB_Instances_In_Use_Mem_Size,
+                   CLASS_POOL_IN_USE_MEMORY_EXTENSION_BYTES, RB_INSTANCES_IN_USE_PREPOSTPEND_VALUES);
+   Test_Guard_Arm(&RB_Instances_Guard);
+   Test_Guard_Arm(&RB_Instances_In_Use_Guard);
+
+   Model_Handle = 0;
+   Model_Visited = (Model_State_t *)calloc(MODEL_VISITED_CAPACITY, sizeof(Model_State_t));
+   Model_Visited_Used = (uint8_t *)calloc(MODEL_VISITED_CAPACITY, sizeof(uint8_t));
+   TEST_ASSERT_NOT_NULL(Model_Visited);
+   TEST_ASSERT_NOT_NULL(Model_Visited_Used);
+}
+
+void tearDown(void)
+{
+   (void)Ring_Buffer_Static_Destroy(&Model_Handle);
+
+   free(Model_Visited);
+   free(Model_Visited_Used);
+   Model_Visited = NULL;
+   Model_Visited_Used = NULL;
+
+   Test_Guard_Release(&RB_Instances_Guard);
+   Test_Guard_Release(&RB_Instances_In_Use_Guard);
+   memset((void *)&Test_RB_Instances_Memory_Region[0], 0, Test_RB_Instances_Mem_Size);
+   memset((void *)&Test_RB_Instances_In_Use_Memory_Region[0], 0, Test_RB_Instances_In_Use_Mem_Size);
+}
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------------------- UNIT TESTS BEGIN -----------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Part 1 for the Module: every sequence up to RB_MODEL_DEPTH for element sizes 1, 2 and 3 and lengths 1 to
+ * MODEL_MAX_CAPACITY, plus the largest Ring Buffer so the byte offsets reach RING_BUFFER_STATIC_SIZE.
+ */
+static void Test_Ring_Buffer_Static_Model_Sequences(void);
+static void Test_Ring_Buffer_Static_Model_Sequences(void)
+{
+   const uint32_t depth = Model_Getenv("RB_MODEL_DEPTH", MODEL_DEFAULT_DEPTH, MODEL_MAX_DEPTH);
+   uint32_t sequences = 0;
+   char message[96];
+
+   for (size_t element_size = 1; element_size <= 3; element_size++)
+   {
+      for (uint32_t length = 1; length <= MODEL_MAX_CAPACITY; length++)
+      {
+         const Model_Shape_t shape = { element_size, length };
+         sequences += Model_For_Each_Sequence(depth, Model_Check_Module, &shape);
+      }
+   }
+
+   const Model_Shape_t largest = { RING_BUFFER_STATIC_SIZE / 2u, 2u };
+   sequences += Model_For_Each_Sequence(depth, Model_Check_Module, &largest);
+
+   TEST_ASSERT_GUARD_INTACT(&RB_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RB_Instances_In_Use_Guard);
+
+   (void)snprintf(message, sizeof(message), "%u sequences of depth %u", (unsigned)sequences, (unsigned)depth);
+   TEST_MESSAGE(message);
+}
+
+
+/**
+ * @brief Part 1 for the step models: both behave like the reference FIFO when only one thread runs at a time.
+ */
+static void Test_Ring_Buffer_Static_Model_Step_Models_Match_Sequences(void);
+static void Test_Ring_Buffer_Static_Model_Step_Models_Match_Sequences(void)
+{
+   TEST_ASSERT_NOT_EQUAL(0, Model_Check_Step_Model_Sequences(&Model_Flag_Algorithm));
+   TEST_ASSERT_NOT_EQUAL(0, Model_Check_Step_Model_Sequences(&Model_Counter_Algorithm));
+}
+
+
+/**
+ * @brief Part 2 for the Module's index math. Without a lock, a Read that finds head == tail can set is_empty AFTER a
+ * concurrent Write cleared it, and the item written is lost. The search must find such a schedule.
+ */
+static void Test_Ring_Buffer_Static_Model_Flag_Needs_Lock(void);
+static void Test_Ring_Buffer_Static_Model_Flag_Needs_Lock(void)
+{
+   const char * reason = NULL;
+   uint32_t states = 0;
+   static char message[256];
+
+   for (uint8_t capacity = 1; (capacity <= MODEL_MAX_CAPACITY) && (!reason); capacity++)
+   {
+      reason = Model_Check_Interleavings(&Model_Flag_Algorithm, capacity, &states);
+
+      if (reason)
+      {
+         (void)snprintf(message, sizeof(message), "%s: capacity %u %s with schedule %s (P=producer C=consumer step)",
+                        Model_Flag_Algorithm.name, (unsigned)capacity, reason, Model_Schedule);
+         TEST_MESSAGE(message);
+      }
+   }
+
+   TEST_ASSERT_NOT_NULL_MESSAGE(reason, "Expected an interleaving that breaks the unlocked flag index math");
+}
+
+
+/**
+ * @brief Part 2 for the lock-free candidate: no interleaving of producer and consumer breaks it.
+ */
+static void Test_Ring_Buffer_Static_Model_Counter_Interleavings(void);
+static void Test_Ring_Buffer_Static_Model_Counter_Interleavings(void)
+{
+   uint32_t states = 0;
+   static char message[256];
+
+   for (uint8_t capacity = 1; capacity <= MODEL_MAX_CAPACITY; capacity++)
+   {
+      const char * reason = Model_Check_Interleavings(&Model_Counter_Algorithm, capacity, &states);
+
+      if (reason)
+      {
+         (void)snprintf(message, sizeof(message), "%s: capacity %u %s with schedule %s (P=producer C=consumer step)",
+                        Model_Counter_Algorithm.name, (unsigned)capacity, reason, Model_Schedule);
+         TEST_FAIL_MESSAGE(message);
+      }
+   }
+
+   (void)snprintf(message, sizeof(message), "%u states explored", (unsigned)states);
+   TEST_MESSAGE(message);
+}
+
+
+
+
+int main(void)
+{
+   UNITY_BEGIN();
+   RUN_TEST(Test_Ring_Buffer_Static_Model_Sequences);
+   RUN_TEST(Test_Ring_Buffer_Static_Model_Step_Models_Match_Sequences);
+   RUN_TEST(Test_Ring_Buffer_Static_Model_Flag_Needs_Lock);
+   RUN_TEST(Test_Ring_Buffer_Static_Model_Counter_Interleavings);
+   return UNITY_END();
+}
@@ -0,0 +1,540 @@
+/**
+ * @file test_ring_buffer_static_stress.c
+ * @author agent
+ * @brief Randomized stress test for the Static Ring Buffer module. Runs a random interleaving of Ctor, Destroy, Clear,
+ * Write and Read across every pre-allocated Ring Buffer and checks each result against a simple reference model of the
+ * pool and of every Buffer's contents. The sequence is generated from a single seed that is printed before the run,
+ * so a failing run can be replayed exactly:
+ *
+ * RB_STRESS_SEED=<seed>       Replays the run printed by an earlier run. Defaults to a seed taken from the clock.
+ * RB_STRESS_OPS=<count>       Number of operations to run. Defaults to STRESS_DEFAULT_OPS.
+ * RB_STRESS_SECONDS=<seconds> Runs for this long instead of a fixed number of operations.
+ *
+ * Long runs built with make FORK=1 have to disable the Unity/extras/fork timeout. I.e.
+ * RB_STRESS_SECONDS=600 UNITY_FORK_TIMEOUT_MS=0 ./builds/test_ring_buffer_static_stress.out
+ *
+ * The operation throughput is printed after the run so performance regressions show up in long runs too.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#define _POSIX_C_SOURCE 200809L     /* clock_gettime */
+
+/* STD-C Libraries */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>      /* snprintf */
+#include <stdlib.h>     /* getenv, strtoull */
+#include <string.h>     /* memset, memcmp, size_t */
+#include <time.h>       /* time, clock_gettime */
+
+/* Unit Test Framework */
+#include "unity.h"
+
+/* Unit Test Support */
+#include "test_guard.h"
+
+/* Module Under Test */
+#include "ring_buffer_static.h"
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------- UNIT TEST SETUP VALUES ------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Guard Region patterns. Same meaning as in test_ring_buffer_static.c.
+ */
+#define RB_INSTANCES_PREPOSTPEND_VALUES                           0x33
+#define RB_INSTANCES_IN_USE_PREPOSTPEND_VALUES                    0x44
+#define READ_DATA_PREPOSTPEND_VALUE                               0x67
+
+
+/**
+ * @brief Number of operations run when neither RB_STRESS_OPS nor RB_STRESS_SECONDS is set. Small enough to keep
+ * make test fast, large enough to wrap every Buffer many times.
+ */
+#define STRESS_DEFAULT_OPS                                        2000000ULL
+
+
+/**
+ * @brief One more Handle than there are pre-allocated Ring Buffers so the Constructor also runs out of Buffers.
+ */
+#define STRESS_NUMBER_OF_HANDLES                                  (NUMBER_OF_STATIC_RING_BUFFERS + 1)
+
+
+/**
+ * @brief The Guard Regions are scanned every this many operations (power of 2) and once more at the end. The clock
+ * is also only read this often when running for RB_STRESS_SECONDS.
+ */
+#define STRESS_CHECK_INTERVAL                                     65536ULL
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*----------------------------------------------------- REFERENCE MODEL ---------------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief A Ring Buffer Handle and the model of the Buffer it is expected to own. The model is a plain byte FIFO
+ * that shares nothing with the Module Under Test.
+ */
+typedef struct
+{
+   Ring_Buffer_Static_Handle me;                   /* Public Handle used by normal Application. */
+   bool constructed;                               /* Expected to own a Ring Buffer. */
+   uint32_t pool_index;                            /* Expected value of me while constructed. */
+   size_t element_size;
+   size_t capacity;                                /* Number of Bytes */
+   size_t head;                                    /* Model FIFO. Index of the oldest Byte. */
+   size_t count;                                   /* Number of Bytes stored. */
+   bool filling;                                   /* Writes are favoured until full, then Reads until empty. */
+   uint8_t data[RING_BUFFER_STATIC_SIZE];
+} Stress_Handle_t;
+
+
+/**
+ * @brief The Handles and the expected state of the pre-allocated pool.
+ */
+static Stress_Handle_t Stress_Handles[STRESS_NUMBER_OF_HANDLES];
+static bool Stress_Pool_In_Use[NUMBER_OF_STATIC_RING_BUFFERS];
+
+
+/**
+ * @brief What is printed when a check fails: the seed, the operation number and the Handle being operated on.
+ */
+static uint64_t Stress_Seed;
+static uint64_t Stress_Op;
+static uint32_t Stress_Handle_Index;
+
+
+/**
+ * @brief State of the xorshift64* generator. A local generator, unlike rand(), gives the same sequence for a seed
+ * on every C library.
+ */
+static uint64_t Stress_Rng_State;
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------- GUARD REGIONS ---------------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+static Test_Guard RB_Instances_Guard;
+static Test_Guard RB_Instances_In_Use_Guard;
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*----------------------------------------------------------- HELPERS -----------------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Seeds the generator. The seed is mixed (splitmix64) so that small and similar seeds give unrelated sequences
+ * and a seed of 0 is valid.
+ */
+static void Stress_Rng_Seed(uint64_t seed);
+static void Stress_Rng_Seed(uint64_t seed)
+{
+   uint64_t z = seed + 0x9E3779B97F4A7C15ULL;
+   z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+   z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+   z = z ^ (z >> 31);
+   Stress_Rng_State = (z) ? z : 1;
+}
+
+
+static inline uint64_t Stress_Rng_Next(void);
+static inline uint64_t Stress_Rng_Next(void)
+{
+   Stress_Rng_State ^= Stress_Rng_State >> 12;
+   Stress_Rng_State ^= Stress_Rng_State << 25;
+   Stress_Rng_State ^= Stress_Rng_State >> 27;
+   return Stress_Rng_State * 0x2545F4914F6CDD1DULL;
+}
+
+
+/**
+ * @brief Returns a random number in [0, bound). The upper bits are used since they are the best mixed.
+ */
+static inline uint32_t Stress_Rng_Below(uint32_t bound);
+static inline uint32_t Stress_Rng_Below(uint32_t bound)
+{
+   return (uint32_t)(((Stress_Rng_Next() >> 32) * bound) >> 32);
+}
+
+
+/**
+ * @brief Monotonic clock in nanoseconds for RB_STRESS_SECONDS and the throughput printed after the run.
+ */
+static uint64_t Stress_Clock_Ns(void);
+static uint64_t Stress_Clock_Ns(void)
+{
+   struct timespec now;
+
+   (void)clock_gettime(CLOCK_MONOTONIC, &now);
+   return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+
+/**
+ * @brief Reads an unsigned number (decimal or 0x hex) from the environment. Returns false if it is not set.
+ */
+static bool Stress_Getenv_U64(const char * name, uint64_t * value);
+static bool Stress_Getenv_U64(const char * name, uint64_t * value)
+{
+   const char * text = getenv(name);
+   bool found = false;
+
+   if ((text) && (*text))
+   {
+      *value = (uint64_t)strtoull(text, NULL, 0);
+      found = true;
+   }
+
+   return found;
+}
+
+
+/**
+ * @brief Fails the Test naming the seed, operation and Handle so the failure can be replayed with RB_STRESS_SEED
+ * and RB_STRESS_OPS.
+ */
+static void Stress_Fail(const char * what);
+static void Stress_Fail(const char * what)
+{
+   static char message[256];
+
+   (void)snprintf(message, sizeof(message), "%s. Handle %u at op %llu. Replay with RB_STRESS_SEED=%llu RB_STRESS_OPS=%llu",
+                  what, (unsigned)Stress_Handle_Index, (unsigned long long)Stress_Op, (unsigned long long)Stress_Seed,
+                  (unsigned long long)(Stress_Op + 1));
+   TEST_FAIL_MESSAGE(message);
+}
+
+
+#define STRESS_CHECK(condition, what)     do { if (!(condition)) { Stress_Fail(what); } } while (0)
+
+
+/**
+ * @brief Verifies the state queries of a Handle agree with the model. An invalid Handle is empty-false, full-true
+ * and holds no elements, the same as the Module reports for any invalid Handle.
+ */
+static void Stress_Check_State(const Stress_Handle_t * handle);
+static void Stress_Check_State(const Stress_Handle_t * handle)
+{
+   const Ring_Buffer_Static_Handle * me = &handle->me;
+   const bool empty = (handle->constructed) && (handle->count == 0);
+   const bool full = (!handle->constructed) || (handle->count == handle->capacity);
+   const uint32_t elements = (handle->constructed) ? (uint32_t)(handle->count / handle->element_size) : 0;
+
+   STRESS_CHECK(Ring_Buffer_Static_Is_Empty(me) == empty, "Is_Empty disagrees with the model");
+   STRESS_CHECK(Ring_Buffer_Static_Is_Full(me) == full, "Is_Full disagrees with the model");
+   STRESS_CHECK(Ring_Buffer_Static_Get_Number_Of_Elements(me) == elements, "Get_Number_Of_Elements disagrees with the model");
+}
+
+
+/**
+ * @brief Constructs the Handle with random parameters. One in sixteen calls uses invalid parameters. Element sizes
+ * favour small elements so Buffers hold many of them and wrap often.
+ */
+static void Stress_Ctor(Stress_Handle_t * handle);
+static void Stress_Ctor(Stress_Handle_t * handle)
+{
+   size_t element_size = (Stress_Rng_Below(8) == 0) ? Stress_Rng_Below(RING_BUFFER_STATIC_SIZE) + 1 : Stress_Rng_Below(8) + 1;
+   uint32_t number_of_elements = Stress_Rng_Below((uint32_t)(RING_BUFFER_STATIC_SIZE / element_size)) + 1;
+
+   if (Stress_Rng_Below(16) == 0)
+   {
+      switch (Stress_Rng_Below(3))
+      {
+         case 0:  element_size = 0; break;
+         case 1:  number_of_elements = 0; break;
+         default: number_of_elements = (uint32_t)(RING_BUFFER_STATIC_SIZE / element_size) + 1; break;
+      }
+   }
+
+   /* The Constructor reserves the first free Buffer in the pool. */
+   const bool valid_parameters = (element_size) && (number_of_elements) && (element_size * number_of_elements <= RING_BUFFER_STATIC_SIZE);
+   uint32_t free_index = NUMBER_OF_STATIC_RING_BUFFERS;
+
+   for (uint32_t i = 0; i < NUMBER_OF_STATIC_RING_BUFFERS; i++)
+   {
+      if (!Stress_Pool_In_Use[i])
+      {
+         free_index = i;
+         break;
+      }
+   }
+
+   const bool expected = (!handle->constructed) && (valid_parameters) && (free_index < NUMBER_OF_STATIC_RING_BUFFERS);
+
+   STRESS_CHECK(Ring_Buffer_Static_Ctor(&handle->me, element_size, number_of_elements) == expected, "Ctor result disagrees with the model");
+
+   if (expected)
+   {
+      STRESS_CHECK(handle->me == free_index, "Ctor did not reserve the first free Buffer");
+      Stress_Pool_In_Use[free_index] = true;
+      handle->constructed = true;
+      handle->pool_index = free_index;
+      handle->element_size = element_size;
+      handle->capacity = element_size * number_of_elements;
+      handle->head = 0;
+      handle->count = 0;
+      handle->filling = true;
+   }
+}
+
+
+static void Stress_Destroy(Stress_Handle_t * handle);
+static void Stress_Destroy(Stress_Handle_t * handle)
+{
+   STRESS_CHECK(Ring_Buffer_Static_Destroy(&handle->me) == handle->constructed, "Destroy result disagrees with the model");
+
+   if (handle->constructed)
+   {
+      Stress_Pool_In_Use[handle->pool_index] = false;
+      handle->constructed = false;
+   }
+}
+
+
+static void Stress_Clear(Stress_Handle_t * handle);
+static void Stress_Clear(Stress_Handle_t * handle)
+{
+   STRESS_CHECK(Ring_Buffer_Static_Clear(&handle->me) == handle->constructed, "Clear result disagrees with the model");
+   handle->head = 0;
+   handle->count = 0;
+   handle->filling = true;
+}
+
+
+/**
+ * @brief Writes one element of random bytes. One in sixty-four calls passes the wrong element size, which has to
+ * fail without changing the Buffer.
+ */
+static void Stress_Write(Stress_Handle_t * handle);
+static void Stress_Write(Stress_Handle_t * handle)
+{
+   uint8_t write_data[RING_BUFFER_STATIC_SIZE + 1];
+   size_t data_size = (handle->constructed) ? handle->element_size : Stress_Rng_Below(RING_BUFFER_STATIC_SIZE) + 1;
+
+   if (Stress_Rng_Below(64) == 0)
+   {
+      data_size = (data_size == 1) ? 2 : data_size - 1;
+   }
+
+   for (size_t i = 0; i < data_size; i += sizeof(uint64_t))
+   {
+      const uint64_t random = Stress_Rng_Next();
+      memcpy(&write_data[i], &random, ((data_size - i) < sizeof(uint64_t)) ? (data_size - i) : sizeof(uint64_t));
+   }
+
+   const bool expected = (handle->constructed) && (handle->count < handle->capacity) && (data_size == handle->element_size);
+
+   STRESS_CHECK(Ring_Buffer_Static_Write(&handle->me, (const void *)write_data, data_size) == expected,
+                "Write result disagrees with the model");
+
+   if (expected)
+   {
+      for (size_t i = 0; i < data_size; i++)
+      {
+         handle->data[(handle->head + handle->count + i) % handle->capacity] = write_data[i];
+      }
+      handle->count += data_size;
+   }
+}
+
+
+/**
+ * @brief Reads one element and compares it with the oldest element of the model. One in sixty-four calls passes
+ * the wrong element size, which has to fail without changing the Buffer or the read data.
+ */
+static void Stress_Read(Stress_Handle_t * handle);
+static void Stress_Read(Stress_Handle_t * handle)
+{
+   uint8_t read_data[RING_BUFFER_STATIC_SIZE + 1];
+   uint8_t expected_data[RING_BUFFER_STATIC_SIZE];
+   size_t data_size = (handle->constructed) ? handle->element_size : Stress_Rng_Below(RING_BUFFER_STATIC_SIZE) + 1;
+
+   if (Stress_Rng_Below(64) == 0)
+   {
+      data_size = (data_size == 1) ? 2 : data_size - 1;
+   }
+
+   /* The extra Byte past the element catches Reads that copy too much. */
+   memset(read_data, READ_DATA_PREPOSTPEND_VALUE, data_size + 1);
+
+   const bool expected = (handle->constructed) && (handle->count) && (data_size == handle->element_size);
+
+   STRESS_CHECK(Ring_Buffer_Static_Read(&handle->me, (void *)read_data, data_size) == expected, "Read result disagrees with the model");
+   STRESS_CHECK(read_data[data_size] == READ_DATA_PREPOSTPEND_VALUE, "Read wrote past the end of the element");
+
+   if (expected)
+   {
+      for (size_t i = 0; i < data_size; i++)
+      {
+         expected_data[i] = handle->data[(handle->head + i) % handle->capacity];
+      }
+      handle->head = (handle->head + data_size) % handle->capacity;
+      handle->count -= data_size;
+
+      STRESS_CHECK(memcmp(read_data, expected_data, data_size) == 0, "Read returned different data than was written");
+   }
+   else
+   {
+      for (size_t i = 0; i < data_size; i++)
+      {
+         STRESS_CHECK(read_data[i] == READ_DATA_PREPOSTPEND_VALUE, "Failed Read modified the read data");
+      }
+   }
+}
+
+
+/**
+ * @brief Runs one random operation on a random Handle and verifies the Handle's state afterwards. Writes and Reads
+ * make up most operations. Each Handle favours Writes until its Buffer is full and then Reads until it is empty, so
+ * Buffers spend time at both boundaries instead of hovering near empty.
+ */
+static void Stress_Step(void);
+static void Stress_Step(void)
+{
+   const uint32_t choice = Stress_Rng_Below(128);
+   Stress_Handle_Index = Stress_Rng_Below(STRESS_NUMBER_OF_HANDLES);
+   Stress_Handle_t * handle = &Stress_Handles[Stress_Handle_Index];
+
+   if (choice < 120)
+   {
+      const bool write = (Stress_Rng_Below(4) == 0) ? !handle->filling : handle->filling;
+
+      if (write)
+      {
+         Stress_Write(handle);
+      }
+      else
+      {
+         Stress_Read(handle);
+      }
+
+      if ((handle->count == 0) || (handle->count == handle->capacity))
+      {
+         handle->filling = (handle->count == 0);
+      }
+   }
+   else if (choice < 123)
+   {
+      Stress_Ctor(handle);
+   }
+   else if (choice < 126)
+   {
+      Stress_Destroy(handle);
+   }
+   else
+   {
+      Stress_Clear(handle);
+   }
+
+   Stress_Check_State(handle);
+}
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------- RUNS AT THE START AND END OF EACH TEST --------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+void setUp(void)
+{
+   Test_Guard_Init(&RB_Instances_Guard, "RB_Instances[]", &Test_RB_Instances_Memory_Region[0], Test_RB_Instances_Mem_Size,
+                   CLASS_POOL_MEMORY_EXTENSION_BYTES, RB_INSTANCES_PREPOSTPEND_VALUES);
+   Test_Guard_Init(&RB_Instances_In_Use_Guard, "RB_Instances_In_Use[]", &Test_RB_Instances_In_Use_Memory_Region[0], Test_RB_Instances_In_Use_Mem_Size,
+                   CLASS_POOL_IN_USE_MEMORY_EXTENSION_BYTES, RB_INSTANCES_IN_USE_PREPOSTPEND_VALUES);
+   Test_Guard_Arm(&RB_Instances_Guard);
+   Test_Guard_Arm(&RB_Instances_In_Use_Guard);
+
+   memset((void *)Stress_Handles, 0, sizeof(Stress_Handles));
+   memset((void *)Stress_Pool_In_Use, 0, sizeof(Stress_Pool_In_Use));
+}
+
+void tearDown(void)
+{
+   for (uint32_t i = 0; i < STRESS_NUMBER_OF_HANDLES; i++)
+   {
+      (void)Ring_Buffer_Static_Destroy((const Ring_Buffer_Static_Handle *)&(Stress_Handles[i].me));
+   }
+
+   Test_Guard_Release(&RB_Instances_Guard);
+   Test_Guard_Release(&RB_Instances_In_Use_Guard);
+   memset((void *)&Test_RB_Instances_Memory_Region[0], 0, Test_RB_Instances_Mem_Size);
+   memset((void *)&Test_RB_Instances_In_Use_Memory_Region[0], 0, Test_RB_Instances_In_Use_Mem_Size);
+}
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------------------- UNIT TESTS BEGIN -----------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Runs the random operation sequence for RB_STRESS_SEED. Prints the seed first so it is known even if the
+ * run crashes, and the throughput last.
+ */
+static void Test_Ring_Buffer_Static_Stress(void);
+static void Test_Ring_Buffer_Static_Stress(void)
+{
+   uint64_t ops = STRESS_DEFAULT_OPS;
+   uint64_t seconds = 0;
+   char message[128];
+
+   if (!Stress_Getenv_U64("RB_STRESS_SEED", &Stress_Seed))
+   {
+      Stress_Seed = (uint64_t)time(NULL) ^ Stress_Clock_Ns();
+   }
+   (void)Stress_Getenv_U64("RB_STRESS_OPS", &ops);
+   (void)Stress_Getenv_U64("RB_STRESS_SECONDS", &seconds);
+
+   (void)snprintf(message, sizeof(message), "RB_STRESS_SEED=%llu", (unsigned long long)Stress_Seed);
+   TEST_MESSAGE(message);
+   Stress_Rng_Seed(Stress_Seed);
+
+   const uint64_t start_ns = Stress_Clock_Ns();
+   const uint64_t deadline_ns = start_ns + (seconds * 1000000000ULL);
+   bool running = true;
+
+   for (Stress_Op = 0; running; Stress_Op++)
+   {
+      Stress_Step();
+
+      if (((Stress_Op + 1) & (STRESS_CHECK_INTERVAL - 1)) == 0)
+      {
+         TEST_ASSERT_GUARD_INTACT(&RB_Instances_Guard);
+         TEST_ASSERT_GUARD_INTACT(&RB_Instances_In_Use_Guard);
+         running = (seconds) ? (Stress_Clock_Ns() < deadline_ns) : running;
+      }
+
+      running = (seconds) ? running : (Stress_Op + 1 < ops);
+   }
+
+   const uint64_t elapsed_ns = Stress_Clock_Ns() - start_ns;
+
+   TEST_ASSERT_GUARD_INTACT(&RB_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RB_Instances_In_Use_Guard);
+
+   (void)snprintf(message, sizeof(message), "%llu ops in %llu ms, %.0f ops/s", (unsigned long long)Stress_Op,
+                  (unsigned long long)(elapsed_ns / 1000000u), (elapsed_ns) ? ((double)Stress_Op * 1e9 / (double)elapsed_ns) : 0.0);
+   TEST_MESSAGE(message);
+}
+
+
+
+
+int main(void)
+{
+   UNITY_BEGIN();
+   RUN_TEST(Test_Ring_Buffer_Static_Stress);
+   return UNITY_END();
+}
@@ -0,0 +1,513 @@
+/**
+ * @file test_ring_buffer_static_threads.c
+ * @author agent
+ * @brief Multithreaded stress driver for the Static Ring Buffer module. The Ring Buffer itself is not thread-safe, so
+ * threads sharing one serialize every call with a mutex, the way the Application has to. Producers write sequence
+ * numbers tagged with their id and consumers check that every item of every producer arrives exactly once and in the
+ * order it was written. Threads that each own a different Ring Buffer do not lock at all, which is only correct as
+ * long as the Ring Buffers share no state.
+ *
+ * The tests pass in every profile but are meant for the tsan profile, which reports any access the locking does not
+ * cover:
+ * cd tests && make clean && make test PROFILE=tsan
+ *
+ * The start flag and the counters shared by the threads use the __atomic builtins, like the contention Benchmarks
+ * (benches/harness/bench_contention.c), so ThreadSanitizer sees their ordering. RB_THREADS_ITEMS=<count> overrides
+ * the number of items each producer writes.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#define _POSIX_C_SOURCE 200809L     /* pthread, sched_yield */
+
+/* STD-C Libraries */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>      /* snprintf */
+#include <stdlib.h>     /* getenv, strtoull */
+#include <string.h>     /* memset, size_t */
+
+/* POSIX */
+#include <pthread.h>
+#include <sched.h>      /* sched_yield */
+
+/* Unit Test Framework */
+#include "unity.h"
+
+/* Unit Test Support */
+#include "test_guard.h"
+
+/* Module Under Test */
+#include "ring_buffer_static.h"
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------- UNIT TEST SETUP VALUES ------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Guard Region patterns. Same meaning as in test_ring_buffer_static.c.
+ */
+#define RB_INSTANCES_PREPOSTPEND_VALUES                           0x33
+#define RB_INSTANCES_IN_USE_PREPOSTPEND_VALUES                    0x44
+
+
+/**
+ * @brief Number of items each producer writes when RB_THREADS_ITEMS is not set. Small enough to keep make test fast
+ * under ThreadSanitizer, large enough to wrap every Ring Buffer thousands of times.
+ */
+#define THREADS_DEFAULT_ITEMS                                     20000ULL
+
+
+/**
+ * @brief Most producer and most consumer threads a test starts.
+ */
+#define THREADS_MAX_PRODUCERS                                     4
+#define THREADS_MAX_CONSUMERS                                     4
+
+
+/**
+ * @brief Number of items each Ring Buffer holds. As many as fit, so producers and consumers hit both Full and Empty.
+ */
+#define THREADS_RING_LENGTH                                       (RING_BUFFER_STATIC_SIZE / sizeof(Threads_Item_t))
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------ SHARED QUEUE -----------------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief The element written to the Ring Buffer.
+ */
+typedef struct
+{
+   uint32_t producer;
+   uint32_t sequence;
+} Threads_Item_t;
+
+
+/**
+ * @brief A Ring Buffer shared by producer and consumer threads. Only the fields marked __atomic are touched without
+ * holding lock.
+ */
+typedef struct
+{
+   pthread_mutex_t lock;
+   Ring_Buffer_Static_Handle me;
+   uint32_t producers;
+   uint64_t items_per_producer;
+   int start;                                      /* __atomic. Threads spin until this is set so they start together. */
+   uint32_t producers_done;                        /* __atomic */
+} Threads_Queue_t;
+
+
+/**
+ * @brief What a consumer saw. Written by the consumer only and read by the test after pthread_join().
+ */
+typedef struct
+{
+   Threads_Queue_t * queue;
+   uint64_t received[THREADS_MAX_PRODUCERS];       /* Number of items received from each producer. */
+   uint64_t sequence_sum[THREADS_MAX_PRODUCERS];   /* Sum of the sequence numbers received from each producer. */
+   int64_t last_sequence[THREADS_MAX_PRODUCERS];   /* Sequence numbers of one producer must only increase. */
+   bool out_of_order;
+   bool unknown_producer;
+} Threads_Consumer_t;
+
+
+/**
+ * @brief A producer and the queue it writes to.
+ */
+typedef struct
+{
+   Threads_Queue_t * queue;
+   uint32_t id;
+} Threads_Producer_t;
+
+
+/**
+ * @brief A thread that owns its Ring Buffer and uses it without locking.
+ */
+typedef struct
+{
+   Ring_Buffer_Static_Handle me;
+   uint64_t items;
+   uint64_t mismatches;
+   int * start;                                    /* __atomic */
+} Threads_Owner_t;
+
+
+/**
+ * @brief The Handles the tests construct, destroyed in tearDown() whatever happened.
+ */
+static Threads_Queue_t Threads_Queue;
+static Threads_Owner_t Threads_Owners[NUMBER_OF_STATIC_RING_BUFFERS];
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------- GUARD REGIONS ---------------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+static Test_Guard RB_Instances_Guard;
+static Test_Guard RB_Instances_In_Use_Guard;
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*----------------------------------------------------------- HELPERS -----------------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Number of items each producer writes. RB_THREADS_ITEMS overrides THREADS_DEFAULT_ITEMS.
+ */
+static uint64_t Threads_Items(void);
+static uint64_t Threads_Items(void)
+{
+   const char * text = getenv("RB_THREADS_ITEMS");
+   uint64_t items = THREADS_DEFAULT_ITEMS;
+
+   if ((text) && (*text))
+   {
+      items = (uint64_t)strtoull(text, NULL, 0);
+   }
+
+   return items;
+}
+
+
+/**
+ * @brief Spins until the test sets start. Yields so this also works when there are fewer CPUs than threads.
+ */
+static void Threads_Wait_For_Start(int * start);
+static void Threads_Wait_For_Start(int * start)
+{
+   while (!__atomic_load_n(start, __ATOMIC_ACQUIRE))
+   {
+      (void)sched_yield();
+   }
+}
+
+
+/**
+ * @brief Writes every item of one producer, retrying while the Ring Buffer is Full.
+ */
+static void * Threads_Producer(void * arg);
+static void * Threads_Producer(void * arg)
+{
+   Threads_Producer_t * self = (Threads_Producer_t *)arg;
+   Threads_Queue_t * queue = self->queue;
+
+   Threads_Wait_For_Start(&queue->start);
+
+   for (uint64_t i = 0; i < queue->items_per_producer; i++)
+   {
+      const Threads_Item_t item = { self->id, (uint32_t)i };
+      bool written = false;
+
+      while (!written)
+      {
+         (void)pthread_mutex_lock(&queue->lock);
+         written = Ring_Buffer_Static_Write(&queue->me, &item, sizeof(item));
+         (void)pthread_mutex_unlock(&queue->lock);
+
+         if (!written)
+         {
+            (void)sched_yield();
+         }
+      }
+   }
+
+   (void)__atomic_add_fetch(&queue->producers_done, 1, __ATOMIC_RELEASE);
+   return NULL;
+}
+
+
+/**
+ * @brief Reads until every producer is done and the Ring Buffer is Empty, recording what arrived from whom. Whether
+ * the producers are done is loaded BEFORE the Read, so an Empty Read after that really is the end.
+ */
+static void * Threads_Consumer(void * arg);
+static void * Threads_Consumer(void * arg)
+{
+   Threads_Consumer_t * self = (Threads_Consumer_t *)arg;
+   Threads_Queue_t * queue = self->queue;
+   bool running = true;
+
+   Threads_Wait_For_Start(&queue->start);
+
+   while (running)
+   {
+      const bool done = (__atomic_load_n(&queue->producers_done, __ATOMIC_ACQUIRE) == queue->producers);
+      Threads_Item_t item;
+
+      (void)pthread_mutex_lock(&queue->lock);
+      const bool read = Ring_Buffer_Static_Read(&queue->me, &item, sizeof(item));
+      (void)pthread_mutex_unlock(&queue->lock);
+
+      if (read)
+      {
+         if (item.producer >= queue->producers)
+         {
+            self->unknown_producer = true;
+         }
+         else
+         {
+            self->out_of_order |= ((int64_t)item.sequence <= self->last_sequence[item.producer]);
+            self->last_sequence[item.producer] = (int64_t)item.sequence;
+            self->received[item.producer]++;
+            self->sequence_sum[item.producer] += item.sequence;
+         }
+      }
+      else if (done)
+      {
+         running = false;
+      }
+      else
+      {
+         (void)sched_yield();
+      }
+   }
+
+   return NULL;
+}
+
+
+/**
+ * @brief The value an owner thread writes as its i-th item. Mixes in the Handle so the Ring Buffers hold different data.
+ */
+static inline uint32_t Threads_Owner_Value(const Threads_Owner_t * self, uint64_t i);
+static inline uint32_t Threads_Owner_Value(const Threads_Owner_t * self, uint64_t i)
+{
+   return ((uint32_t)i * 2654435761u) ^ (uint32_t)self->me;
+}
+
+
+/**
+ * @brief Writes and reads back its own Ring Buffer without locking. Half the Ring Buffer is filled first, so every
+ * Read returns the item written THREADS_OWNER_LAG Writes earlier and the Reads and Writes wrap at different times.
+ */
+#define THREADS_OWNER_LAG                                         (RING_BUFFER_STATIC_SIZE / sizeof(uint32_t) / 2)
+static void * Threads_Owner(void * arg);
+static void * Threads_Owner(void * arg)
+{
+   Threads_Owner_t * self = (Threads_Owner_t *)arg;
+
+   Threads_Wait_For_Start(self->start);
+
+   for (uint64_t i = 0; i < self->items; i++)
+   {
+      const uint32_t written = Threads_Owner_Value(self, i);
+      uint32_t read = 0;
+
+      if (!Ring_Buffer_Static_Write(&self->me, &written, sizeof(written)))
+      {
+         self->mismatches++;
+      }
+      else if (i >= THREADS_OWNER_LAG)
+      {
+         if ((!Ring_Buffer_Static_Read(&self->me, &read, sizeof(read))) || (read != Threads_Owner_Value(self, i - THREADS_OWNER_LAG)))
+         {
+            self->mismatches++;
+         }
+      }
+   }
+
+   return NULL;
+}
+
+
+/**
+ * @brief Runs producers and consumers on the shared queue and checks every item of every producer arrived exactly
+ * once, and in order for each consumer.
+ */
+static void Threads_Run_Queue(uint32_t producers, uint32_t consumers);
+static void Threads_Run_Queue(uint32_t producers, uint32_t consumers)
+{
+   pthread_t producer_threads[THREADS_MAX_PRODUCERS];
+   pthread_t consumer_threads[THREADS_MAX_CONSUMERS];
+   Threads_Producer_t producer_args[THREADS_MAX_PRODUCERS];
+   Threads_Consumer_t consumer_args[THREADS_MAX_CONSUMERS];
+   Threads_Queue_t * queue = &Threads_Queue;
+   char message[128];
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Static_Ctor(&queue->me, sizeof(Threads_Item_t), (uint32_t)THREADS_RING_LENGTH));
+   TEST_ASSERT_EQUAL_INT(0, pthread_mutex_init(&queue->lock, NULL));
+   queue->producers = producers;
+   queue->items_per_producer = Threads_Items();
+
+   memset((void *)consumer_args, 0, sizeof(consumer_args));
+
+   for (uint32_t i = 0; i < consumers; i++)
+   {
+      consumer_args[i].queue = queue;
+
+      for (uint32_t p = 0; p < THREADS_MAX_PRODUCERS; p++)
+      {
+         consumer_args[i].last_sequence[p] = -1;
+      }
+
+      TEST_ASSERT_EQUAL_INT(0, pthread_create(&consumer_threads[i], NULL, Threads_Consumer, &consumer_args[i]));
+   }
+
+   for (uint32_t i = 0; i < producers; i++)
+   {
+      producer_args[i].queue = queue;
+      producer_args[i].id = i;
+      TEST_ASSERT_EQUAL_INT(0, pthread_create(&producer_threads[i], NULL, Threads_Producer, &producer_args[i]));
+   }
+
+   __atomic_store_n(&queue->start, 1, __ATOMIC_RELEASE);
+
+   for (uint32_t i = 0; i < producers; i++)
+   {
+      TEST_ASSERT_EQUAL_INT(0, pthread_join(producer_threads[i], NULL));
+   }
+
+   for (uint32_t i = 0; i < consumers; i++)
+   {
+      TEST_ASSERT_EQUAL_INT(0, pthread_join(consumer_threads[i], NULL));
+   }
+
+   TEST_ASSERT_EQUAL_INT(0, pthread_mutex_destroy(&queue->lock));
+
+   /* Each consumer sees an increasing subsequence of every producer. Together they must see every item once. */
+   for (uint32_t p = 0; p < producers; p++)
+   {
+      uint64_t received = 0;
+      uint64_t sequence_sum = 0;
+
+      for (uint32_t i = 0; i < consumers; i++)
+      {
+         TEST_ASSERT_FALSE_MESSAGE(consumer_args[i].unknown_producer, "Read an item no producer wrote");
+         TEST_ASSERT_FALSE_MESSAGE(consumer_args[i].out_of_order, "Read a producer's items out of order");
+         received += consumer_args[i].received[p];
+         sequence_sum += consumer_args[i].sequence_sum[p];
+      }
+
+      (void)snprintf(message, sizeof(message), "Producer %u", (unsigned)p);
+      TEST_ASSERT_EQUAL_UINT64_MESSAGE(queue->items_per_producer, received, message);
+      TEST_ASSERT_EQUAL_UINT64_MESSAGE(queue->items_per_producer * (queue->items_per_producer - 1u) / 2u, sequence_sum, message);
+   }
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Static_Is_Empty(&queue->me));
+   TEST_ASSERT_GUARD_INTACT(&RB_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RB_Instances_In_Use_Guard);
+}
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------- RUNS AT THE START AND END OF EACH TEST --------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+void setUp(void)
+{
+   Test_Guard_Init(&RB_Instances_Guard, "RB_Instances[]", &Test_RB_Instances_Memory_Region[0], Test_RB_Instances_Mem_Size,
+                   CLASS_POOL_MEMORY_EXTENSION_BYTES, RB_INSTANCES_PREPOSTPEND_VALUES);
+   Test_Guard_Init(&RB_Instances_In_Use_Guard, "RB_Instances_In_Use[]", &Test_RB_Instances_In_Use_Memory_Region[0], Test_RB_Instances_In_Use_Mem_Size,
+                   CLASS_POOL_IN_USE_MEMORY_EXTENSION_BYTES, RB_INSTANCES_IN_USE_PREPOSTPEND_VALUES);
+   Test_Guard_Arm(&RB_Instances_Guard);
+   Test_Guard_Arm(&RB_Instances_In_Use_Guard);
+
+   memset((void *)&Threads_Queue, 0, sizeof(Threads_Queue));
+   memset((void *)Threads_Owners, 0, sizeof(Threads_Owners));
+}
+
+void tearDown(void)
+{
+   (void)Ring_Buffer_Static_Destroy(&Threads_Queue.me);
+
+   for (uint32_t i = 0; i < NUMBER_OF_STATIC_RING_BUFFERS; i++)
+   {
+      (void)Ring_Buffer_Static_Destroy(&Threads_Owners[i].me);
+   }
+
+   Test_Guard_Release(&RB_Instances_Guard);
+   Test_Guard_Release(&RB_Instances_In_Use_Guard);
+   memset((void *)&Test_RB_Instances_Memory_Region[0], 0, Test_RB_Instances_Mem_Size);
+   memset((void *)&Test_RB_Instances_In_Use_Memory_Region[0], 0, Test_RB_Instances_In_Use_Mem_Size);
+}
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------------------- UNIT TESTS BEGIN -----------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief One producer and one consumer. The consumer must receive every item in exactly the order it was written.
+ */
+static void Test_Ring_Buffer_Static_Threads_SPSC(void);
+static void Test_Ring_Buffer_Static_Threads_SPSC(void)
+{
+   Threads_Run_Queue(1, 1);
+}
+
+
+/**
+ * @brief Several producers and consumers contending for the same lock and Ring Buffer.
+ */
+static void Test_Ring_Buffer_Static_Threads_MPMC(void);
+static void Test_Ring_Buffer_Static_Threads_MPMC(void)
+{
+   Threads_Run_Queue(THREADS_MAX_PRODUCERS, THREADS_MAX_CONSUMERS);
+}
+
+
+/**
+ * @brief Every pre-allocated Ring Buffer is owned by a different thread and used without any locking. The Handles
+ * are constructed before the threads start, since the Constructor scans the shared pool.
+ */
+static void Test_Ring_Buffer_Static_Threads_Independent_Buffers(void);
+static void Test_Ring_Buffer_Static_Threads_Independent_Buffers(void)
+{
+   pthread_t threads[NUMBER_OF_STATIC_RING_BUFFERS];
+   int start = 0;
+
+   for (uint32_t i = 0; i < NUMBER_OF_STATIC_RING_BUFFERS; i++)
+   {
+      Threads_Owners[i].items = Threads_Items();
+      Threads_Owners[i].start = &start;
+      TEST_ASSERT_TRUE(Ring_Buffer_Static_Ctor(&Threads_Owners[i].me, sizeof(uint32_t), RING_BUFFER_STATIC_SIZE / sizeof(uint32_t)));
+   }
+
+   for (uint32_t i = 0; i < NUMBER_OF_STATIC_RING_BUFFERS; i++)
+   {
+      TEST_ASSERT_EQUAL_INT(0, pthread_create(&threads[i], NULL, Threads_Owner, &Threads_Owners[i]));
+   }
+
+   __atomic_store_n(&start, 1, __ATOMIC_RELEASE);
+
+   for (uint32_t i = 0; i < NUMBER_OF_STATIC_RING_BUFFERS; i++)
+   {
+      TEST_ASSERT_EQUAL_INT(0, pthread_join(threads[i], NULL));
+   }
+
+   for (uint32_t i = 0; i < NUMBER_OF_STATIC_RING_BUFFERS; i++)
+   {
+      TEST_ASSERT_EQUAL_UINT64(0, Threads_Owners[i].mismatches);
+   }
+
+   TEST_ASSERT_GUARD_INTACT(&RB_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RB_Instances_In_Use_Guard);
+}
+
+
+
+
+
+int main(void)
+{
+   UNITY_BEGIN();
+   RUN_TEST(Test_Ring_Buffer_Static_Threads_SPSC);
+   RUN_TEST(Test_Ring_Buffer_Static_Threads_MPMC);
+   RUN_TEST(Test_Ring_Buffer_Static_Threads_Independent_Buffers);
+   return UNITY_END();
+}
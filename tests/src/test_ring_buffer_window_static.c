@@ -0,0 +1,455 @@
+/**
+ * @file test_ring_buffer_window_static.c
+ * @author agent
+ * @brief Unit Tests for the Window Ring Buffer module (ring_buffer_window_static.h). Checks the statistics after
+ * every Push against a rescan of the window, the monotonic deques with monotonic inputs, and that Recompute (AVX2 or
+ * NEON when the Class library is compiled for them) matches the rescan for every window length. Covers the sample type
+ * the Class was built with:
+ * cd tests && make clean && make test WINDOW_SAMPLE=float ARCH_FLAGS=-mavx2
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+/* STD-C Libraries */
+#include <math.h>       /* fabs, sqrt */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>      /* snprintf */
+#include <string.h>     /* memset */
+
+/* Unit Test Framework */
+#include "unity.h"
+
+/* Unit Test Support */
+#include "test_guard.h"
+
+/* Module Under Test */
+#include "ring_buffer_window_static.h"
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------- UNIT TEST SETUP VALUES ------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Guard Region patterns. Same meaning as RB_INSTANCES_PREPOSTPEND_VALUES and
+ * RB_INSTANCES_IN_USE_PREPOSTPEND_VALUES in test_ring_buffer_static.c.
+ */
+#define RBW_INSTANCES_PREPOSTPEND_VALUES                          0x38
+#define RBW_INSTANCES_IN_USE_PREPOSTPEND_VALUES                   0x49
+
+
+/**
+ * @brief Pushes checked against the rescan per window length. More than RING_BUFFER_WINDOW_STATIC_RECOMPUTE_PERIOD,
+ * so the periodic recompute runs in between.
+ */
+#define RBW_REFERENCE_PUSHES                                      5000u
+
+
+/**
+ * @brief Largest magnitude of the samples the tests generate. Every sample is an integer that all three sample types
+ * store exactly.
+ */
+#define RBW_SAMPLE_RANGE                                          2000
+
+
+/**
+ * @brief The most negative and most positive samples of the type. The float ones are the largest integers a float
+ * stores exactly.
+ */
+#if defined(RING_BUFFER_WINDOW_STATIC_SAMPLE_INT32)
+   #define RBW_SAMPLE_LOWEST                                      INT32_MIN
+   #define RBW_SAMPLE_HIGHEST                                     INT32_MAX
+#elif defined(RING_BUFFER_WINDOW_STATIC_SAMPLE_FLOAT)
+   #define RBW_SAMPLE_LOWEST                                      (-16777216.0f)
+   #define RBW_SAMPLE_HIGHEST                                     16777215.0f
+#else
+   #define RBW_SAMPLE_LOWEST                                      INT16_MIN
+   #define RBW_SAMPLE_HIGHEST                                     INT16_MAX
+#endif
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------- GUARD REGIONS ---------------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+static Test_Guard RBW_Instances_Guard;
+static Test_Guard RBW_Instances_In_Use_Guard;
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*----------------------------------------------------------- HELPERS -----------------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief The Handles the tests construct, destroyed in tearDown() whatever happened.
+ */
+static Ring_Buffer_Window_Static_Handle RBW_Handles[NUMBER_OF_STATIC_WINDOW_RING_BUFFERS + 1];
+
+
+/**
+ * @brief Every sample pushed since the last Clear, to rescan the window with.
+ */
+static Ring_Buffer_Window_Static_Sample RBW_History[RBW_REFERENCE_PUSHES];
+static uint32_t RBW_History_Count;
+
+
+/**
+ * @brief State of the pseudo-random sample generator. Reset in setUp() so every run pushes the same samples.
+ */
+static uint32_t RBW_Random_State;
+
+
+/**
+ * @brief Next pseudo-random sample from -RBW_SAMPLE_RANGE to RBW_SAMPLE_RANGE.
+ */
+static Ring_Buffer_Window_Static_Sample RBW_Random_Sample(void);
+static Ring_Buffer_Window_Static_Sample RBW_Random_Sample(void)
+{
+   RBW_Random_State = (RBW_Random_State * 1103515245u) + 12345u;
+
+   return (Ring_Buffer_Window_Static_Sample)((int32_t)((RBW_Random_State >> 8) % (2u * RBW_SAMPLE_RANGE + 1u)) - RBW_SAMPLE_RANGE);
+}
+
+
+/**
+ * @brief Pushes a sample to RBW_Handles[0] and records it.
+ */
+static void RBW_Push(Ring_Buffer_Window_Static_Sample sample);
+static void RBW_Push(Ring_Buffer_Window_Static_Sample sample)
+{
+   TEST_ASSERT_TRUE(Ring_Buffer_Window_Static_Push(&RBW_Handles[0], sample));
+   TEST_ASSERT_LESS_THAN_UINT32(RBW_REFERENCE_PUSHES, RBW_History_Count);
+   RBW_History[RBW_History_Count++] = sample;
+}
+
+
+/**
+ * @brief Returns if @p actual is within a relative error of 1e-4 of @p expected (absolute near 0).
+ */
+static bool RBW_Close(double expected, double actual);
+static bool RBW_Close(double expected, double actual)
+{
+   const double scale = (fabs(expected) > 1.0) ? fabs(expected) : 1.0;
+
+   return (fabs(expected - actual) <= (1e-4 * scale));
+}
+
+
+/**
+ * @brief Rescans the last @p window_length recorded samples and checks the statistics of RBW_Handles[0] against them.
+ */
+static void RBW_Expect_Rescan(uint32_t window_length);
+static void RBW_Expect_Rescan(uint32_t window_length)
+{
+   const uint32_t count = (RBW_History_Count < window_length) ? RBW_History_Count : window_length;
+   const Ring_Buffer_Window_Static_Sample * window = &RBW_History[RBW_History_Count - count];
+   Ring_Buffer_Window_Static_Sample min = window[0];
+   Ring_Buffer_Window_Static_Sample max = window[0];
+   double sum = 0.0;
+   double sum_squares = 0.0;
+   Ring_Buffer_Window_Static_Stats stats;
+   char message[96];
+
+   for (uint32_t i = 0; i < count; i++)
+   {
+      min = (window[i] < min) ? window[i] : min;
+      max = (window[i] > max) ? window[i] : max;
+      sum += (double)window[i];
+      sum_squares += (double)window[i] * (double)window[i];
+   }
+
+   (void)snprintf(message, sizeof(message), "After push %lu, window length %lu", (unsigned long)RBW_History_Count, (unsigned long)window_length);
+   TEST_ASSERT_EQUAL_UINT32_MESSAGE(count, Ring_Buffer_Window_Static_Get_Number_Of_Samples(&RBW_Handles[0]), message);
+   TEST_ASSERT_TRUE_MESSAGE(Ring_Buffer_Window_Static_Get_Stats(&RBW_Handles[0], &stats), message);
+   TEST_ASSERT_EQUAL_INT64_MESSAGE((int64_t)min, (int64_t)stats.min, message);
+   TEST_ASSERT_EQUAL_INT64_MESSAGE((int64_t)max, (int64_t)stats.max, message);
+   TEST_ASSERT_TRUE_MESSAGE(RBW_Close(sum / count, stats.mean), message);
+   TEST_ASSERT_TRUE_MESSAGE(RBW_Close(sqrt(sum_squares / count), stats.rms), message);
+}
+
+
+/**
+ * @brief Constructs RBW_Handles[0] with @p window_length and forgets the recorded samples.
+ */
+static void RBW_Start(uint32_t window_length);
+static void RBW_Start(uint32_t window_length)
+{
+   (void)Ring_Buffer_Window_Static_Destroy(&RBW_Handles[0]);
+   TEST_ASSERT_TRUE(Ring_Buffer_Window_Static_Ctor(&RBW_Handles[0], window_length));
+   RBW_History_Count = 0;
+}
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------- RUNS AT THE START AND END OF EACH TEST --------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+void setUp(void)
+{
+   Test_Guard_Init(&RBW_Instances_Guard, "RBW_Instances[]", &Test_RBW_Instances_Memory_Region[0], Test_RBW_Instances_Mem_Size,
+                   CLASS_POOL_MEMORY_EXTENSION_BYTES, RBW_INSTANCES_PREPOSTPEND_VALUES);
+   Test_Guard_Init(&RBW_Instances_In_Use_Guard, "RBW_Instances_In_Use[]", &Test_RBW_Instances_In_Use_Memory_Region[0], Test_RBW_Instances_In_Use_Mem_Size,
+                   CLASS_POOL_IN_USE_MEMORY_EXTENSION_BYTES, RBW_INSTANCES_IN_USE_PREPOSTPEND_VALUES);
+   Test_Guard_Arm(&RBW_Instances_Guard);
+   Test_Guard_Arm(&RBW_Instances_In_Use_Guard);
+
+   memset((void *)RBW_Handles, 0, sizeof(RBW_Handles));
+   RBW_History_Count = 0;
+   RBW_Random_State = 12345u;
+}
+
+void tearDown(void)
+{
+   for (uint32_t i = 0; i < (NUMBER_OF_STATIC_WINDOW_RING_BUFFERS + 1); i++)
+   {
+      (void)Ring_Buffer_Window_Static_Destroy(&RBW_Handles[i]);
+   }
+
+   Test_Guard_Release(&RBW_Instances_Guard);
+   Test_Guard_Release(&RBW_Instances_In_Use_Guard);
+   memset((void *)&Test_RBW_Instances_Memory_Region[0], 0, Test_RBW_Instances_Mem_Size);
+   memset((void *)&Test_RBW_Instances_In_Use_Memory_Region[0], 0, Test_RBW_Instances_In_Use_Mem_Size);
+}
+
+
+
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------------------- UNIT TESTS BEGIN -----------------------------------------------------*/
+/*-------------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief The Constructor refuses invalid window lengths, Handles already constructed and requests once the pool is
+ * used up.
+ */
+static void Test_Ring_Buffer_Window_Static_Ctor_Destroy(void);
+static void Test_Ring_Buffer_Window_Static_Ctor_Destroy(void)
+{
+   TEST_ASSERT_FALSE(Ring_Buffer_Window_Static_Ctor(NULL, 1));
+   TEST_ASSERT_FALSE(Ring_Buffer_Window_Static_Ctor(&RBW_Handles[0], 0));
+   TEST_ASSERT_FALSE(Ring_Buffer_Window_Static_Ctor(&RBW_Handles[0], RING_BUFFER_WINDOW_STATIC_MAX_LENGTH + 1));
+   TEST_ASSERT_FALSE(Ring_Buffer_Window_Static_Destroy(&RBW_Handles[0]));
+
+   for (uint32_t i = 0; i < NUMBER_OF_STATIC_WINDOW_RING_BUFFERS; i++)
+   {
+      TEST_ASSERT_TRUE(Ring_Buffer_Window_Static_Ctor(&RBW_Handles[i], RING_BUFFER_WINDOW_STATIC_MAX_LENGTH));
+      TEST_ASSERT_FALSE(Ring_Buffer_Window_Static_Ctor(&RBW_Handles[i], 1));
+   }
+
+   TEST_ASSERT_FALSE(Ring_Buffer_Window_Static_Ctor(&RBW_Handles[NUMBER_OF_STATIC_WINDOW_RING_BUFFERS], 1));
+   TEST_ASSERT_TRUE(Ring_Buffer_Window_Static_Destroy(&RBW_Handles[0]));
+   TEST_ASSERT_FALSE(Ring_Buffer_Window_Static_Destroy(&RBW_Handles[0]));
+   TEST_ASSERT_TRUE(Ring_Buffer_Window_Static_Ctor(&RBW_Handles[NUMBER_OF_STATIC_WINDOW_RING_BUFFERS], 1));
+
+   TEST_ASSERT_GUARD_INTACT(&RBW_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RBW_Instances_In_Use_Guard);
+}
+
+
+/**
+ * @brief Invalid Handles and NULL pointers are refused, and an empty window has no statistics.
+ */
+static void Test_Ring_Buffer_Window_Static_Invalid_Arguments(void);
+static void Test_Ring_Buffer_Window_Static_Invalid_Arguments(void)
+{
+   Ring_Buffer_Window_Static_Stats stats;
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Window_Static_Ctor(&RBW_Handles[0], 4));
+
+   TEST_ASSERT_FALSE(Ring_Buffer_Window_Static_Get_Stats(&RBW_Handles[0], &stats));
+   TEST_ASSERT_FALSE(Ring_Buffer_Window_Static_Push(NULL, 1));
+   TEST_ASSERT_FALSE(Ring_Buffer_Window_Static_Push(&RBW_Handles[1], 1));
+   TEST_ASSERT_FALSE(Ring_Buffer_Window_Static_Clear(&RBW_Handles[1]));
+   TEST_ASSERT_FALSE(Ring_Buffer_Window_Static_Recompute(&RBW_Handles[1]));
+   TEST_ASSERT_FALSE(Ring_Buffer_Window_Static_Get_Stats(&RBW_Handles[1], &stats));
+   TEST_ASSERT_EQUAL_UINT32(0, Ring_Buffer_Window_Static_Get_Number_Of_Samples(&RBW_Handles[1]));
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Window_Static_Push(&RBW_Handles[0], 1));
+   TEST_ASSERT_FALSE(Ring_Buffer_Window_Static_Get_Stats(&RBW_Handles[0], NULL));
+   TEST_ASSERT_TRUE(Ring_Buffer_Window_Static_Get_Stats(&RBW_Handles[0], &stats));
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Window_Static_Recompute(&RBW_Handles[0]));
+   TEST_ASSERT_TRUE(Ring_Buffer_Window_Static_Clear(&RBW_Handles[0]));
+   TEST_ASSERT_EQUAL_UINT32(0, Ring_Buffer_Window_Static_Get_Number_Of_Samples(&RBW_Handles[0]));
+   TEST_ASSERT_FALSE(Ring_Buffer_Window_Static_Get_Stats(&RBW_Handles[0], &stats));
+
+   TEST_ASSERT_GUARD_INTACT(&RBW_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RBW_Instances_In_Use_Guard);
+}
+
+
+/**
+ * @brief The statistics after every Push match a rescan of the window, while it fills and long after, for window
+ * lengths that are and are not multiples of the vector widths.
+ */
+static void Test_Ring_Buffer_Window_Static_Matches_Rescan(void);
+static void Test_Ring_Buffer_Window_Static_Matches_Rescan(void)
+{
+   const uint32_t window_lengths[] = { 1, 2, 7, 16, 33, RING_BUFFER_WINDOW_STATIC_MAX_LENGTH };
+
+   for (uint32_t w = 0; w < (sizeof(window_lengths) / sizeof(window_lengths[0])); w++)
+   {
+      RBW_Start(window_lengths[w]);
+
+      for (uint32_t i = 0; i < RBW_REFERENCE_PUSHES; i++)
+      {
+         RBW_Push(RBW_Random_Sample());
+         RBW_Expect_Rescan(window_lengths[w]);
+      }
+   }
+
+   TEST_ASSERT_GUARD_INTACT(&RBW_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RBW_Instances_In_Use_Guard);
+}
+
+
+/**
+ * @brief Rising, falling and constant runs: the worst cases of the monotonic deques, where one keeps every sample of
+ * the window and the other pops all of them on every Push.
+ */
+static void Test_Ring_Buffer_Window_Static_Monotonic_Runs(void);
+static void Test_Ring_Buffer_Window_Static_Monotonic_Runs(void)
+{
+   const uint32_t window_length = 9;
+
+   RBW_Start(window_length);
+
+   for (int32_t i = 0; i < 40; i++)
+   {
+      RBW_Push((Ring_Buffer_Window_Static_Sample)i);
+      RBW_Expect_Rescan(window_length);
+   }
+
+   for (int32_t i = 40; i > -40; i--)
+   {
+      RBW_Push((Ring_Buffer_Window_Static_Sample)i);
+      RBW_Expect_Rescan(window_length);
+   }
+
+   for (int32_t i = 0; i < 20; i++)
+   {
+      RBW_Push(5);
+      RBW_Expect_Rescan(window_length);
+   }
+
+   /* Equal samples: the newest one replaces the older ones, so the minimum survives the oldest one leaving. */
+   for (int32_t i = 0; i < 20; i++)
+   {
+      RBW_Push((Ring_Buffer_Window_Static_Sample)((i % 3) ? 5 : -5));
+      RBW_Expect_Rescan(window_length);
+   }
+
+   TEST_ASSERT_GUARD_INTACT(&RBW_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RBW_Instances_In_Use_Guard);
+}
+
+
+/**
+ * @brief Recompute matches the rescan for every number of samples in the window, so every remainder that does not
+ * fill a vector is covered. Clear starts the window over.
+ */
+static void Test_Ring_Buffer_Window_Static_Recompute(void);
+static void Test_Ring_Buffer_Window_Static_Recompute(void)
+{
+   RBW_Start(RING_BUFFER_WINDOW_STATIC_MAX_LENGTH);
+
+   for (uint32_t i = 0; i < (RING_BUFFER_WINDOW_STATIC_MAX_LENGTH + 5u); i++)
+   {
+      RBW_Push(RBW_Random_Sample());
+      TEST_ASSERT_TRUE(Ring_Buffer_Window_Static_Recompute(&RBW_Handles[0]));
+      RBW_Expect_Rescan(RING_BUFFER_WINDOW_STATIC_MAX_LENGTH);
+   }
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Window_Static_Clear(&RBW_Handles[0]));
+   RBW_History_Count = 0;
+   RBW_Push(3);
+   TEST_ASSERT_TRUE(Ring_Buffer_Window_Static_Recompute(&RBW_Handles[0]));
+   RBW_Expect_Rescan(RING_BUFFER_WINDOW_STATIC_MAX_LENGTH);
+
+   TEST_ASSERT_GUARD_INTACT(&RBW_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RBW_Instances_In_Use_Guard);
+}
+
+
+/**
+ * @brief A full window of the most negative and the most positive sample. For int16_t, pairs of squares of -32768
+ * are 2^31, one more than an int32_t holds.
+ */
+static void Test_Ring_Buffer_Window_Static_Extreme_Samples(void);
+static void Test_Ring_Buffer_Window_Static_Extreme_Samples(void)
+{
+   Ring_Buffer_Window_Static_Stats stats;
+
+   RBW_Start(RING_BUFFER_WINDOW_STATIC_MAX_LENGTH);
+
+   for (uint32_t i = 0; i < RING_BUFFER_WINDOW_STATIC_MAX_LENGTH; i++)
+   {
+      RBW_Push(RBW_SAMPLE_LOWEST);
+   }
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Window_Static_Recompute(&RBW_Handles[0]));
+   TEST_ASSERT_TRUE(Ring_Buffer_Window_Static_Get_Stats(&RBW_Handles[0], &stats));
+   TEST_ASSERT_TRUE(RBW_Close(-(double)RBW_SAMPLE_LOWEST, stats.rms));
+   RBW_Expect_Rescan(RING_BUFFER_WINDOW_STATIC_MAX_LENGTH);
+
+   for (uint32_t i = 0; i < RING_BUFFER_WINDOW_STATIC_MAX_LENGTH; i++)
+   {
+      RBW_Push(RBW_SAMPLE_HIGHEST);
+      RBW_Expect_Rescan(RING_BUFFER_WINDOW_STATIC_MAX_LENGTH);
+   }
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Window_Static_Recompute(&RBW_Handles[0]));
+   RBW_Expect_Rescan(RING_BUFFER_WINDOW_STATIC_MAX_LENGTH);
+
+   TEST_ASSERT_GUARD_INTACT(&RBW_Instances_Guard);
+   TEST_ASSERT_GUARD_INTACT(&RBW_Instances_In_Use_Guard);
+}
+
+
+/**
+ * @brief A large sample leaving the window takes the low bits of the small squares added while it was in with it.
+ * The int16_t sums are exact. For the others Recompute removes the error.
+ */
+static void Test_Ring_Buffer_Window_Static_Recompute_Removes_Drift(void);
+static void Test_Ring_Buffer_Window_Static_Recompute_Removes_Drift(void)
+{
+   Ring_Buffer_Window_Static_Stats stats;
+
+   RBW_Start(2);
+   RBW_Push(RBW_SAMPLE_HIGHEST);
+   RBW_Push(3);
+   RBW_Push(3);
+
+#if defined(RING_BUFFER_WINDOW_STATIC_SAMPLE_INT32) || defined(RING_BUFFER_WINDOW_STATIC_SAMPLE_FLOAT)
+   TEST_ASSERT_TRUE(Ring_Buffer_Window_Static_Recompute(&RBW_Handles[0]));
+#endif
+
+   TEST_ASSERT_TRUE(Ring_Buffer_Window_Static_Get_Stats(&RBW_Handles[0], &stats));
+   TEST_ASSERT_EQUAL_FLOAT(3.0f, stats.rms);
+   TEST_ASSERT_EQUAL_FLOAT(3.0f, stats.mean);
+   RBW_Expect_Rescan(2);
+}
+
+
+
+
+int main(void)
+{
+   UNITY_BEGIN();
+   RUN_TEST(Test_Ring_Buffer_Window_Static_Ctor_Destroy);
+   RUN_TEST(Test_Ring_Buffer_Window_Static_Invalid_Arguments);
+   RUN_TEST(Test_Ring_Buffer_Window_Static_Matches_Rescan);
+   RUN_TEST(Test_Ring_Buffer_Window_Static_Monotonic_Runs);
+   RUN_TEST(Test_Ring_Buffer_Window_Static_Recompute);
+   RUN_TEST(Test_Ring_Buffer_Window_Static_Extreme_Samples);
+   RUN_TEST(Test_Ring_Buffer_Window_Static_Recompute_Removes_Drift);
+   return UNITY_END();
+}
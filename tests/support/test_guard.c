@@ -0,0 +1,350 @@
+/**
+ * @file test_guard.c
+ * @author agent
+ * @brief Guard Region checker for Unit Tests. See test_guard.h for details.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#if defined(TEST_GUARD_PAGES)
+    #if !defined(__linux__)
+        #error "TEST_GUARD_PAGES is only supported on Linux."
+    #endif
+    #define _POSIX_C_SOURCE 200809L     /* sigaction, siginfo_t */
+#endif
+
+/* STD-C Libraries */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>      /* snprintf */
+#include <string.h>     /* memcmp, memset */
+
+#if defined(TEST_GUARD_PAGES)
+    #include <signal.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+/* Unit Test Framework */
+#include "unity.h"
+
+/* Module */
+#include "test_guard.h"
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*----------------------------------------------------------- HELPERS -------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Verifies every byte of [start, start + size) equals pattern. The bytes all equal pattern exactly when the
+ * first one does and each one equals its successor, so the whole span is verified by a single (word-wide) memcmp.
+ * The span is only walked byte by byte once it is known to be overwritten.
+ *
+ * @param index Set to the index of the first overwritten byte if the span was overwritten.
+ *
+ * @return True if no byte was overwritten. False otherwise.
+ */
+static bool Span_Is_Intact(const uint8_t * start, size_t size, uint8_t pattern, size_t * index);
+static bool Span_Is_Intact(const uint8_t * start, size_t size, uint8_t pattern, size_t * index)
+{
+    if ((size == 0) || ((start[0] == pattern) && (memcmp(start, start + 1, size - 1) == 0)))
+    {
+        return true;
+    }
+
+    for (*index = 0; start[*index] == pattern; (*index)++)
+    {
+    }
+    return false;
+}
+
+
+/**
+ * @brief Verifies one band, skipping the span that is mprotect'd (if any) since it cannot be written.
+ *
+ * @param offset Set to the offset of the first overwritten byte from the start of the Guard Region.
+ */
+static bool Band_Is_Intact(const Test_Guard * guard, size_t band, size_t * offset);
+static bool Band_Is_Intact(const Test_Guard * guard, size_t band, size_t * offset)
+{
+    const uint8_t * start = (band == 0) ? guard->region : (guard->region + guard->region_size - guard->guard_size);
+    const uint8_t * end = start + guard->guard_size;
+    const uint8_t * locked_start = (guard->locked[band]) ? guard->locked[band] : end;
+    const uint8_t * locked_end = (guard->locked[band]) ? (guard->locked[band] + guard->locked_size[band]) : end;
+    size_t index;
+
+    if (!Span_Is_Intact(start, (size_t)(locked_start - start), guard->pattern, &index))
+    {
+        *offset = (size_t)(start - guard->region) + index;
+        return false;
+    }
+
+    if (!Span_Is_Intact(locked_end, (size_t)(end - locked_end), guard->pattern, &index))
+    {
+        *offset = (size_t)(locked_end - guard->region) + index;
+        return false;
+    }
+
+    return true;
+}
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*-------------------------------------------------------- GUARD PAGES ------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+#if defined(TEST_GUARD_PAGES)
+
+/**
+ * @brief Guard Regions that currently have guard pages. Used by the SIGSEGV handler to name the Guard Region
+ * that was accessed.
+ */
+static const Test_Guard * Locked_Guards[TEST_GUARD_MAX_LOCKED_REGIONS];
+
+
+/**
+ * @brief Writes a string to stderr. Async-signal-safe.
+ */
+static void Signal_Safe_Print(const char * str);
+static void Signal_Safe_Print(const char * str)
+{
+    (void)write(STDERR_FILENO, str, strlen(str));
+}
+
+
+/**
+ * @brief Writes an unsigned number to stderr. Async-signal-safe.
+ */
+static void Signal_Safe_Print_Number(size_t number);
+static void Signal_Safe_Print_Number(size_t number)
+{
+    char digits[24];
+    size_t i = sizeof(digits) - 1;
+
+    digits[i] = '\0';
+    do
+    {
+        digits[--i] = (char)('0' + (number % 10));
+        number /= 10;
+    } while (number != 0);
+
+    Signal_Safe_Print(&digits[i]);
+}
+
+
+/**
+ * @brief Names the Guard Region an access faulted on, then restores the default action and returns. The faulting
+ * instruction is re-executed and terminates the process with SIGSEGV, so a debugger or core dump stops exactly at
+ * the out-of-bounds access.
+ */
+static void Guard_Page_Fault_Handler(int signal_number, siginfo_t * info, void * context);
+static void Guard_Page_Fault_Handler(int signal_number, siginfo_t * info, void * context)
+{
+    const uint8_t * address = (const uint8_t *)info->si_addr;
+    struct sigaction action;
+
+    (void)context;
+
+    for (size_t i = 0; i < TEST_GUARD_MAX_LOCKED_REGIONS; i++)
+    {
+        const Test_Guard * guard = Locked_Guards[i];
+
+        if ((guard) && (address >= guard->region) && (address < (guard->region + guard->region_size)))
+        {
+            const size_t offset = (size_t)(address - guard->region);
+
+            Signal_Safe_Print("\nOut-of-bounds access on guard page of ");
+            Signal_Safe_Print(guard->name);
+            Signal_Safe_Print(": ");
+            if (offset < guard->guard_size)
+            {
+                Signal_Safe_Print_Number(guard->guard_size - offset);
+                Signal_Safe_Print(" Bytes before the object\n");
+            }
+            else
+            {
+                Signal_Safe_Print_Number(offset - (guard->region_size - guard->guard_size) + 1);
+                Signal_Safe_Print(" Bytes after the object\n");
+            }
+            break;
+        }
+    }
+
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = SIG_DFL;
+    (void)sigemptyset(&action.sa_mask);
+    (void)sigaction(signal_number, &action, NULL);
+}
+
+
+/**
+ * @brief Makes every whole page inside both bands inaccessible and registers the Guard Region with the SIGSEGV
+ * handler.
+ */
+static void Lock_Guard_Pages(Test_Guard * guard);
+static void Lock_Guard_Pages(Test_Guard * guard)
+{
+    static bool handler_installed = false;
+    const uintptr_t page_size = (uintptr_t)sysconf(_SC_PAGESIZE);
+    size_t slot;
+
+    if (!handler_installed)
+    {
+        struct sigaction action;
+
+        memset(&action, 0, sizeof(action));
+        action.sa_sigaction = Guard_Page_Fault_Handler;
+        action.sa_flags = SA_SIGINFO;
+        (void)sigemptyset(&action.sa_mask);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(0, sigaction(SIGSEGV, &action, NULL), "Could not install the guard page handler.");
+        handler_installed = true;
+    }
+
+    for (size_t band = 0; band < 2; band++)
+    {
+        const uintptr_t start = (uintptr_t)((band == 0) ? guard->region : (guard->region + guard->region_size - guard->guard_size));
+        const uintptr_t first_page = (start + page_size - 1) & ~(page_size - 1);
+        const uintptr_t last_page = (start + guard->guard_size) & ~(page_size - 1);
+
+        if (last_page > first_page)
+        {
+            TEST_ASSERT_EQUAL_INT_MESSAGE(0, mprotect((void *)first_page, (size_t)(last_page - first_page), PROT_NONE),
+                                          "Could not mprotect guard pages.");
+            guard->locked[band] = (uint8_t *)first_page;
+            guard->locked_size[band] = (size_t)(last_page - first_page);
+        }
+    }
+
+    /* Only Guard Regions that actually got pages need to be known by the handler (and released before going out of scope). */
+    if ((guard->locked[0]) || (guard->locked[1]))
+    {
+        for (slot = 0; (slot < TEST_GUARD_MAX_LOCKED_REGIONS) && (Locked_Guards[slot]); slot++)
+        {
+        }
+        TEST_ASSERT_TRUE_MESSAGE(slot < TEST_GUARD_MAX_LOCKED_REGIONS, "Too many Guard Regions armed. Increase TEST_GUARD_MAX_LOCKED_REGIONS.");
+        Locked_Guards[slot] = guard;
+    }
+}
+
+
+/**
+ * @brief Makes the guard pages accessible again and unregisters the Guard Region.
+ */
+static void Unlock_Guard_Pages(Test_Guard * guard);
+static void Unlock_Guard_Pages(Test_Guard * guard)
+{
+    for (size_t band = 0; band < 2; band++)
+    {
+        if (guard->locked[band])
+        {
+            (void)mprotect((void *)guard->locked[band], guard->locked_size[band], PROT_READ | PROT_WRITE);
+            guard->locked[band] = NULL;
+            guard->locked_size[band] = 0;
+        }
+    }
+
+    for (size_t i = 0; i < TEST_GUARD_MAX_LOCKED_REGIONS; i++)
+    {
+        if (Locked_Guards[i] == guard)
+        {
+            Locked_Guards[i] = NULL;
+        }
+    }
+}
+
+#endif /* TEST_GUARD_PAGES */
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------- PUBLIC METHODS ----------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+void Test_Guard_Init(Test_Guard * guard, const char * name, uint8_t * region, size_t region_size, size_t guard_size,
+                     uint8_t pattern)
+{
+    TEST_ASSERT_NOT_NULL(guard);
+    TEST_ASSERT_NOT_NULL(region);
+    TEST_ASSERT_TRUE_MESSAGE(region_size >= (2 * guard_size), "Guard Region is smaller than its two bands.");
+
+    guard->name = name;
+    guard->region = region;
+    guard->region_size = region_size;
+    guard->guard_size = guard_size;
+    guard->pattern = pattern;
+    guard->locked[0] = NULL;
+    guard->locked[1] = NULL;
+    guard->locked_size[0] = 0;
+    guard->locked_size[1] = 0;
+}
+
+
+void Test_Guard_Arm(Test_Guard * guard)
+{
+    Test_Guard_Release(guard);
+
+    memset(guard->region, guard->pattern, guard->guard_size);
+    memset(guard->region + guard->region_size - guard->guard_size, guard->pattern, guard->guard_size);
+
+#if defined(TEST_GUARD_PAGES)
+    Lock_Guard_Pages(guard);
+#endif
+}
+
+
+void Test_Guard_Release(Test_Guard * guard)
+{
+#if defined(TEST_GUARD_PAGES)
+    Unlock_Guard_Pages(guard);
+#else
+    (void)guard;
+#endif
+}
+
+
+bool Test_Guard_Check(const Test_Guard * guard, size_t * offset)
+{
+    size_t first_overwrite = 0;
+    const bool intact = Band_Is_Intact(guard, 0, &first_overwrite) && Band_Is_Intact(guard, 1, &first_overwrite);
+
+    if ((!intact) && (offset))
+    {
+        *offset = first_overwrite;
+    }
+    return intact;
+}
+
+
+void Test_Guard_Assert_Intact(const Test_Guard * guard, const char * message, UNITY_LINE_TYPE line)
+{
+    /* Static since Unity keeps a pointer to the failure message until it is printed. */
+    static char fail_msg[256];
+    size_t offset;
+
+    if (Test_Guard_Check(guard, &offset))
+    {
+        return;
+    }
+
+    if (offset < guard->guard_size)
+    {
+        (void)snprintf(fail_msg, sizeof(fail_msg), "Wrote to out-of-range memory %zu Bytes before %s (expected 0x%02X was 0x%02X).%s%s",
+                       guard->guard_size - offset, guard->name, guard->pattern, guard->region[offset], (message) ? " " : "",
+                       (message) ? message : "");
+    }
+    else
+    {
+        (void)snprintf(fail_msg, sizeof(fail_msg), "Wrote to out-of-range memory %zu Bytes after %s (expected 0x%02X was 0x%02X).%s%s",
+                       offset - (guard->region_size - guard->guard_size) + 1, guard->name, guard->pattern, guard->region[offset],
+                       (message) ? " " : "", (message) ? message : "");
+    }
+    UNITY_TEST_FAIL(line, fail_msg);
+}
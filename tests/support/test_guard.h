@@ -0,0 +1,118 @@
+/**
+ * @file test_guard.h
+ * @author agent
+ * @brief Guard Region checker for Unit Tests. Detects out-of-bounds memory access by surrounding an object (i.e. a
+ * Class's pre-allocated pool, or a data buffer handed to the Class) with bands of known bytes. A Guard Region is one
+ * contiguous array laid out as:
+ *
+ * [guard_size Bytes of pattern, Protected Object, guard_size Bytes of pattern]
+ *
+ * Test_Guard_Arm() fills both bands with the pattern and TEST_ASSERT_GUARD_INTACT() fails the current Test, naming
+ * the first overwritten byte and how far it is from the Protected Object.
+ *
+ * Build with TEST_GUARD_PAGES defined (Linux only) to additionally mprotect every whole page inside the bands. An
+ * access to those pages then faults at the offending instruction instead of being found by a later scan, and only
+ * the partial pages next to the Protected Object still have to be scanned. Bands need to be at least two pages long
+ * to be guaranteed a whole page.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+#ifndef TEST_GUARD_H_
+#define TEST_GUARD_H_
+
+
+/* STD-C Libraries */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Unit Test Framework */
+#include "unity.h"
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------------- GUARD REGION ------------------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief The number of Guard Regions that can be armed with guard pages at the same time. Only used when
+ * TEST_GUARD_PAGES is defined.
+ */
+#define TEST_GUARD_MAX_LOCKED_REGIONS                                       8
+
+
+/**
+ * @brief A Guard Region. Initialize with Test_Guard_Init(). Do not edit the members directly.
+ */
+typedef struct
+{
+    const char * name;                  /* Printed in failure messages. I.e. "RB_Instances[]". */
+    uint8_t * region;                   /* Start of the leading band. */
+    size_t region_size;                 /* Number of Bytes of the whole Guard Region, bands included. */
+    size_t guard_size;                  /* Number of Bytes of each band. */
+    uint8_t pattern;                    /* Value every band byte is set to. */
+    uint8_t * locked[2];                /* Page-aligned span mprotect'd inside each band. NULL if none. */
+    size_t locked_size[2];
+} Test_Guard;
+
+
+/**
+ * @brief Initializes a Guard Region. Nothing is written until Test_Guard_Arm() is called.
+ *
+ * @param guard The Guard Region to initialize.
+ * @param name Name printed in failure messages.
+ * @param region Start of the whole Guard Region (the leading band).
+ * @param region_size Number of Bytes of the whole Guard Region. Must be at least 2 * guard_size.
+ * @param guard_size Number of Bytes of each band.
+ * @param pattern Value every band byte is set to. Pick one the Protected Object is unlikely to write.
+ */
+void Test_Guard_Init(Test_Guard * guard, const char * name, uint8_t * region, size_t region_size, size_t guard_size,
+                     uint8_t pattern);
+
+
+/**
+ * @brief Fills both bands with the pattern. With TEST_GUARD_PAGES, also makes the whole pages inside the bands
+ * inaccessible. Call in setUp() or before handing the Protected Object to the Class Under Test.
+ *
+ * @param guard The Guard Region to arm.
+ */
+void Test_Guard_Arm(Test_Guard * guard);
+
+
+/**
+ * @brief Makes any guard pages accessible again. Must be called before the whole Guard Region is written (i.e.
+ * cleared in tearDown()) or goes out of scope. Does nothing without TEST_GUARD_PAGES.
+ *
+ * @param guard The Guard Region to release.
+ */
+void Test_Guard_Release(Test_Guard * guard);
+
+
+/**
+ * @brief Verifies both bands still hold the pattern.
+ *
+ * @param guard The Guard Region to check.
+ * @param offset Optional. Set to the offset of the first overwritten byte from the start of the Guard Region.
+ *
+ * @return True if no band byte was overwritten. False otherwise.
+ */
+bool Test_Guard_Check(const Test_Guard * guard, size_t * offset);
+
+
+/**
+ * @brief Fails the current Test if a band byte was overwritten. Use TEST_ASSERT_GUARD_INTACT() instead.
+ */
+void Test_Guard_Assert_Intact(const Test_Guard * guard, const char * message, UNITY_LINE_TYPE line);
+
+
+#define TEST_ASSERT_GUARD_INTACT(guard)                         Test_Guard_Assert_Intact((guard), NULL, __LINE__)
+#define TEST_ASSERT_GUARD_INTACT_MESSAGE(guard, message)        Test_Guard_Assert_Intact((guard), (message), __LINE__)
+
+
+#endif /* TEST_GUARD_H_ */
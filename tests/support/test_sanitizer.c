@@ -0,0 +1,52 @@
+/**
+ * @file test_sanitizer.c
+ * @author agent
+ * @brief Default options of the sanitizers for the asan and tsan profiles (lib/profile.mk). Every Unit Test executable
+ * links this, but the functions are only called when a sanitizer runtime is linked in as well.
+ *
+ * With make FORK=1, each RUN_TEST runs in its own child process (Unity/extras/fork), which ends with _exit() and skips
+ * the end-of-process checks of the sanitizers. Aborting at the first report makes the child die with a signal instead,
+ * so the test that caused the report fails and the report is printed above its result. The ASAN_OPTIONS, TSAN_OPTIONS and
+ * UBSAN_OPTIONS environment variables still override these.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+
+
+/*---------------------------------------------------------------------------------------------------------------------------*/
+/*------------------------------------------------ SANITIZER RUNTIME CALLBACKS ----------------------------------------------*/
+/*---------------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief AddressSanitizer. Stops at the first error anyway, abort_on_error makes it a signal instead of exit(1).
+ */
+const char * __asan_default_options(void);
+const char * __asan_default_options(void)
+{
+    return "abort_on_error=1";
+}
+
+
+/**
+ * @brief UndefinedBehaviorSanitizer. The profile compiles with -fno-sanitize-recover=all, so a report already stops
+ * the process. The stack trace shows which Ring Buffer call got there.
+ */
+const char * __ubsan_default_options(void);
+const char * __ubsan_default_options(void)
+{
+    return "print_stacktrace=1:abort_on_error=1";
+}
+
+
+/**
+ * @brief ThreadSanitizer. Continues after a data race by default and only changes the exit code at the end.
+ */
+const char * __tsan_default_options(void);
+const char * __tsan_default_options(void)
+{
+    return "halt_on_error=1:abort_on_error=1:second_deadlock_stack=1";
+}